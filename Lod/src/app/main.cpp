@@ -18,10 +18,27 @@ struct CommandLineOptions {
     std::vector<std::string> formats{"3dtiles"};
     std::string mode{"auto"};  // auto, geo, geometric
     std::string crs{"EPSG:4326"};
+    std::string tiling{"data"};  // data, geodetic, mercator
     size_t maxTriangles{50000};
     int maxLevels{8};
     double reductionRatio{0.5};
+    std::string strategy{"triangles"};  // triangles, error
+    std::vector<double> errorBudget{16.0, 8.0, 4.0, 2.0, 1.0};
+    std::string simplifier{"meshopt"};  // meshopt, qem
     bool useOctree{true};
+    std::string splitStrategy{"center"};  // center, median, sah, kd
+    bool looseOctree{false};
+    float looseness{2.0f};
+    bool bottomUp{false};
+    std::string octreeIndex;  // 空 = 不保存索引，每次全量构建
+    std::string borderMode{"lock"};  // lock, skirts, none
+    float fallbackFactor{2.0f};
+    bool hausdorffError{false};
+    float normalWeight{0.5f};
+    float uvWeight{1.0f};
+    float colorWeight{0.25f};
+    std::string cacheDir;  // 空 = 不缓存
+    size_t cacheSizeMb{1024};
     bool enableParallel{true};
     size_t maxThreads{0};
     bool verbose{false};
@@ -42,10 +59,27 @@ std::expected<CommandLineOptions, std::string> parseCommandLine(int argc, char*
             ("f,format", "Output formats (osgb,3dtiles)", cxxopts::value<std::vector<std::string>>()->default_value("3dtiles"))
             ("mode", "LOD mode (auto,geo,geometric)", cxxopts::value<std::string>()->default_value("auto"))
             ("crs", "Coordinate reference system", cxxopts::value<std::string>()->default_value("EPSG:4326"))
+            ("tiling", "Geographic tiling (data=split the data bounds, geodetic=TMS global geodetic, mercator=Web Mercator z/x/y)", cxxopts::value<std::string>()->default_value("data"))
             ("max-triangles", "Maximum triangles per tile", cxxopts::value<size_t>()->default_value("50000"))
             ("max-levels", "Maximum LOD levels", cxxopts::value<int>()->default_value("8"))
             ("reduction-ratio", "Triangle reduction ratio per level", cxxopts::value<double>()->default_value("0.5"))
+            ("strategy", "Simplification strategy (triangles,error)", cxxopts::value<std::string>()->default_value("triangles"))
+            ("error-budget", "Screen-space error budget per level in pixels (error strategy)", cxxopts::value<std::vector<double>>()->default_value("16,8,4,2,1"))
             ("use-octree", "Use octree subdivision", cxxopts::value<bool>()->default_value("true"))
+            ("split-strategy", "Spatial split strategy (center,median,sah,kd)", cxxopts::value<std::string>()->default_value("center"))
+            ("loose-octree", "Use loose octree (no triangle duplication)", cxxopts::value<bool>()->default_value("false"))
+            ("looseness", "Loose octree bounds expansion factor", cxxopts::value<float>()->default_value("2.0"))
+            ("simplifier", "Simplifier backend (meshopt,qem)", cxxopts::value<std::string>()->default_value("meshopt"))
+            ("border-mode", "Tile border handling (lock,skirts,none)", cxxopts::value<std::string>()->default_value("lock"))
+            ("fallback-factor", "Use sloppy simplification when the result exceeds the target by this factor (0=off)", cxxopts::value<float>()->default_value("2.0"))
+            ("bottom-up", "Build parents from simplified children instead of the source", cxxopts::value<bool>()->default_value("false"))
+            ("octree-index", "Persistent octree index file; only changed input files are re-partitioned, and with --bottom-up only affected subtrees are rebuilt (geometric mode)", cxxopts::value<std::string>()->default_value(""))
+            ("hausdorff-error", "Also measure sampled Hausdorff distance for geometric error", cxxopts::value<bool>()->default_value("false"))
+            ("normal-weight", "Simplification weight of normals (triangles strategy, 0=ignore)", cxxopts::value<float>()->default_value("0.5"))
+            ("uv-weight", "Simplification weight of texture coordinates (triangles strategy, 0=ignore)", cxxopts::value<float>()->default_value("1.0"))
+            ("color-weight", "Simplification weight of vertex colors (triangles strategy, 0=ignore)", cxxopts::value<float>()->default_value("0.25"))
+            ("cache-dir", "Persistent simplification cache directory", cxxopts::value<std::string>()->default_value(""))
+            ("cache-size-mb", "Simplification cache size cap in MiB (least recently used entries are evicted)", cxxopts::value<size_t>()->default_value("1024"))
             ("parallel", "Enable parallel processing", cxxopts::value<bool>()->default_value("true"))
             ("max-threads", "Maximum threads (0=auto)", cxxopts::value<size_t>()->default_value("0"))
             ("v,verbose", "Verbose output", cxxopts::value<bool>()->default_value("false"))
@@ -79,10 +113,27 @@ std::expected<CommandLineOptions, std::string> parseCommandLine(int argc, char*
         opts.formats = result["format"].as<std::vector<std::string>>();
         opts.mode = result["mode"].as<std::string>();
         opts.crs = result["crs"].as<std::string>();
+        opts.tiling = result["tiling"].as<std::string>();
         opts.maxTriangles = result["max-triangles"].as<size_t>();
         opts.maxLevels = result["max-levels"].as<int>();
         opts.reductionRatio = result["reduction-ratio"].as<double>();
+        opts.strategy = result["strategy"].as<std::string>();
+        opts.errorBudget = result["error-budget"].as<std::vector<double>>();
         opts.useOctree = result["use-octree"].as<bool>();
+        opts.splitStrategy = result["split-strategy"].as<std::string>();
+        opts.looseOctree = result["loose-octree"].as<bool>();
+        opts.looseness = result["looseness"].as<float>();
+        opts.bottomUp = result["bottom-up"].as<bool>();
+        opts.octreeIndex = result["octree-index"].as<std::string>();
+        opts.simplifier = result["simplifier"].as<std::string>();
+        opts.borderMode = result["border-mode"].as<std::string>();
+        opts.fallbackFactor = result["fallback-factor"].as<float>();
+        opts.hausdorffError = result["hausdorff-error"].as<bool>();
+        opts.normalWeight = result["normal-weight"].as<float>();
+        opts.uvWeight = result["uv-weight"].as<float>();
+        opts.colorWeight = result["color-weight"].as<float>();
+        opts.cacheDir = result["cache-dir"].as<std::string>();
+        opts.cacheSizeMb = result["cache-size-mb"].as<size_t>();
         opts.enableParallel = result["parallel"].as<bool>();
         opts.maxThreads = result["max-threads"].as<size_t>();
         opts.verbose = result["verbose"].as<bool>();
@@ -164,6 +215,38 @@ void logCallback(const std::string& level, const std::string& message) {
     else spdlog::info(message);
 }
 
+// 解析划分策略
+core::SplitStrategy parseSplitStrategy(const std::string& name) {
+    if (name == "center") return core::SplitStrategy::Center;
+    if (name == "median") return core::SplitStrategy::Median;
+    if (name == "sah") return core::SplitStrategy::SurfaceAreaHeuristic;
+    if (name == "kd") return core::SplitStrategy::KdLongestAxis;
+    throw std::runtime_error("Unknown split strategy: " + name);
+}
+
+// 解析简化后端
+core::SimplifierBackend parseSimplifierBackend(const std::string& name) {
+    if (name == "meshopt") return core::SimplifierBackend::Meshopt;
+    if (name == "qem") return core::SimplifierBackend::Qem;
+    throw std::runtime_error("Unknown simplifier: " + name);
+}
+
+// 解析边界处理方式
+core::BorderMode parseBorderMode(const std::string& name) {
+    if (name == "lock") return core::BorderMode::LockCellFaces;
+    if (name == "skirts") return core::BorderMode::Skirts;
+    if (name == "none") return core::BorderMode::None;
+    throw std::runtime_error("Unknown border mode: " + name);
+}
+
+// 解析地理瓦片方案（data 表示四分数据自身的包围盒）
+std::optional<geo::TilingScheme> parseTilingScheme(const std::string& name) {
+    if (name == "data") return std::nullopt;
+    if (name == "geodetic") return geo::TilingScheme(geo::TilingSchemeType::Geodetic);
+    if (name == "mercator") return geo::TilingScheme(geo::TilingSchemeType::WebMercator);
+    throw std::runtime_error("Unknown tiling scheme: " + name);
+}
+
 // 构建管道配置
 pipeline::PipelineConfig buildPipelineConfig(const CommandLineOptions& opts) {
     pipeline::PipelineConfig config;
@@ -175,12 +258,27 @@ pipeline::PipelineConfig buildPipelineConfig(const CommandLineOptions& opts) {
     }
     config.inputConfig = std::move(*inputConfigResult);
     
-    // LOD 配置
-    config.lodConfig.strategy = std::make_unique<core::TriangleCountStrategy>(
-        opts.maxTriangles, opts.reductionRatio);
+    // LOD 配置；误差策略仅按位置简化，像素预算即几何误差，不与属性误差混合
+    if (opts.strategy == "error") {
+        config.lodConfig.strategy = std::make_unique<core::TargetErrorStrategy>(
+            opts.errorBudget, 256.0, opts.maxTriangles);
+    } else {
+        const core::AttributeWeights attributeWeights{opts.normalWeight, opts.uvWeight, opts.colorWeight};
+        config.lodConfig.strategy = std::make_unique<core::TriangleCountStrategy>(
+            opts.maxTriangles, opts.reductionRatio, attributeWeights);
+    }
+    config.lodConfig.simplifier = core::createSimplifier(parseSimplifierBackend(opts.simplifier));
     config.lodConfig.maxLodLevels = opts.maxLevels;
     config.lodConfig.enableParallelProcessing = opts.enableParallel;
     config.lodConfig.useOctreeSubdivision = opts.useOctree;
+    config.lodConfig.octreeConfig.splitStrategy = parseSplitStrategy(opts.splitStrategy);
+    config.lodConfig.octreeConfig.looseOctree = opts.looseOctree;
+    config.lodConfig.octreeConfig.looseness = opts.looseness;
+    config.lodConfig.bottomUpConstruction = opts.bottomUp;
+    config.lodConfig.borderMode = parseBorderMode(opts.borderMode);
+    config.lodConfig.simplifyFallbackFactor = opts.fallbackFactor;
+    config.lodConfig.measureHausdorffError = opts.hausdorffError;
+    config.lodConfig.tilingScheme = parseTilingScheme(opts.tiling);
     
     // 模式配置
     if (opts.mode == "geometric") {
@@ -195,10 +293,14 @@ pipeline::PipelineConfig buildPipelineConfig(const CommandLineOptions& opts) {
     // 输出配置
     config.outputDirectory = opts.outputDir;
     config.outputFormats = opts.formats;
+    config.tilesConfig.tilingScheme = config.lodConfig.tilingScheme;
     
     // 处理配置
     config.enableParallelProcessing = opts.enableParallel;
     config.maxThreads = opts.maxThreads;
+    config.simplifyCacheDirectory = opts.cacheDir;
+    config.octreeIndexPath = opts.octreeIndex;
+    config.simplifyCacheMaxBytes = static_cast<std::uintmax_t>(opts.cacheSizeMb) << 20;
     config.enableProgressReporting = opts.showProgress;
     config.enableLogging = true;
     config.logLevel = opts.verbose ? "debug" : "info";
@@ -271,6 +373,20 @@ int main(int argc, char* argv[]) {
         spdlog::info("Formats: {}", fmt::join(opts.formats, ", "));
         spdlog::info("Mode: {}", opts.mode);
         spdlog::info("Use Octree: {}", opts.useOctree ? "Yes" : "No");
+        spdlog::info("Split strategy: {}", opts.splitStrategy);
+        spdlog::info("Simplification strategy: {}", opts.strategy);
+        if (opts.looseOctree) {
+            spdlog::info("Loose octree: looseness {}", opts.looseness);
+        }
+        if (opts.bottomUp) {
+            spdlog::info("Bottom-up LOD construction");
+        }
+        if (!opts.octreeIndex.empty()) {
+            spdlog::info("Octree index: {}", opts.octreeIndex);
+        }
+        if (opts.tiling != "data") {
+            spdlog::info("Geographic tiling scheme: {}", opts.tiling);
+        }
         
         // 构建管道配置
         auto config = buildPipelineConfig(opts);
@@ -4,10 +4,264 @@
 #include <execution>
 #include <functional>
 #include <numeric>
+#include <unordered_map>
 #include <cmath>
+#include <limits>
+#include <tbb/parallel_for.h>
 
 namespace lod::core {
 
+namespace {
+    // 目标包围盒数量超过该阈值时使用均匀网格查找候选盒
+    constexpr size_t kGridBucketThreshold = 16;
+    
+    // 单遍分桶时每个并行块处理的三角形数
+    constexpr size_t kBucketBlockSize = size_t{1} << 16;
+    
+    // 目标包围盒的均匀网格索引：每个网格单元记录与之重叠的包围盒编号
+    class BoundsGrid {
+    public:
+        explicit BoundsGrid(std::span<const BoundingBox> bounds) {
+            extent_ = bounds.front();
+            for (const auto& box : bounds) {
+                extent_ = extent_.unite(box);
+            }
+            
+            const auto cubeRoot = static_cast<int>(std::ceil(std::cbrt(static_cast<double>(bounds.size()))));
+            resolution_ = std::clamp(cubeRoot * 2, 1, 64);
+            
+            const auto size = extent_.size();
+            for (int axis = 0; axis < 3; ++axis) {
+                cellSize_[axis] = size[axis] > 0.0f ? size[axis] / static_cast<float>(resolution_) : 1.0f;
+            }
+            
+            cells_.resize(static_cast<size_t>(resolution_) * resolution_ * resolution_);
+            for (size_t i = 0; i < bounds.size(); ++i) {
+                forEachCell(bounds[i], [&](size_t cell) {
+                    cells_[cell].push_back(static_cast<uint32_t>(i));
+                });
+            }
+        }
+        
+        // 遍历与查询盒重叠的所有网格单元中的包围盒编号（可能重复）
+        template<typename Fn>
+        void forEachCandidate(const BoundingBox& query, Fn&& fn) const {
+            if (!extent_.intersects(query)) {
+                return;
+            }
+            forEachCell(query, [&](size_t cell) {
+                for (const auto boxIndex : cells_[cell]) {
+                    fn(boxIndex);
+                }
+            });
+        }
+        
+    private:
+        BoundingBox extent_;
+        int resolution_{1};
+        std::array<float, 3> cellSize_{1.0f, 1.0f, 1.0f};
+        std::vector<std::vector<uint32_t>> cells_;
+        
+        int cellCoord(float value, int axis) const noexcept {
+            const auto coord = static_cast<int>(std::floor((value - extent_.min[axis]) / cellSize_[axis]));
+            return std::clamp(coord, 0, resolution_ - 1);
+        }
+        
+        template<typename Fn>
+        void forEachCell(const BoundingBox& box, Fn&& fn) const {
+            std::array<int, 3> lo{};
+            std::array<int, 3> hi{};
+            for (int axis = 0; axis < 3; ++axis) {
+                lo[axis] = cellCoord(box.min[axis], axis);
+                hi[axis] = cellCoord(box.max[axis], axis);
+            }
+            
+            for (int z = lo[2]; z <= hi[2]; ++z) {
+                for (int y = lo[1]; y <= hi[1]; ++y) {
+                    for (int x = lo[0]; x <= hi[0]; ++x) {
+                        fn((static_cast<size_t>(z) * resolution_ + y) * resolution_ + x);
+                    }
+                }
+            }
+        }
+    };
+    
+    // 取三角形的三个顶点位置
+    std::array<Vertex, 3> triangleVertices(const Mesh& mesh, Index triIdx) noexcept {
+        const auto& positions = mesh.vertices().positions;
+        const auto& indices = mesh.indices();
+        return {
+            positions[indices[triIdx * 3]],
+            positions[indices[triIdx * 3 + 1]],
+            positions[indices[triIdx * 3 + 2]]
+        };
+    }
+    
+    // 松散八叉树分配：按三角形包围盒中心选出唯一子节点，三角形完全落在该子节点的
+    // 松散包围盒内时下放，否则留在 triangles 中（即留在当前节点）
+    std::vector<std::vector<Index>> assignToLooseChildren(const Mesh& mesh, std::vector<Index>& triangles,
+                                                          std::span<const BoundingBox> childBounds,
+                                                          float looseness) {
+        std::vector<std::vector<Index>> buckets(childBounds.size());
+        std::vector<BoundingBox> looseBounds;
+        looseBounds.reserve(childBounds.size());
+        for (const auto& child : childBounds) {
+            looseBounds.push_back(child.expanded(looseness));
+        }
+        
+        std::vector<Index> kept;
+        for (const auto triIdx : triangles) {
+            const auto triBounds = computeTriangleBounds(triangleVertices(mesh, triIdx));
+            const auto center = triBounds.center();
+            
+            auto it = std::find_if(childBounds.begin(), childBounds.end(),
+                                   [&](const BoundingBox& child) { return child.contains(center); });
+            const auto childIdx = static_cast<size_t>(std::distance(childBounds.begin(), it));
+            
+            if (it != childBounds.end() && looseBounds[childIdx].containsBox(triBounds)) {
+                buckets[childIdx].push_back(triIdx);
+            } else {
+                kept.push_back(triIdx);
+            }
+        }
+        
+        triangles = std::move(kept);
+        return buckets;
+    }
+    
+    // 自底向上计算紧致包围盒，返回子树是否含有几何
+    std::optional<BoundingBox> computeTightBounds(const Mesh& mesh, OctreeNode& node) {
+        std::optional<BoundingBox> tight;
+        
+        for (const auto triIdx : node.triangleIndices) {
+            const auto triBounds = computeTriangleBounds(triangleVertices(mesh, triIdx));
+            tight = tight ? tight->unite(triBounds) : triBounds;
+        }
+        
+        for (auto& child : node.children) {
+            if (child) {
+                if (auto childTight = computeTightBounds(mesh, *child)) {
+                    tight = tight ? tight->unite(*childTight) : *childTight;
+                }
+            }
+        }
+        
+        node.tightBounds = tight.value_or(node.bounds);
+        return tight;
+    }
+    
+    // 按目标包围盒分桶：triangleAt(i) 给出第 i 个待分配三角形的编号
+    template<typename TriangleAt>
+    std::vector<std::vector<Index>> bucketTrianglesInBounds(const Mesh& mesh, size_t triangleCount,
+                                                            TriangleAt&& triangleAt,
+                                                            std::span<const BoundingBox> bounds) {
+        const size_t bucketCount = bounds.size();
+        if (bucketCount == 0 || triangleCount == 0) {
+            return std::vector<std::vector<Index>>(bucketCount);
+        }
+        
+        const auto& positions = mesh.vertices().positions;
+        const auto& indices = mesh.indices();
+        
+        std::optional<BoundsGrid> grid;
+        if (bucketCount > kGridBucketThreshold) {
+            grid.emplace(bounds);
+        }
+        
+        return bucketTriangles(triangleCount, bucketCount,
+                               [&](size_t begin, size_t end, std::vector<std::vector<Index>>& local) {
+            // 网格模式下用于去重的“最近一次访问”标记
+            std::vector<size_t> lastVisited(grid ? bucketCount : 0, std::numeric_limits<size_t>::max());
+            
+            for (size_t i = begin; i < end; ++i) {
+                const Index triIdx = triangleAt(i);
+                if (static_cast<size_t>(triIdx) * 3 + 2 >= indices.size()) {
+                    continue;
+                }
+                
+                const std::array<Vertex, 3> triangle = {
+                    positions[indices[triIdx * 3]],
+                    positions[indices[triIdx * 3 + 1]],
+                    positions[indices[triIdx * 3 + 2]]
+                };
+                
+                if (grid) {
+                    grid->forEachCandidate(computeTriangleBounds(triangle), [&](uint32_t boxIndex) {
+                        if (lastVisited[boxIndex] == i) {
+                            return;
+                        }
+                        lastVisited[boxIndex] = i;
+                        if (triangleIntersectsBounds(triangle, bounds[boxIndex])) {
+                            local[boxIndex].push_back(triIdx);
+                        }
+                    });
+                } else {
+                    for (size_t boxIndex = 0; boxIndex < bucketCount; ++boxIndex) {
+                        if (triangleIntersectsBounds(triangle, bounds[boxIndex])) {
+                            local[boxIndex].push_back(triIdx);
+                        }
+                    }
+                }
+            }
+        });
+    }
+    
+    // 盒子半表面积（SAH 代价用）
+    float halfSurfaceArea(const BoundingBox& box) noexcept {
+        auto s = box.size();
+        return s[0] * s[1] + s[1] * s[2] + s[2] * s[0];
+    }
+    
+    // 中位数划分位置（会重排输入）：取下半部分最大值与中位数的中点，避免划分面穿过同一排质心
+    float medianOf(std::vector<float>& values) {
+        auto mid = values.begin() + static_cast<std::ptrdiff_t>(values.size() / 2);
+        std::nth_element(values.begin(), mid, values.end());
+        if (mid == values.begin()) {
+            return *mid;
+        }
+        const float lowerMax = *std::max_element(values.begin(), mid);
+        return (lowerMax + *mid) * 0.5f;
+    }
+    
+    // 沿单轴用分桶 SAH 选取划分位置，两侧都必须有三角形；找不到时退化为中位数
+    float sahSplitPosition(std::vector<float>& centroids, const BoundingBox& bounds, int axis, int binCount) {
+        const float lo = bounds.min[axis];
+        const float extent = bounds.max[axis] - lo;
+        if (extent <= 0.0f || binCount < 2) {
+            return medianOf(centroids);
+        }
+        
+        std::vector<size_t> bins(static_cast<size_t>(binCount), 0);
+        for (const float c : centroids) {
+            const int bin = static_cast<int>((c - lo) / extent * static_cast<float>(binCount));
+            bins[static_cast<size_t>(std::clamp(bin, 0, binCount - 1))]++;
+        }
+        
+        size_t leftCount = 0;
+        float bestCost = std::numeric_limits<float>::max();
+        std::optional<float> bestPosition;
+        
+        for (int i = 1; i < binCount; ++i) {
+            leftCount += bins[static_cast<size_t>(i - 1)];
+            const size_t rightCount = centroids.size() - leftCount;
+            if (leftCount == 0 || rightCount == 0) {
+                continue;
+            }
+            
+            const float position = lo + extent * static_cast<float>(i) / static_cast<float>(binCount);
+            const auto halves = bounds.splitAlongAxis(axis, position);
+            const float cost = halfSurfaceArea(halves[0]) * static_cast<float>(leftCount) +
+                               halfSurfaceArea(halves[1]) * static_cast<float>(rightCount);
+            if (cost < bestCost) {
+                bestCost = cost;
+                bestPosition = position;
+            }
+        }
+        
+        return bestPosition ? *bestPosition : medianOf(centroids);
+    }
+}
+
 BoundingBox computeGeometryBoundingBox(const Mesh& mesh) noexcept {
     if (mesh.vertices.empty()) {
         return BoundingBox{{0.0f, 0.0f, 0.0f}, {0.0f, 0.0f, 0.0f}};
@@ -93,30 +347,16 @@ std::unique_ptr<OctreeNode> buildOctree(const Mesh& mesh, const OctreeConfig& co
             return;
         }
         
-        // 八叉树细分
-        auto childBounds = node.bounds.subdivide();
-        const auto& positions = mesh.vertices().positions;
-        const auto& indices = mesh.indices();
+        // 按划分策略计算子包围盒
+        const auto childBounds = computeChildBounds(mesh, node.triangleIndices, node.bounds, config);
         
-        // 为每个子节点分配三角形
-        for (int childIdx = 0; childIdx < 8; ++childIdx) {
-            std::vector<Index> childTriangles;
-            
-            for (const auto triIdx : node.triangleIndices) {
-                if (triIdx * 3 + 2 < indices.size()) {
-                    // 获取三角形的三个顶点
-                    std::array<Vertex, 3> triangle = {
-                        positions[indices[triIdx * 3]],
-                        positions[indices[triIdx * 3 + 1]],
-                        positions[indices[triIdx * 3 + 2]]
-                    };
-                    
-                    // 检查三角形是否与子包围盒相交
-                    if (triangleIntersectsBounds(triangle, childBounds[childIdx])) {
-                        childTriangles.push_back(triIdx);
-                    }
-                }
-            }
+        // 单遍为所有子节点分配三角形；松散模式下未能下放的三角形留在当前节点
+        auto childBuckets = config.looseOctree
+            ? assignToLooseChildren(mesh, node.triangleIndices, childBounds, config.looseness)
+            : bucketTrianglesByBounds(mesh, node.triangleIndices, childBounds);
+        
+        for (size_t childIdx = 0; childIdx < childBounds.size(); ++childIdx) {
+            auto& childTriangles = childBuckets[childIdx];
             
             // 如果子节点包含三角形，创建子节点
             if (!childTriangles.empty()) {
@@ -135,16 +375,17 @@ std::unique_ptr<OctreeNode> buildOctree(const Mesh& mesh, const OctreeConfig& co
         // 如果成功创建了子节点，清空父节点的三角形列表（避免重复）
         bool hasChildren = std::any_of(node.children.begin(), node.children.end(),
                                       [](const auto& child) { return child != nullptr; });
-        if (hasChildren) {
+        if (hasChildren && !config.looseOctree) {
             node.triangleIndices.clear();
         }
     };
     
     subdivideNode(*root);
+    computeTightBounds(mesh, *root);
     return root;
 }
 
-std::shared_ptr<GeometricLodNode> buildGeometricLod(const Mesh& mesh, const OctreeConfig& octreeConfig) {
+std::shared_ptr<GeometricLodNode> buildGeometricLod(const Mesh& mesh, const OctreeConfig& octreeConfig, bool parallel) {
     if (mesh.empty()) {
         return nullptr;
     }
@@ -154,85 +395,163 @@ std::shared_ptr<GeometricLodNode> buildGeometricLod(const Mesh& mesh, const Octr
         return nullptr;
     }
     
-    auto root = std::make_shared<GeometricLodNode>();
-    root->bounds = octree->bounds;
-    root->mesh = mesh;
-    root->lodLevel = 0;
-    root->geometricError = 0.0;
+    return buildGeometricLod(mesh, *octree, parallel);
+}
+
+std::shared_ptr<GeometricLodNode> buildGeometricLod(const Mesh& mesh, const OctreeNode& octree, bool parallel) {
+    if (mesh.empty()) {
+        return nullptr;
+    }
+    
+    // 先序编号：每个子树占据连续的编号区间 [first, last)，三角形记录其归属节点的编号
+    constexpr size_t kUnowned = std::numeric_limits<size_t>::max();
+    std::unordered_map<const OctreeNode*, std::pair<size_t, size_t>> spans;
+    std::vector<size_t> owner(mesh.triangleCount(), kUnowned);
+    size_t counter = 0;
+    std::function<void(const OctreeNode&)> number = [&](const OctreeNode& node) {
+        const size_t first = counter++;
+        for (const auto triangle : node.triangleIndices) {
+            if (owner[triangle] == kUnowned) {
+                owner[triangle] = first;
+            }
+        }
+        for (const auto& child : node.children) {
+            if (child) {
+                number(*child);
+            }
+        }
+        spans[&node] = {first, counter};
+    };
+    number(octree);
+    
+    std::vector<Index> rootTriangles;
+    for (size_t t = 0; t < owner.size(); ++t) {
+        if (owner[t] != kUnowned) {
+            rootTriangles.push_back(static_cast<Index>(t));
+        }
+    }
     
-    // 从八叉树构建 LOD 层次结构的递归函数
-    std::function<std::shared_ptr<GeometricLodNode>(const OctreeNode&, int)> buildLodFromOctree;
+    // 从八叉树构建 LOD 层次结构的递归函数：节点持有子树内全部三角形，
+    // 按归属编号划分给子节点（保持升序），每层只扫描一遍，无需遍历子树或去重
+    std::function<std::shared_ptr<GeometricLodNode>(const OctreeNode&, const std::vector<Index>&, int)> buildLodFromOctree;
     
-    buildLodFromOctree = [&](const OctreeNode& octreeNode, int lodLevel) -> std::shared_ptr<GeometricLodNode> {
+    buildLodFromOctree = [&](const OctreeNode& octreeNode, const std::vector<Index>& triangles,
+                             int lodLevel) -> std::shared_ptr<GeometricLodNode> {
         auto lodNode = std::make_shared<GeometricLodNode>();
-        lodNode->bounds = octreeNode.bounds;
+        lodNode->bounds = octreeNode.tightBounds;
         lodNode->lodLevel = lodLevel;
-        
-        // 如果是叶节点，创建网格
+        if (!triangles.empty()) {
+            lodNode->mesh = mesh.subset(triangles);
+        }
         if (octreeNode.isLeaf()) {
-            if (!octreeNode.triangleIndices.empty()) {
-                lodNode->mesh = mesh.subset(octreeNode.triangleIndices);
-            }
-        } else {
-            // 为非叶节点创建简化网格
-            std::vector<Index> allTriangles;
-            octreeNode.traverse([&](const OctreeNode& node) {
-                if (node.isLeaf()) {
-                    allTriangles.insert(allTriangles.end(), 
-                                       node.triangleIndices.begin(), 
-                                       node.triangleIndices.end());
+            return lodNode;
+        }
+        
+        // 松散模式下内部节点自身归属的三角形不再下放
+        std::vector<std::vector<Index>> childTriangles(octreeNode.children.size());
+        for (const auto triangle : triangles) {
+            const size_t order = owner[triangle];
+            for (size_t i = 0; i < octreeNode.children.size(); ++i) {
+                const auto& child = octreeNode.children[i];
+                if (!child) {
+                    continue;
                 }
-            });
-            
-            if (!allTriangles.empty()) {
-                lodNode->mesh = mesh.subset(allTriangles);
-            }
-            
-            // 递归创建子节点
-            for (const auto& child : octreeNode.children) {
-                if (child) {
-                    auto childLodNode = buildLodFromOctree(*child, lodLevel + 1);
-                    if (childLodNode && !childLodNode->mesh.empty()) {
-                        lodNode->children.push_back(childLodNode);
-                    }
+                const auto [first, last] = spans.at(child.get());
+                if (order >= first && order < last) {
+                    childTriangles[i].push_back(triangle);
+                    break;
                 }
             }
         }
         
+        // 递归创建子节点（子树之间互不依赖），保持子节点顺序
+        std::vector<std::shared_ptr<GeometricLodNode>> children(octreeNode.children.size());
+        forEachChild(octreeNode.children.size(), parallel, [&](size_t i) {
+            if (const auto& child = octreeNode.children[i]; child && !childTriangles[i].empty()) {
+                children[i] = buildLodFromOctree(*child, childTriangles[i], lodLevel + 1);
+            }
+        });
+        std::erase(children, nullptr);
+        lodNode->children = std::move(children);
         return lodNode;
     };
     
-    return buildLodFromOctree(*octree, 0);
+    return buildLodFromOctree(octree, rootTriangles, 0);
 }
 
-std::vector<std::pair<Mesh, BoundingBox>> splitMeshByBounds(const Mesh& mesh, const std::vector<BoundingBox>& bounds) {
-    std::vector<std::pair<Mesh, BoundingBox>> results;
-    results.reserve(bounds.size());
+void forEachChild(size_t count, bool parallel, const std::function<void(size_t)>& fn) {
+    if (parallel && count > 1) {
+        tbb::parallel_for(size_t{0}, count, [&](size_t i) { fn(i); });
+    } else {
+        for (size_t i = 0; i < count; ++i) {
+            fn(i);
+        }
+    }
+}
+
+std::vector<std::vector<Index>> bucketTriangles(size_t triangleCount, size_t bucketCount,
+                                                const TriangleBlockAssign& assignBlock) {
+    std::vector<std::vector<Index>> buckets(bucketCount);
+    if (bucketCount == 0 || triangleCount == 0) {
+        return buckets;
+    }
     
-    const auto& positions = mesh.vertices().positions;
-    const auto& indices = mesh.indices();
+    // 按固定块并行扫描，块内结果按原顺序拼接，输出与串行一致
+    const size_t blockCount = (triangleCount + kBucketBlockSize - 1) / kBucketBlockSize;
+    std::vector<std::vector<std::vector<Index>>> blockBuckets(blockCount);
     
-    for (const auto& bound : bounds) {
-        std::vector<Index> triangleIndices;
-        
-        // 找到与此包围盒相交的所有三角形
-        for (size_t i = 0; i < mesh.triangleCount(); ++i) {
-            if (i * 3 + 2 < indices.size()) {
-                std::array<Vertex, 3> triangle = {
-                    positions[indices[i * 3]],
-                    positions[indices[i * 3 + 1]],
-                    positions[indices[i * 3 + 2]]
-                };
-                
-                if (triangleIntersectsBounds(triangle, bound)) {
-                    triangleIndices.push_back(static_cast<Index>(i));
-                }
-            }
+    tbb::parallel_for(size_t{0}, blockCount, [&](size_t block) {
+        auto& local = blockBuckets[block];
+        local.resize(bucketCount);
+        const size_t begin = block * kBucketBlockSize;
+        assignBlock(begin, std::min(begin + kBucketBlockSize, triangleCount), local);
+    });
+    
+    tbb::parallel_for(size_t{0}, bucketCount, [&](size_t b) {
+        size_t total = 0;
+        for (const auto& local : blockBuckets) {
+            total += local[b].size();
         }
         
-        if (!triangleIndices.empty()) {
-            auto subMesh = mesh.subset(triangleIndices);
-            results.emplace_back(std::move(subMesh), bound);
+        auto& bucket = buckets[b];
+        bucket.reserve(total);
+        for (const auto& local : blockBuckets) {
+            bucket.insert(bucket.end(), local[b].begin(), local[b].end());
+        }
+    });
+    
+    return buckets;
+}
+
+std::vector<std::vector<Index>> bucketTrianglesByBounds(const Mesh& mesh, std::span<const BoundingBox> bounds) {
+    return bucketTrianglesInBounds(mesh, mesh.triangleCount(),
+                                   [](size_t i) { return static_cast<Index>(i); }, bounds);
+}
+
+std::vector<std::vector<Index>> bucketTrianglesByBounds(const Mesh& mesh, std::span<const Index> triangles,
+                                                        std::span<const BoundingBox> bounds) {
+    return bucketTrianglesInBounds(mesh, triangles.size(),
+                                   [triangles](size_t i) { return triangles[i]; }, bounds);
+}
+
+std::vector<std::pair<Mesh, BoundingBox>> splitMeshByBounds(const Mesh& mesh, const std::vector<BoundingBox>& bounds) {
+    // 单遍把三角形分配到所有目标盒
+    const auto buckets = bucketTrianglesByBounds(mesh, bounds);
+    
+    // 一次并行提取全部子网格
+    std::vector<Mesh> subMeshes(bounds.size());
+    tbb::parallel_for(size_t{0}, bounds.size(), [&](size_t i) {
+        if (!buckets[i].empty()) {
+            subMeshes[i] = mesh.subset(buckets[i]);
+        }
+    });
+    
+    std::vector<std::pair<Mesh, BoundingBox>> results;
+    results.reserve(bounds.size());
+    
+    for (size_t i = 0; i < bounds.size(); ++i) {
+        if (!buckets[i].empty()) {
+            results.emplace_back(std::move(subMeshes[i]), bounds[i]);
         }
     }
     
@@ -260,9 +579,131 @@ OctreeStats computeOctreeStats(const OctreeNode& root) noexcept {
         stats.nodesPerLevel[node.depth]++;
     });
     
+    // 叶节点三角形数分布
+    std::vector<size_t> leafSizes;
+    leafSizes.reserve(stats.leafNodes);
+    root.traverse([&](const OctreeNode& node) {
+        if (node.isLeaf()) {
+            leafSizes.push_back(node.triangleIndices.size());
+        }
+    });
+    
+    if (!leafSizes.empty()) {
+        const auto [minIt, maxIt] = std::minmax_element(leafSizes.begin(), leafSizes.end());
+        stats.minLeafTriangles = *minIt;
+        stats.maxLeafTriangles = *maxIt;
+        
+        const double count = static_cast<double>(leafSizes.size());
+        stats.meanLeafTriangles = std::accumulate(leafSizes.begin(), leafSizes.end(), 0.0) / count;
+        
+        double sumSquares = 0.0;
+        for (const auto size : leafSizes) {
+            const double diff = static_cast<double>(size) - stats.meanLeafTriangles;
+            sumSquares += diff * diff;
+        }
+        stats.leafTriangleVariance = sumSquares / count;
+    }
+    
     return stats;
 }
 
+std::array<float, 3> computeSplitPoint(const Mesh& mesh, std::span<const Index> triangles,
+                                       const BoundingBox& bounds, SplitStrategy strategy, int sahBinCount) {
+    if (strategy == SplitStrategy::Center || triangles.empty()) {
+        return bounds.center();
+    }
+    
+    const auto& positions = mesh.vertices().positions;
+    const auto& indices = mesh.indices();
+    
+    // 按轴分别收集三角形质心
+    std::array<std::vector<float>, 3> centroids;
+    for (auto& axisValues : centroids) {
+        axisValues.reserve(triangles.size());
+    }
+    
+    for (const auto triIdx : triangles) {
+        if (static_cast<size_t>(triIdx) * 3 + 2 >= indices.size()) {
+            continue;
+        }
+        
+        const auto& v0 = positions[indices[triIdx * 3]];
+        const auto& v1 = positions[indices[triIdx * 3 + 1]];
+        const auto& v2 = positions[indices[triIdx * 3 + 2]];
+        
+        for (int axis = 0; axis < 3; ++axis) {
+            centroids[axis].push_back((v0[axis] + v1[axis] + v2[axis]) / 3.0f);
+        }
+    }
+    
+    if (centroids[0].empty()) {
+        return bounds.center();
+    }
+    
+    std::array<float, 3> split{};
+    for (int axis = 0; axis < 3; ++axis) {
+        split[axis] = strategy == SplitStrategy::SurfaceAreaHeuristic
+            ? sahSplitPosition(centroids[axis], bounds, axis, sahBinCount)
+            : medianOf(centroids[axis]);
+    }
+    
+    return split;
+}
+
+std::vector<BoundingBox> computeChildBounds(const Mesh& mesh, std::span<const Index> triangles,
+                                            const BoundingBox& bounds, const OctreeConfig& config) {
+    std::vector<BoundingBox> childBounds;
+    
+    if (config.splitStrategy == SplitStrategy::KdLongestAxis) {
+        const int axis = bounds.longestAxis();
+        const auto split = computeSplitPoint(mesh, triangles, bounds, SplitStrategy::Median);
+        const auto halves = bounds.splitAlongAxis(axis, split[axis]);
+        childBounds.assign(halves.begin(), halves.end());
+    } else {
+        const auto split = computeSplitPoint(mesh, triangles, bounds, config.splitStrategy, config.sahBinCount);
+        const auto octants = bounds.subdivide(split);
+        childBounds.assign(octants.begin(), octants.end());
+    }
+    
+    return childBounds;
+}
+
+std::vector<SplitStrategyComparison> compareSplitStrategies(const Mesh& mesh, const OctreeConfig& config) {
+    constexpr std::array strategies{
+        SplitStrategy::Center,
+        SplitStrategy::Median,
+        SplitStrategy::SurfaceAreaHeuristic,
+        SplitStrategy::KdLongestAxis
+    };
+    
+    std::vector<SplitStrategyComparison> results;
+    results.reserve(strategies.size());
+    
+    for (const auto strategy : strategies) {
+        auto strategyConfig = config;
+        strategyConfig.splitStrategy = strategy;
+        
+        SplitStrategyComparison comparison;
+        comparison.strategy = strategy;
+        if (auto octree = buildOctree(mesh, strategyConfig)) {
+            comparison.stats = computeOctreeStats(*octree);
+        }
+        results.push_back(std::move(comparison));
+    }
+    
+    return results;
+}
+
+std::string_view splitStrategyName(SplitStrategy strategy) noexcept {
+    switch (strategy) {
+        case SplitStrategy::Center:               return "center";
+        case SplitStrategy::Median:               return "median";
+        case SplitStrategy::SurfaceAreaHeuristic: return "sah";
+        case SplitStrategy::KdLongestAxis:        return "kd";
+    }
+    return "unknown";
+}
+
 std::expected<std::vector<Octree>, std::string> 
 buildOctree(const Mesh& mesh, int maxDepth, size_t maxTrianglesPerNode) {
     if (mesh.vertices.empty() || mesh.indices.empty()) {
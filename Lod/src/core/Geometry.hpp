@@ -1,10 +1,14 @@
 #pragma once
 
 #include "Mesh.hpp"
+#include <algorithm>
 #include <array>
+#include <functional>
 #include <vector>
 #include <memory>
 #include <optional>
+#include <span>
+#include <string_view>
 
 namespace lod::core {
 
@@ -55,6 +59,23 @@ struct BoundingBox {
         };
     }
     
+    constexpr bool containsBox(const BoundingBox& other) const noexcept {
+        return contains(other.min) && contains(other.max);
+    }
+    
+    // 以中心为基准按比例缩放（松散八叉树的松散包围盒）
+    constexpr BoundingBox expanded(float factor) const noexcept {
+        const auto c = center();
+        const auto s = size();
+        BoundingBox result;
+        for (int i = 0; i < 3; ++i) {
+            const float half = s[i] * 0.5f * factor;
+            result.min[i] = c[i] - half;
+            result.max[i] = c[i] + half;
+        }
+        return result;
+    }
+    
     constexpr BoundingBox unite(const BoundingBox& other) const noexcept {
         return BoundingBox{
             {std::min(min[0], other.min[0]), std::min(min[1], other.min[1]), std::min(min[2], other.min[2])},
@@ -62,9 +83,25 @@ struct BoundingBox {
         };
     }
     
-    // 八叉树分割
+    // 最长轴（0=x, 1=y, 2=z）
+    constexpr int longestAxis() const noexcept {
+        auto s = size();
+        if (s[0] >= s[1] && s[0] >= s[2]) return 0;
+        return s[1] >= s[2] ? 1 : 2;
+    }
+    
+    // 八叉树分割（几何中心）
     constexpr std::array<BoundingBox, 8> subdivide() const noexcept {
-        auto c = center();
+        return subdivide(center());
+    }
+    
+    // 八叉树分割（指定划分点，越界时夹取到包围盒内）
+    constexpr std::array<BoundingBox, 8> subdivide(const std::array<float, 3>& splitPoint) const noexcept {
+        const std::array<float, 3> c{
+            std::clamp(splitPoint[0], min[0], max[0]),
+            std::clamp(splitPoint[1], min[1], max[1]),
+            std::clamp(splitPoint[2], min[2], max[2])
+        };
         
         return {{
             // 下层 4 个子节点
@@ -80,12 +117,23 @@ struct BoundingBox {
             {c, max}                                                     // 111: 右上后
         }};
     }
+    
+    // KD 树分割：沿指定轴在 position 处一分为二
+    constexpr std::array<BoundingBox, 2> splitAlongAxis(int axis, float position) const noexcept {
+        const float p = std::clamp(position, min[axis], max[axis]);
+        BoundingBox lower{min, max};
+        BoundingBox upper{min, max};
+        lower.max[axis] = p;
+        upper.min[axis] = p;
+        return {{lower, upper}};
+    }
 };
 
 // 八叉树节点
 struct OctreeNode {
     BoundingBox bounds;
-    std::vector<Index> triangleIndices;  // 该节点包含的三角形索引
+    BoundingBox tightBounds;             // 子树内实际几何的紧致包围盒
+    std::vector<Index> triangleIndices;  // 该节点包含的三角形索引（松散模式下内部节点也可持有）
     std::array<std::unique_ptr<OctreeNode>, 8> children;
     int depth{0};
     
@@ -122,12 +170,27 @@ struct OctreeNode {
     }
 };
 
+// 空间划分策略
+enum class SplitStrategy {
+    Center,                // 几何中心（经典八叉树）
+    Median,                // 三角形质心中位数
+    SurfaceAreaHeuristic,  // SAH 代价最小的划分面
+    KdLongestAxis          // KD 树：沿最长轴在质心中位数处二分
+};
+
 // 八叉树构建配置
 struct OctreeConfig {
     size_t maxTrianglesPerNode{1000};     // 每个节点最大三角形数
     int maxDepth{8};                      // 最大深度
     float minNodeSize{0.001f};            // 最小节点尺寸
     bool enableAdaptiveSubdivision{true}; // 自适应细分
+    SplitStrategy splitStrategy{SplitStrategy::Center};  // 划分策略
+    int sahBinCount{16};                  // SAH 每轴分桶数
+    
+    // 松散八叉树：子节点包围盒按 looseness 放大，每个三角形只归属于
+    // 松散包围盒能完全容纳它的最深节点，不再复制跨界三角形
+    bool looseOctree{false};
+    float looseness{2.0f};
 };
 
 // 几何 LOD 节点（用于非地理坐标情况）
@@ -159,9 +222,17 @@ struct GeometricLodNode {
 [[nodiscard]] std::unique_ptr<OctreeNode> 
 buildOctree(const Mesh& mesh, const OctreeConfig& config = {});
 
-// 纯函数：从八叉树构建几何 LOD
+// 纯函数：从八叉树构建几何 LOD；parallel 为 false 时兄弟子树串行构建
+[[nodiscard]] std::shared_ptr<GeometricLodNode>
+buildGeometricLod(const Mesh& mesh, const OctreeConfig& octreeConfig = {}, bool parallel = true);
+
+// 纯函数：从已有八叉树构建几何 LOD（八叉树的三角形编号指向 mesh）。
+// 跨界复制的三角形只归属先序遍历中第一个包含它的节点，各节点的三角形由父节点逐层划分而来
 [[nodiscard]] std::shared_ptr<GeometricLodNode>
-buildGeometricLod(const Mesh& mesh, const OctreeConfig& octreeConfig = {});
+buildGeometricLod(const Mesh& mesh, const OctreeNode& octree, bool parallel = true);
+
+// 对 [0, count) 逐个调用 fn；parallel 为 true 时用 TBB 并行，嵌套调用由 TBB 调度为任务树
+void forEachChild(size_t count, bool parallel, const std::function<void(size_t)>& fn);
 
 // 纯函数：判断三角形是否与包围盒相交
 [[nodiscard]] bool triangleIntersectsBounds(
@@ -171,10 +242,39 @@ buildGeometricLod(const Mesh& mesh, const OctreeConfig& octreeConfig = {});
 // 纯函数：计算三角形的包围盒
 [[nodiscard]] BoundingBox computeTriangleBounds(const std::array<Vertex, 3>& triangle) noexcept;
 
-// 纯函数：根据包围盒分割网格
+// 分桶回调：把第 [begin, end) 个待分配三角形放入它们各自所属的桶（可放入多个桶）
+using TriangleBlockAssign =
+    std::function<void(size_t begin, size_t end, std::vector<std::vector<Index>>& buckets)>;
+
+// 纯函数：单遍并行分桶。按固定大小的块并行调用 assignBlock，每块写入自己的局部桶，
+// 块内结果按原顺序拼接，输出与串行一致；块内的临时状态由回调自行持有
+[[nodiscard]] std::vector<std::vector<Index>>
+bucketTriangles(size_t triangleCount, size_t bucketCount, const TriangleBlockAssign& assignBlock);
+
+// 纯函数：单遍把三角形分配到所有目标包围盒（跨界三角形进入每个相交的盒），
+// 目标盒较多时使用均匀网格查找；返回每个盒对应的三角形编号
+[[nodiscard]] std::vector<std::vector<Index>>
+bucketTrianglesByBounds(const Mesh& mesh, std::span<const BoundingBox> bounds);
+
+// 纯函数：同上，只分配给定的三角形子集
+[[nodiscard]] std::vector<std::vector<Index>>
+bucketTrianglesByBounds(const Mesh& mesh, std::span<const Index> triangles,
+                        std::span<const BoundingBox> bounds);
+
+// 纯函数：根据包围盒分割网格（单遍分桶 + 并行提取子网格，只返回非空结果）
 [[nodiscard]] std::vector<std::pair<Mesh, BoundingBox>>
 splitMeshByBounds(const Mesh& mesh, const std::vector<BoundingBox>& bounds);
 
+// 纯函数：按策略计算节点的划分点
+[[nodiscard]] std::array<float, 3>
+computeSplitPoint(const Mesh& mesh, std::span<const Index> triangles,
+                  const BoundingBox& bounds, SplitStrategy strategy, int sahBinCount = 16);
+
+// 纯函数：按配置的划分策略生成子包围盒（八叉树 8 个，KD 模式 2 个）
+[[nodiscard]] std::vector<BoundingBox>
+computeChildBounds(const Mesh& mesh, std::span<const Index> triangles,
+                   const BoundingBox& bounds, const OctreeConfig& config);
+
 // 纯函数：计算八叉树统计信息
 struct OctreeStats {
     size_t totalNodes{0};
@@ -183,8 +283,27 @@ struct OctreeStats {
     int maxDepth{0};
     std::vector<size_t> trianglesPerLevel;
     std::vector<size_t> nodesPerLevel;
+    
+    // 叶节点三角形数分布（衡量划分是否均衡）
+    size_t minLeafTriangles{0};
+    size_t maxLeafTriangles{0};
+    double meanLeafTriangles{0.0};
+    double leafTriangleVariance{0.0};
 };
 
 [[nodiscard]] OctreeStats computeOctreeStats(const OctreeNode& root) noexcept;
 
+// 各划分策略的八叉树统计对比
+struct SplitStrategyComparison {
+    SplitStrategy strategy{SplitStrategy::Center};
+    OctreeStats stats;
+};
+
+// 纯函数：用同一配置分别以每种策略建树并返回统计
+[[nodiscard]] std::vector<SplitStrategyComparison>
+compareSplitStrategies(const Mesh& mesh, const OctreeConfig& config = {});
+
+// 辅助函数：策略名称
+[[nodiscard]] std::string_view splitStrategyName(SplitStrategy strategy) noexcept;
+
 } // namespace lod::core 
\ No newline at end of file
@@ -1,10 +1,19 @@
 #include "LodAlgorithm.hpp"
+#include "LodTable.hpp"
+#include "MeshDistance.hpp"
+#include "QemSimplifier.hpp"
 #include "core/Geometry.hpp"
 #include <meshoptimizer.h>
+#include <tbb/parallel_for.h>
+#include <tbb/parallel_reduce.h>
 #include <algorithm>
 #include <execution>
 #include <cmath>
+#include <limits>
 #include <numeric>
+#include <unordered_map>
+#include <array>
+#include <map>
 
 namespace lod::core {
 
@@ -15,22 +24,18 @@ size_t TriangleCountStrategy::targetTriangleCount(const Mesh& mesh, int lodLevel
     return std::max(targetCount, static_cast<size_t>(100)); // 至少保留100个三角形
 }
 
-double TriangleCountStrategy::computeGeometricError(const Mesh& original, const Mesh& simplified) const {
-    // 简化的几何误差计算：基于三角形数量比例
-    if (original.triangleCount() == 0) {
-        return 0.0;
-    }
-    
-    double reductionRatio = 1.0 - static_cast<double>(simplified.triangleCount()) / original.triangleCount();
-    return reductionRatio * 100.0; // 将比例转换为误差值
+SimplifyOptions TriangleCountStrategy::simplifyOptions(const Mesh& mesh, int lodLevel) const {
+    auto options = ILodStrategy::simplifyOptions(mesh, lodLevel);
+    options.attributeWeights = attributeWeights_;
+    return options;
 }
 
 bool TriangleCountStrategy::shouldSubdivide(const Mesh& mesh, const geo::GeoBBox& region, int currentLevel) const {
     return mesh.triangleCount() > maxTrianglesPerTile_ && currentLevel < 8;
 }
 
-bool TriangleCountStrategy::shouldSubdivide(const Mesh& mesh, const BoundingBox& bounds, int currentLevel) const {
-    return mesh.triangleCount() > maxTrianglesPerTile_ && currentLevel < 8;
+bool TriangleCountStrategy::shouldSubdivide(size_t triangleCount, const BoundingBox&, int currentLevel) const {
+    return triangleCount > maxTrianglesPerTile_ && currentLevel < 8;
 }
 
 // ScreenSpaceErrorStrategy 实现
@@ -42,34 +47,19 @@ size_t ScreenSpaceErrorStrategy::targetTriangleCount(const Mesh& mesh, int lodLe
     return std::max(targetCount, static_cast<size_t>(50));
 }
 
-double ScreenSpaceErrorStrategy::computeGeometricError(const Mesh& original, const Mesh& simplified) const {
-    // 基于屏幕空间误差的计算
-    if (original.triangleCount() == 0) {
-        return 0.0;
-    }
-    
-    auto originalBounds = computeBoundingBox(original);
-    auto simplifiedBounds = computeBoundingBox(simplified);
-    
-    // 计算包围盒大小差异
-    auto originalSize = originalBounds.size();
-    auto simplifiedSize = simplifiedBounds.size();
-    
-    double maxDiff = 0.0;
-    for (int i = 0; i < 3; ++i) {
-        maxDiff = std::max(maxDiff, std::abs(originalSize[i] - simplifiedSize[i]));
-    }
-    
-    return maxDiff * maxScreenSpaceError_;
+SimplifyOptions ScreenSpaceErrorStrategy::simplifyOptions(const Mesh& mesh, int lodLevel) const {
+    auto options = ILodStrategy::simplifyOptions(mesh, lodLevel);
+    options.attributeWeights = attributeWeights_;
+    return options;
 }
 
 bool ScreenSpaceErrorStrategy::shouldSubdivide(const Mesh& mesh, const geo::GeoBBox& region, int currentLevel) const {
-    // 基于地理区域大小决定是否细分
-    double regionSize = std::max(region.width(), region.height());
-    return regionSize > 0.01 && currentLevel < 10; // 0.01度约为1km
+    // 按椭球面上的实际尺寸决定是否细分：同样的经度跨度在高纬度地区要窄得多
+    const double regionSize = std::max(geo::widthMeters(region), geo::heightMeters(region));
+    return regionSize > 1000.0 && currentLevel < 10;
 }
 
-bool ScreenSpaceErrorStrategy::shouldSubdivide(const Mesh& mesh, const BoundingBox& bounds, int currentLevel) const {
+bool ScreenSpaceErrorStrategy::shouldSubdivide(size_t, const BoundingBox& bounds, int currentLevel) const {
     // 基于几何大小决定是否细分
     auto size = bounds.size();
     double maxSize = std::max({size[0], size[1], size[2]});
@@ -83,76 +73,537 @@ size_t VolumeBasedStrategy::targetTriangleCount(const Mesh& mesh, int lodLevel)
     return std::max(targetCount, static_cast<size_t>(10));
 }
 
-double VolumeBasedStrategy::computeGeometricError(const Mesh& original, const Mesh& simplified) const {
-    // 基于体积变化的误差计算
-    auto originalBounds = computeBoundingBox(original);
-    auto simplifiedBounds = computeBoundingBox(simplified);
-    
-    double originalVolume = originalBounds.volume();
-    double simplifiedVolume = simplifiedBounds.volume();
-    
-    if (originalVolume == 0.0) {
-        return 0.0;
-    }
-    
-    return std::abs(originalVolume - simplifiedVolume) / originalVolume * 100.0;
-}
-
 bool VolumeBasedStrategy::shouldSubdivide(const Mesh& mesh, const geo::GeoBBox& region, int currentLevel) const {
     // 地理模式下不使用体积策略
     return false;
 }
 
-bool VolumeBasedStrategy::shouldSubdivide(const Mesh& mesh, const BoundingBox& bounds, int currentLevel) const {
+bool VolumeBasedStrategy::shouldSubdivide(size_t, const BoundingBox& bounds, int currentLevel) const {
     return bounds.volume() > minVolumeThreshold_ && currentLevel < 8;
 }
 
-// 网格简化函数
-Mesh simplifyMesh(const Mesh& mesh, size_t targetTriangleCount) noexcept {
-    if (mesh.empty() || mesh.triangleCount() <= targetTriangleCount) {
-        return mesh;
+// TargetErrorStrategy 实现
+double TargetErrorStrategy::pixelErrorAt(int lodLevel) const noexcept {
+    if (pixelErrorPerLevel_.empty()) {
+        return 1.0;
     }
+    const auto level = std::clamp<size_t>(static_cast<size_t>(std::max(lodLevel, 0)), 0, pixelErrorPerLevel_.size() - 1);
+    return pixelErrorPerLevel_[level];
+}
+
+size_t TargetErrorStrategy::targetTriangleCount(const Mesh&, int) const {
+    return 0;
+}
+
+SimplifyOptions TargetErrorStrategy::simplifyOptions(const Mesh&, int lodLevel) const {
+    SimplifyOptions options;
+    options.targetTriangleCount = 0;
+    options.attributeWeights = attributeWeights_;
     
+    // 简化器的误差相对于网格尺寸：节点以 tileScreenSize 像素显示时，世界单位容差 / 节点尺寸 = 像素预算 / 显示尺寸
+    options.targetError = tileScreenSize_ > 0.0 ? static_cast<float>(pixelErrorAt(lodLevel) / tileScreenSize_) : 0.0f;
+    return options;
+}
+
+bool TargetErrorStrategy::shouldSubdivide(const Mesh& mesh, const geo::GeoBBox&, int currentLevel) const {
+    return mesh.triangleCount() > maxTrianglesPerTile_ &&
+           currentLevel < static_cast<int>(pixelErrorPerLevel_.size());
+}
+
+bool TargetErrorStrategy::shouldSubdivide(size_t triangleCount, const BoundingBox&, int currentLevel) const {
+    return triangleCount > maxTrianglesPerTile_ &&
+           currentLevel < static_cast<int>(pixelErrorPerLevel_.size());
+}
+
+namespace {
+    // 按重映射表收集单个属性流；缺失的属性流保持为空
+    template<typename T>
+    std::vector<T> remapStream(const std::vector<T>& stream, std::span<const unsigned int> remap, size_t uniqueCount) {
+        if (stream.size() != remap.size()) {
+            return {};
+        }
+        std::vector<T> result(uniqueCount);
+        meshopt_remapVertexBuffer(result.data(), stream.data(), stream.size(), sizeof(T), remap.data());
+        return result;
+    }
+    
+    // 单遍并行分桶（见 bucketTriangles）：assign(tri, buckets) 把三角形编号放入它触及的桶，
+    // 之后一次并行提取全部子网格，空桶对应空网格
+    template<typename Assign>
+    std::vector<Mesh> splitByBuckets(const Mesh& mesh, size_t bucketCount, Assign&& assign) {
+        const auto buckets = bucketTriangles(mesh.triangleCount(), bucketCount,
+                                             [&](size_t begin, size_t end, std::vector<std::vector<Index>>& local) {
+            for (size_t tri = begin; tri < end; ++tri) {
+                assign(tri, local);
+            }
+        });
+        
+        std::vector<Mesh> subMeshes(bucketCount);
+        tbb::parallel_for(size_t{0}, bucketCount, [&](size_t b) {
+            if (!buckets[b].empty()) {
+                subMeshes[b] = mesh.subset(buckets[b]);
+            }
+        });
+        return subMeshes;
+    }
+    
+    // 节点几何误差：简化器误差，按需与采样 Hausdorff 距离取较大值
+    double measureNodeError(const Mesh& source, const SimplifyResult& result, const LodConfig& config) {
+        double error = result.error;
+        if (config.measureHausdorffError && !result.mesh.empty()) {
+            error = std::max(error, sampledHausdorffDistance(result.mesh, TriangleBvh(source), config.hausdorffSamples));
+        }
+        return error;
+    }
+    
+    std::variant<geo::GeoBBox, BoundingBox> nodeBounds(const GeoLodNode& node) { return node.region; }
+    std::variant<geo::GeoBBox, BoundingBox> nodeBounds(const GeometricLodNode& node) { return node.bounds; }
+    
+    // 通知调用方该节点走了 sloppy 回退路径
+    template<typename Node>
+    void reportFallback(const Node& node, const SimplifyOptions& options, const SimplifyResult& result,
+                        const LodConfig& config) {
+        if (!result.usedFallback || !config.onSimplifyFallback) {
+            return;
+        }
+        config.onSimplifyFallback(SimplifyFallbackEvent{
+            node.lodLevel, nodeBounds(node), options.targetTriangleCount,
+            result.topologyTriangleCount, result.mesh.triangleCount()
+        });
+    }
+    
+    const ISimplifier& simplifierFor(const LodConfig& config) {
+        static const MeshoptSimplifier defaultSimplifier;
+        if (config.simplifier) {
+            return *config.simplifier;
+        }
+        return defaultSimplifier;
+    }
+    
+    // 简化子节点网格：按边界处理方式锁定单元格面，误差取自简化器（世界单位）；
+    // 地理模式没有三维单元格，退化为锁定子网格的开放边界
+    template<typename Node>
+    void simplifyChildNode(Node& child, const Mesh& subMesh, const std::optional<BoundingBox>& cell,
+                           const LodConfig& config) {
+        auto options = config.strategy->simplifyOptions(subMesh, child.lodLevel);
+        options.fallbackFactor = config.simplifyFallbackFactor;
+        if (config.borderMode == BorderMode::LockCellFaces) {
+            if (cell) {
+                options.lockCellFaces = cell;
+            } else {
+                options.lockBorder = true;
+            }
+        }
+        
+        auto simplified = simplifierFor(config).simplify(subMesh, options);
+        reportFallback(child, options, simplified, config);
+        child.geometricError = measureNodeError(subMesh, simplified, config);
+        child.mesh = std::move(simplified.mesh);
+    }
+    
+    template<typename Node>
+    void collectNodes(Node& node, std::vector<Node*>& nodes) {
+        nodes.push_back(&node);
+        for (const auto& child : node.children) {
+            collectNodes(*child, nodes);
+        }
+    }
+    
+    // 裙边模式：树构建完成后逐节点并行添加裙边（子节点由父节点网格切分而来，不能提前添加）
+    template<typename Node>
+    void applySkirts(Node& root, const LodConfig& config) {
+        if (config.borderMode != BorderMode::Skirts) {
+            return;
+        }
+        
+        std::vector<Node*> nodes;
+        collectNodes(root, nodes);
+        forEachChild(nodes.size(), config.enableParallelProcessing, [&](size_t i) {
+            auto& node = *nodes[i];
+            if (node.mesh.empty()) {
+                return;
+            }
+            const auto& positions = node.mesh.vertices().positions;
+            const float extent = meshopt_simplifyScale(positions.front().data(), positions.size(), sizeof(Vertex));
+            node.mesh = addSkirts(node.mesh, extent * config.skirtDepthRatio);
+        });
+    }
+    
+    // 后序传播：父节点误差不小于任一子节点，保证误差从叶到根单调不减
+    template<typename Node>
+    void propagateGeometricErrors(Node& node) {
+        for (const auto& child : node.children) {
+            propagateGeometricErrors(*child);
+            node.geometricError = std::max(node.geometricError, child->geometricError);
+        }
+    }
+    
+    // 按位置焊接：同一位置的顶点映射到同一编号
+    std::vector<unsigned int> weldPositions(const VertexAttributes& vertices, size_t& uniqueCount) {
+        std::vector<unsigned int> remap(vertices.size());
+        uniqueCount = meshopt_generateVertexRemap(remap.data(), nullptr, vertices.size(),
+                                                  vertices.positions.data(), vertices.size(), sizeof(Vertex));
+        return remap;
+    }
+    
+    // 开放边界边：焊接后只被一个三角形使用的边（接缝不会被误判为边界），
+    // 以原始顶点编号按所在三角形的环绕方向返回
+    std::vector<std::pair<Index, Index>> findBorderEdges(const Mesh& mesh, std::span<const unsigned int> positionRemap) {
+        struct Edge {
+            std::uint64_t key;
+            Index from;
+            Index to;
+        };
+        
+        const auto& indices = mesh.indices();
+        std::vector<Edge> edges;
+        edges.reserve(indices.size());
+        for (size_t i = 0; i + 2 < indices.size(); i += 3) {
+            for (int e = 0; e < 3; ++e) {
+                const Index from = indices[i + e];
+                const Index to = indices[i + (e + 1) % 3];
+                const std::uint64_t a = positionRemap[from];
+                const std::uint64_t b = positionRemap[to];
+                edges.push_back({a < b ? (a << 32) | b : (b << 32) | a, from, to});
+            }
+        }
+        std::sort(edges.begin(), edges.end(), [](const Edge& x, const Edge& y) { return x.key < y.key; });
+        
+        std::vector<std::pair<Index, Index>> border;
+        for (size_t i = 0; i < edges.size();) {
+            size_t j = i + 1;
+            while (j < edges.size() && edges[j].key == edges[i].key) {
+                ++j;
+            }
+            if (j - i == 1) {
+                border.emplace_back(edges[i].from, edges[i].to);
+            }
+            i = j;
+        }
+        return border;
+    }
+    
+    // 只收集 indices 引用到的顶点，并把索引改写到新编号
+    Mesh compactBuffers(const VertexAttributes& vertices, std::span<const Index> indices) {
+        std::vector<unsigned int> remap(vertices.size());
+        const size_t uniqueCount = meshopt_optimizeVertexFetchRemap(remap.data(), indices.data(),
+                                                                    indices.size(), vertices.size());
+        
+        VertexAttributes compacted;
+        compacted.positions = remapStream(vertices.positions, remap, uniqueCount);
+        compacted.normals = remapStream(vertices.normals, remap, uniqueCount);
+        compacted.texCoords = remapStream(vertices.texCoords, remap, uniqueCount);
+        compacted.colors = remapStream(vertices.colors, remap, uniqueCount);
+        compacted.geoCoords = remapStream(vertices.geoCoords, remap, uniqueCount);
+        
+        Mesh::Indices newIndices(indices.size());
+        meshopt_remapIndexBuffer(newIndices.data(), indices.data(), indices.size(), remap.data());
+        
+        return Mesh{std::move(compacted), std::move(newIndices)};
+    }
+} // namespace
+
+// 网格压缩
+Mesh compactMesh(const Mesh& mesh) {
+    if (mesh.empty()) {
+        return mesh;
+    }
+    return compactBuffers(mesh.vertices(), mesh.indices());
+}
+
+// 顶点锁定标记
+std::vector<unsigned char> computeVertexLocks(const Mesh& mesh, bool lockSeams, bool lockBorder) {
     const auto& vertices = mesh.vertices();
     const auto& indices = mesh.indices();
+    const size_t vertexCount = vertices.positions.size();
+    
+    std::vector<unsigned char> locks(vertexCount, 0);
+    if (!lockSeams && !lockBorder) {
+        return locks;
+    }
     
-    // 转换顶点数据为 meshoptimizer 格式（仅使用位置）
-    std::vector<float> vertexData;
-    vertexData.reserve(vertices.positions.size() * 3);
+    size_t uniqueCount = 0;
+    const auto positionRemap = weldPositions(vertices, uniqueCount);
     
-    for (const auto& pos : vertices.positions) {
-        vertexData.push_back(pos[0]);
-        vertexData.push_back(pos[1]);
-        vertexData.push_back(pos[2]);
+    std::vector<unsigned char> lockedPositions(uniqueCount, 0);
+    
+    if (lockSeams) {
+        // 位置相同但属性不同的顶点构成接缝
+        std::vector<Index> representative(uniqueCount, ~Index{0});
+        for (Index v = 0; v < vertexCount; ++v) {
+            auto& first = representative[positionRemap[v]];
+            if (first == ~Index{0}) {
+                first = v;
+                continue;
+            }
+            
+            const bool differs =
+                (!vertices.normals.empty() && vertices.normals[v] != vertices.normals[first]) ||
+                (!vertices.texCoords.empty() && vertices.texCoords[v] != vertices.texCoords[first]) ||
+                (!vertices.colors.empty() && vertices.colors[v] != vertices.colors[first]);
+            if (differs) {
+                lockedPositions[positionRemap[v]] = 1;
+            }
+        }
     }
     
-    // 复制索引数据
-    std::vector<unsigned int> inputIndices(indices.begin(), indices.end());
-    std::vector<unsigned int> outputIndices(indices.size());
+    if (lockBorder) {
+        for (const auto& [from, to] : findBorderEdges(mesh, positionRemap)) {
+            lockedPositions[positionRemap[from]] = 1;
+            lockedPositions[positionRemap[to]] = 1;
+        }
+    }
     
-    // 使用 meshoptimizer 进行简化
-    float targetError = 0.01f;
-    size_t resultCount = meshopt_simplify(
-        outputIndices.data(),
-        inputIndices.data(),
-        inputIndices.size(),
-        vertexData.data(),
-        vertices.positions.size(),
-        sizeof(float) * 3,
-        targetTriangleCount * 3,
-        targetError
-    );
+    for (size_t v = 0; v < vertexCount; ++v) {
+        if (lockedPositions[positionRemap[v]]) {
+            locks[v] = meshopt_SimplifyVertex_Lock;
+        }
+    }
+    
+    return locks;
+}
+
+// 单元格面锁定
+std::vector<unsigned char> computeCellFaceLocks(const Mesh& mesh, const BoundingBox& cell, float relativeTolerance) {
+    const auto& positions = mesh.vertices().positions;
+    const auto& indices = mesh.indices();
+    std::vector<unsigned char> locks(positions.size(), 0);
+    
+    const auto extent = cell.size();
+    const float tolerance = relativeTolerance * std::max({extent[0], extent[1], extent[2]});
+    
+    // 严格位于单元格内部：距每个面都超过容差；跨度为零的轴（如平面网格的 z）上没有相邻单元格
+    const auto inside = [&](Index v) {
+        const auto& p = positions[v];
+        for (int axis = 0; axis < 3; ++axis) {
+            if (extent[axis] <= 2.0f * tolerance) {
+                continue;
+            }
+            if (p[axis] <= cell.min[axis] + tolerance || p[axis] >= cell.max[axis] - tolerance) {
+                return false;
+            }
+        }
+        return true;
+    };
     
-    // 调整输出索引大小
-    outputIndices.resize(resultCount);
+    for (size_t i = 0; i + 2 < indices.size(); i += 3) {
+        if (inside(indices[i]) && inside(indices[i + 1]) && inside(indices[i + 2])) {
+            continue;
+        }
+        for (int k = 0; k < 3; ++k) {
+            locks[indices[i + k]] = meshopt_SimplifyVertex_Lock;
+        }
+    }
+    
+    return locks;
+}
+
+// 裙边生成
+Mesh addSkirts(const Mesh& mesh, float depth) {
+    if (mesh.empty() || depth <= 0.0f) {
+        return mesh;
+    }
+    
+    const auto& vertices = mesh.vertices();
+    size_t uniqueCount = 0;
+    const auto positionRemap = weldPositions(vertices, uniqueCount);
+    const auto borderEdges = findBorderEdges(mesh, positionRemap);
+    if (borderEdges.empty()) {
+        return mesh;
+    }
     
-    // 创建简化后的网格
     Mesh::Vertices newVertices = vertices;
-    Mesh::Indices newIndices(outputIndices.begin(), outputIndices.end());
+    Mesh::Indices newIndices = mesh.indices();
+    newIndices.reserve(newIndices.size() + borderEdges.size() * 6);
+    
+    // 每个边界顶点生成一个下沉顶点，沿用原顶点的属性
+    const size_t vertexCount = vertices.size();
+    std::unordered_map<Index, Index> lowered;
+    const auto lower = [&](Index v) {
+        const auto [it, inserted] = lowered.try_emplace(v, static_cast<Index>(newVertices.positions.size()));
+        if (inserted) {
+            auto position = vertices.positions[v];
+            position[2] -= depth;
+            newVertices.positions.push_back(position);
+            if (vertices.normals.size() == vertexCount) {
+                newVertices.normals.push_back(vertices.normals[v]);
+            }
+            if (vertices.texCoords.size() == vertexCount) {
+                newVertices.texCoords.push_back(vertices.texCoords[v]);
+            }
+            if (vertices.colors.size() == vertexCount) {
+                newVertices.colors.push_back(vertices.colors[v]);
+            }
+            if (vertices.geoCoords.size() == vertexCount) {
+                // 局部 +Z 即 ENU 的天向，缓存的椭球高随之下沉
+                auto geoCoord = vertices.geoCoords[v];
+                geoCoord[2] -= depth;
+                newVertices.geoCoords.push_back(geoCoord);
+            }
+        }
+        return it->second;
+    };
+    
+    // 边 a->b 的裙边四边形 (a, b, b', a')，环绕方向使其朝外
+    for (const auto& [a, b] : borderEdges) {
+        const Index lowA = lower(a);
+        const Index lowB = lower(b);
+        newIndices.insert(newIndices.end(), {lowA, lowB, b, lowA, b, a});
+    }
     
     return Mesh{std::move(newVertices), std::move(newIndices)};
 }
 
+SimplifyResult MeshoptSimplifier::simplify(const Mesh& mesh, const SimplifyOptions& options) const {
+    return simplifyMeshWithError(mesh, options);
+}
+
+std::unique_ptr<ISimplifier> createSimplifier(SimplifierBackend backend) {
+    switch (backend) {
+        case SimplifierBackend::Qem:     return std::make_unique<QemSimplifier>();
+        case SimplifierBackend::Meshopt: return std::make_unique<MeshoptSimplifier>();
+    }
+    return std::make_unique<MeshoptSimplifier>();
+}
+
+// 网格简化函数
+Mesh simplifyMesh(const Mesh& mesh, size_t targetTriangleCount) noexcept {
+    SimplifyOptions options;
+    options.targetTriangleCount = targetTriangleCount;
+    options.lockSeams = false;
+    return simplifyMesh(mesh, options);
+}
+
+Mesh simplifyMesh(const Mesh& mesh, const SimplifyOptions& options) noexcept {
+    return simplifyMeshWithError(mesh, options).mesh;
+}
+
+SimplifyResult simplifyMeshWithError(const Mesh& mesh, const SimplifyOptions& options) noexcept {
+    if (mesh.empty() || mesh.triangleCount() <= options.targetTriangleCount) {
+        return {mesh, 0.0, mesh.triangleCount(), false};
+    }
+    
+    try {
+        const auto& vertices = mesh.vertices();
+        const auto& indices = mesh.indices();
+        const size_t vertexCount = vertices.positions.size();
+        
+        // 交错排列参与误差度量的属性（只包含权重非零且存在的属性流）
+        const auto& weights = options.attributeWeights;
+        const bool useNormals = weights.normal > 0.0f && vertices.normals.size() == vertexCount;
+        const bool useTexCoords = weights.texCoord > 0.0f && vertices.texCoords.size() == vertexCount;
+        const bool useColors = weights.color > 0.0f && vertices.colors.size() == vertexCount;
+        
+        std::vector<float> attributeWeights;
+        if (useNormals) {
+            attributeWeights.insert(attributeWeights.end(), 3, weights.normal);
+        }
+        if (useTexCoords) {
+            attributeWeights.insert(attributeWeights.end(), 2, weights.texCoord);
+        }
+        if (useColors) {
+            attributeWeights.insert(attributeWeights.end(), 4, weights.color);
+        }
+        
+        const size_t attributeCount = attributeWeights.size();
+        std::vector<float> attributes;
+        attributes.reserve(vertexCount * attributeCount);
+        
+        for (size_t v = 0; v < vertexCount && attributeCount > 0; ++v) {
+            if (useNormals) {
+                attributes.insert(attributes.end(), vertices.normals[v].begin(), vertices.normals[v].end());
+            }
+            if (useTexCoords) {
+                attributes.insert(attributes.end(), vertices.texCoords[v].begin(), vertices.texCoords[v].end());
+            }
+            if (useColors) {
+                for (const auto channel : vertices.colors[v]) {
+                    attributes.push_back(static_cast<float>(channel) / 255.0f);
+                }
+            }
+        }
+        
+        auto locks = computeVertexLocks(mesh, options.lockSeams, options.lockBorder);
+        if (options.lockCellFaces) {
+            const auto cellLocks = computeCellFaceLocks(mesh, *options.lockCellFaces);
+            for (size_t v = 0; v < locks.size(); ++v) {
+                locks[v] |= cellLocks[v];
+            }
+        }
+        const bool anyLocked = std::any_of(locks.begin(), locks.end(), [](unsigned char l) { return l != 0; });
+        
+        std::vector<unsigned int> outputIndices(indices.size());
+        float resultError = 0.0f;
+        
+        // 使用 meshoptimizer 进行简化
+        size_t resultCount = meshopt_simplifyWithAttributes(
+            outputIndices.data(),
+            indices.data(),
+            indices.size(),
+            vertices.positions.front().data(),
+            vertexCount,
+            sizeof(Vertex),
+            attributeCount > 0 ? attributes.data() : nullptr,
+            attributeCount * sizeof(float),
+            attributeCount > 0 ? attributeWeights.data() : nullptr,
+            attributeCount,
+            anyLocked ? locks.data() : nullptr,
+            options.targetTriangleCount * 3,
+            options.targetError,
+            0,
+            &resultError
+        );
+        
+        // 调整输出索引大小
+        outputIndices.resize(resultCount);
+        const size_t topologyTriangles = resultCount / 3;
+        
+        // 受拓扑约束远未达到目标时（常见于大树的顶层），回退到不保拓扑的 sloppy 简化；
+        // sloppy 简化不认锁定，存在锁定顶点（边界、接缝、单元格面）时不回退，以免产生裂缝
+        bool usedFallback = false;
+        if (!anyLocked && options.fallbackFactor > 0.0f && options.targetTriangleCount > 0 &&
+            static_cast<double>(topologyTriangles) >
+                static_cast<double>(options.targetTriangleCount) * options.fallbackFactor) {
+            std::vector<unsigned int> sloppyIndices(indices.size());
+            float sloppyError = 0.0f;
+            const size_t sloppyCount = meshopt_simplifySloppy(
+                sloppyIndices.data(),
+                indices.data(),
+                indices.size(),
+                vertices.positions.front().data(),
+                vertexCount,
+                sizeof(Vertex),
+                options.targetTriangleCount * 3,
+                std::numeric_limits<float>::max(),
+                &sloppyError
+            );
+            
+            if (sloppyCount > 0 && sloppyCount < resultCount) {
+                sloppyIndices.resize(sloppyCount);
+                outputIndices = std::move(sloppyIndices);
+                resultError = sloppyError;
+                usedFallback = true;
+            }
+        }
+        
+        // 相对误差换算为世界单位
+        const double error = static_cast<double>(resultError) *
+            meshopt_simplifyScale(vertices.positions.front().data(), vertexCount, sizeof(Vertex));
+        
+        // 创建简化后的网格（默认只保留仍被引用的顶点）
+        if (options.compactVertices) {
+            return {compactBuffers(vertices, outputIndices), error, topologyTriangles, usedFallback};
+        }
+        
+        Mesh::Vertices newVertices = vertices;
+        Mesh::Indices newIndices(outputIndices.begin(), outputIndices.end());
+        
+        return {Mesh{std::move(newVertices), std::move(newIndices)}, error, topologyTriangles, usedFallback};
+    } catch (const std::exception&) {
+        return {mesh, 0.0, mesh.triangleCount(), false};
+    }
+}
+
 // 地理 LOD 构建
 std::shared_ptr<GeoLodNode> buildGeoLodHierarchy(const Mesh& inputMesh, const geo::GeoBBox& region, 
                                                 const LodConfig& config) {
@@ -160,57 +611,105 @@ std::shared_ptr<GeoLodNode> buildGeoLodHierarchy(const Mesh& inputMesh, const ge
         return nullptr;
     }
     
+    // 高度范围总是取自网格本身，子区域在分割时各自收紧
+    const auto dataBounds = computeGeoBounds(inputMesh);
     auto root = std::make_shared<GeoLodNode>();
-    root->region = region;
+    root->region = region.withHeights(dataBounds->minHeight, dataBounds->maxHeight);
     root->mesh = inputMesh;
     root->lodLevel = 0;
     root->geometricError = 0.0;
     
-    // 递归构建函数
-    std::function<void(std::shared_ptr<GeoLodNode>, int)> buildRecursive;
+    // 按瓦片方案细分时，根节点是完整包含数据的最深一级瓦片；
+    // 数据跨越 0 级瓦片边界时根节点覆盖方案全域，子节点为数据触及的 0 级瓦片
+    const auto& scheme = config.tilingScheme;
+    std::optional<geo::TileKey> rootKey;
+    if (scheme) {
+        rootKey = scheme->enclosingTile(*dataBounds);
+        root->region = (rootKey ? scheme->bounds(*rootKey) : scheme->extent())
+                           .withHeights(dataBounds->minHeight, dataBounds->maxHeight);
+    }
     
-    buildRecursive = [&](std::shared_ptr<GeoLodNode> node, int depth) {
+    // 子区域与对应的网格：按数据包围盒四分，或取瓦片方案中的下一级瓦片
+    const auto splitNode = [&](const GeoLodNode& node, const std::optional<geo::TileKey>& key) {
+        std::vector<std::pair<Mesh, geo::GeoBBox>> parts;
+        std::vector<std::optional<geo::TileKey>> keys;
+        if (!scheme) {
+            const auto quadrants = node.region.subdivide();
+            parts = splitMeshByRegion(node.mesh, node.region, {quadrants.begin(), quadrants.end()});
+            keys.resize(parts.size());
+            return std::pair{std::move(parts), std::move(keys)};
+        }
+        if (key && key->z >= geo::TilingScheme::kMaxLevel) {
+            return std::pair{std::move(parts), std::move(keys)};
+        }
+        
+        std::vector<geo::TileKey> childKeys;
+        if (key) {
+            const auto quadrants = key->children();
+            childKeys.assign(quadrants.begin(), quadrants.end());
+        } else {
+            childKeys = scheme->tilesAt(*dataBounds, 0);
+        }
+        for (auto& [subMesh, childKey] : splitMeshByTiles(node.mesh, *scheme, childKeys)) {
+            const auto heights = computeGeoBounds(subMesh);
+            const auto childRegion = scheme->bounds(childKey).withHeights(heights->minHeight, heights->maxHeight);
+            parts.emplace_back(std::move(subMesh), childRegion);
+            keys.push_back(childKey);
+        }
+        return std::pair{std::move(parts), std::move(keys)};
+    };
+    
+    // 递归构建函数：各子区域的切分与简化并行执行，空子区域在汇总时剔除
+    std::function<void(GeoLodNode&, int, const std::optional<geo::TileKey>&)> buildRecursive;
+    
+    buildRecursive = [&](GeoLodNode& node, int depth, const std::optional<geo::TileKey>& key) {
         if (depth >= config.maxLodLevels) {
             return;
         }
         
         // 检查是否需要细分
-        if (!config.strategy->shouldSubdivide(node->mesh, node->region, depth)) {
+        if (!config.strategy->shouldSubdivide(node.mesh, node.region, depth)) {
             return;
         }
         
-        // 四叉树细分地理区域
-        auto subRegions = node->region.subdivide();
+        // 单遍把网格分割到全部子区域
+        const auto split = splitNode(node, key);
+        const auto& subMeshes = split.first;
+        const auto& subKeys = split.second;
+        std::vector<std::shared_ptr<GeoLodNode>> children(subMeshes.size());
         
-        for (const auto& subRegion : subRegions) {
-            // 分割网格到子区域
-            auto subMeshes = splitMeshByRegion(node->mesh, node->region, {subRegion});
+        forEachChild(subMeshes.size(), config.enableParallelProcessing, [&](size_t i) {
+            const auto& [subMesh, subRegion] = subMeshes[i];
             
-            if (!subMeshes.empty() && !subMeshes[0].first.empty()) {
-                auto childNode = std::make_shared<GeoLodNode>();
-                childNode->region = subRegion;
-                childNode->lodLevel = depth + 1;
-                
-                // 简化子网格
-                size_t targetCount = config.strategy->targetTriangleCount(subMeshes[0].first, depth + 1);
-                childNode->mesh = simplifyMesh(subMeshes[0].first, targetCount);
-                childNode->geometricError = config.strategy->computeGeometricError(subMeshes[0].first, childNode->mesh);
-                
-                node->children.push_back(childNode);
-                
-                // 递归构建子节点
-                buildRecursive(childNode, depth + 1);
-            }
-        }
+            auto childNode = std::make_shared<GeoLodNode>();
+            childNode->region = subRegion;
+            childNode->lodLevel = depth + 1;
+            
+            // 简化子网格
+            simplifyChildNode(*childNode, subMesh, std::nullopt, config);
+            
+            // 递归构建子节点
+            buildRecursive(*childNode, depth + 1, subKeys[i]);
+            children[i] = std::move(childNode);
+        });
+        
+        std::erase(children, nullptr);
+        node.children = std::move(children);
     };
     
-    buildRecursive(root, 0);
+    buildRecursive(*root, 0, rootKey);
+    propagateGeometricErrors(*root);
+    applySkirts(*root, config);
     return root;
 }
 
 // 几何 LOD 构建
 std::shared_ptr<GeometricLodNode> buildGeometricLodHierarchy(const Mesh& inputMesh, const BoundingBox& bounds,
                                                             const LodConfig& config) {
+    if (config.bottomUpConstruction) {
+        return buildBottomUpLodHierarchy(inputMesh, config);
+    }
+    
     if (config.useOctreeSubdivision) {
         return buildOctreeLodHierarchy(inputMesh, config);
     }
@@ -222,51 +721,323 @@ std::shared_ptr<GeometricLodNode> buildGeometricLodHierarchy(const Mesh& inputMe
     root->lodLevel = 0;
     root->geometricError = 0.0;
     
-    // 递归构建函数
-    std::function<void(std::shared_ptr<GeometricLodNode>, int)> buildRecursive;
+    // 递归构建函数：一次切分得到全部子网格后，各子节点的简化与递归并行执行
+    std::function<void(GeometricLodNode&, int)> buildRecursive;
     
-    buildRecursive = [&](std::shared_ptr<GeometricLodNode> node, int depth) {
+    buildRecursive = [&](GeometricLodNode& node, int depth) {
         if (depth >= config.maxLodLevels) {
             return;
         }
         
         // 检查是否需要细分
-        if (!config.strategy->shouldSubdivide(node->mesh, node->bounds, depth)) {
+        if (!config.strategy->shouldSubdivide(node.mesh, node.bounds, depth)) {
             return;
         }
         
-        // 八叉树细分
-        auto subBounds = node->bounds.subdivide();
+        // 按划分策略细分
+        std::vector<Index> nodeTriangles(node.mesh.triangleCount());
+        std::iota(nodeTriangles.begin(), nodeTriangles.end(), Index{0});
+        auto subBounds = computeChildBounds(node.mesh, nodeTriangles, node.bounds, config.octreeConfig);
         
-        for (const auto& subBound : subBounds) {
-            // 分割网格到子区域
-            auto subMeshes = splitMeshByBounds(node->mesh, {subBound});
-            
-            if (!subMeshes.empty() && !subMeshes[0].first.empty()) {
-                auto childNode = std::make_shared<GeometricLodNode>();
-                childNode->bounds = subBound;
-                childNode->lodLevel = depth + 1;
-                
-                // 简化子网格
-                size_t targetCount = config.strategy->targetTriangleCount(subMeshes[0].first, depth + 1);
-                childNode->mesh = simplifyMesh(subMeshes[0].first, targetCount);
-                childNode->geometricError = config.strategy->computeGeometricError(subMeshes[0].first, childNode->mesh);
-                
-                node->children.push_back(childNode);
-                
-                // 递归构建子节点
-                buildRecursive(childNode, depth + 1);
+        // 单遍把网格分割到所有子区域
+        auto subMeshes = splitMeshByBounds(node.mesh, subBounds);
+        std::vector<std::shared_ptr<GeometricLodNode>> children(subMeshes.size());
+        
+        forEachChild(subMeshes.size(), config.enableParallelProcessing, [&](size_t i) {
+            const auto& [subMesh, subBound] = subMeshes[i];
+            if (subMesh.empty()) {
+                return;
             }
-        }
+            
+            auto childNode = std::make_shared<GeometricLodNode>();
+            childNode->bounds = subBound;
+            childNode->lodLevel = depth + 1;
+            
+            // 简化子网格
+            simplifyChildNode(*childNode, subMesh, subBound, config);
+            
+            // 递归构建子节点
+            buildRecursive(*childNode, depth + 1);
+            children[i] = std::move(childNode);
+        });
+        
+        std::erase(children, nullptr);
+        node.children = std::move(children);
     };
     
-    buildRecursive(root, 0);
+    buildRecursive(*root, 0);
+    propagateGeometricErrors(*root);
+    applySkirts(*root, config);
     return root;
 }
 
+std::shared_ptr<GeometricLodNode> buildGeometricLodHierarchy(const Mesh& inputMesh, const OctreeNode& octree,
+                                                            const LodConfig& config) {
+    if (config.bottomUpConstruction) {
+        return buildBottomUpLodHierarchy(inputMesh, octree, config);
+    }
+    
+    if (config.useOctreeSubdivision) {
+        return buildOctreeLodHierarchy(inputMesh, octree, config);
+    }
+    
+    return buildGeometricLodHierarchy(inputMesh, octree.bounds, config);
+}
+
 // 八叉树 LOD 构建
 std::shared_ptr<GeometricLodNode> buildOctreeLodHierarchy(const Mesh& inputMesh, const LodConfig& config) {
-    return buildGeometricLod(inputMesh, config.octreeConfig);
+    if (inputMesh.empty()) {
+        return nullptr;
+    }
+    
+    auto octree = buildOctree(inputMesh, config.octreeConfig);
+    if (!octree) {
+        return nullptr;
+    }
+    
+    return buildOctreeLodHierarchy(inputMesh, *octree, config);
+}
+
+std::shared_ptr<GeometricLodNode> buildOctreeLodHierarchy(const Mesh& inputMesh, const OctreeNode& octree,
+                                                          const LodConfig& config) {
+    auto root = buildGeometricLod(inputMesh, octree, config.enableParallelProcessing);
+    if (!root) {
+        return nullptr;
+    }
+    
+    // 内部节点持有整个子树的全部细节：按节点层级简化并度量误差（锁定开放边界，与同层相邻节点无裂缝）；
+    // 叶节点保留全部细节，误差为 0
+    std::vector<GeometricLodNode*> nodes;
+    collectNodes(*root, nodes);
+    forEachChild(nodes.size(), config.enableParallelProcessing, [&](size_t i) {
+        auto& node = *nodes[i];
+        if (node.isLeaf() || node.mesh.empty()) {
+            return;
+        }
+        const auto source = std::move(node.mesh);
+        simplifyChildNode(node, source, std::nullopt, config);
+    });
+    
+    propagateGeometricErrors(*root);
+    applySkirts(*root, config);
+    return root;
+}
+
+// 自底向上 LOD 构建
+std::shared_ptr<GeometricLodNode> buildBottomUpLodHierarchy(const Mesh& inputMesh, const LodConfig& config) {
+    if (inputMesh.empty()) {
+        return nullptr;
+    }
+    
+    auto octree = buildOctree(inputMesh, config.octreeConfig);
+    if (!octree) {
+        return nullptr;
+    }
+    
+    return buildBottomUpLodHierarchy(inputMesh, *octree, config);
+}
+
+std::shared_ptr<GeometricLodNode> buildBottomUpLodHierarchy(const Mesh& inputMesh, const OctreeNode& octree,
+                                                            const LodConfig& config) {
+    if (inputMesh.empty()) {
+        return nullptr;
+    }
+    
+    // 单一源文件的索引：三角形编号即 inputMesh 中的编号；没有可沿用的结果，全部重新构建
+    const std::array<size_t, 1> triangleCounts{inputMesh.triangleCount()};
+    const auto index = OctreeIndex::fromOctree(octree, triangleCounts, config.octreeConfig);
+    return buildBottomUpLodHierarchy(index, [&](SourceId) { return &inputMesh; }, nullptr, config);
+}
+
+std::shared_ptr<GeometricLodNode> buildBottomUpLodHierarchy(const OctreeIndex& index, const SourceMeshResolver& resolver,
+                                                            const ILodNodeStore* store, const LodConfig& config) {
+    if (!index.find(kRootOctreeKey)) {
+        return nullptr;
+    }
+    
+    const auto childKeys = [&](OctreeKey key) {
+        std::vector<OctreeKey> keys;
+        for (int i = 0; i < 8; ++i) {
+            if (index.find(childOctreeKey(key, i))) {
+                keys.push_back(childOctreeKey(key, i));
+            }
+        }
+        return keys;
+    };
+    
+    // 跨界复制的三角形只归属先序遍历中第一个包含它的节点，使各节点的网格互不重叠；
+    // 同时后序累加子树内归属的三角形数，内部节点据此判断是否细分
+    struct NodeTriangles {
+        std::map<SourceId, std::vector<Index>> owned;  // 按源文件升序
+        size_t subtreeCount{0};
+    };
+    std::unordered_map<OctreeKey, NodeTriangles> nodeTriangles;
+    std::map<SourceId, std::vector<bool>> assigned;
+    std::function<size_t(OctreeKey)> assignOwners = [&](OctreeKey key) -> size_t {
+        auto& entry = nodeTriangles[key];
+        size_t count = 0;
+        for (const auto& source : index.find(key)->sources) {
+            auto& flags = assigned[source.sourceId];
+            for (const auto& range : source.ranges) {
+                flags.resize(std::max(flags.size(), static_cast<size_t>(range.first) + range.count), false);
+                for (Index triangle = range.first; triangle < range.first + range.count; ++triangle) {
+                    if (!flags[triangle]) {
+                        flags[triangle] = true;
+                        entry.owned[source.sourceId].push_back(triangle);
+                        ++count;
+                    }
+                }
+            }
+        }
+        for (const auto child : childKeys(key)) {
+            count += assignOwners(child);
+        }
+        entry.subtreeCount = count;
+        return count;
+    };
+    assignOwners(kRootOctreeKey);
+    
+    // 与自顶向下相同的截断条件：达到层数上限或策略不再细分的节点成为叶节点，保留整个子树的全部细节
+    const auto isLodLeaf = [&](OctreeKey key, int lodLevel) {
+        return index.isLeaf(key) || lodLevel >= config.maxLodLevels ||
+               !config.strategy->shouldSubdivide(nodeTriangles.at(key).subtreeCount, index.find(key)->tightBounds,
+                                                 lodLevel);
+    };
+    
+    // 规划（串行）：非脏且能取回的子树直接沿用，其余节点重新构建，并记下它们归属的三角形来自哪些源文件
+    std::unordered_map<OctreeKey, std::shared_ptr<GeometricLodNode>> reused;
+    std::map<SourceId, const Mesh*> sources;
+    const auto requireOwned = [&](OctreeKey key) {
+        for (const auto& [sourceId, triangles] : nodeTriangles.at(key).owned) {
+            sources.emplace(sourceId, nullptr);
+        }
+    };
+    std::function<void(OctreeKey, int)> plan = [&](OctreeKey key, int lodLevel) {
+        if (store && !index.find(key)->dirty) {
+            if (auto persisted = store->load(key)) {
+                reused.emplace(key, std::move(persisted));
+                return;
+            }
+        }
+        if (isLodLeaf(key, lodLevel)) {
+            index.traverseSubtree(key, [&](const OctreeIndexNode& node) { requireOwned(node.key); });
+            return;
+        }
+        requireOwned(key);
+        for (const auto child : childKeys(key)) {
+            plan(child, lodLevel + 1);
+        }
+    };
+    plan(kRootOctreeKey, 0);
+    for (auto& [sourceId, mesh] : sources) {
+        mesh = resolver(sourceId);
+    }
+    
+    // 收集若干节点归属的三角形组成网格，读取失败的源文件跳过
+    const auto gatherOwned = [&](const std::vector<OctreeKey>& keys) {
+        std::map<SourceId, std::vector<Index>> perSource;
+        for (const auto key : keys) {
+            for (const auto& [sourceId, triangles] : nodeTriangles.at(key).owned) {
+                auto& target = perSource[sourceId];
+                target.insert(target.end(), triangles.begin(), triangles.end());
+            }
+        }
+        std::vector<Mesh> parts;
+        for (auto& [sourceId, triangles] : perSource) {
+            if (const Mesh* mesh = sources.at(sourceId)) {
+                std::sort(triangles.begin(), triangles.end());
+                parts.push_back(mesh->subset(triangles));
+            }
+        }
+        return parts.size() == 1 ? std::move(parts.front()) : Mesh::merge(parts);
+    };
+    
+    // 后序构建：子节点先完成，父节点只处理子节点已简化的网格
+    std::function<std::shared_ptr<GeometricLodNode>(OctreeKey, int)> buildRecursive;
+    
+    buildRecursive = [&](OctreeKey key, int lodLevel) -> std::shared_ptr<GeometricLodNode> {
+        if (auto it = reused.find(key); it != reused.end()) {
+            return it->second;
+        }
+        
+        auto lodNode = std::make_shared<GeometricLodNode>();
+        lodNode->bounds = index.find(key)->tightBounds;
+        lodNode->lodLevel = lodLevel;
+        std::vector<OctreeKey> lodChildKeys;
+        
+        const auto finish = [&] {
+            if (store) {
+                store->store(key, *lodNode, lodChildKeys);
+            }
+            return lodNode;
+        };
+        
+        if (isLodLeaf(key, lodLevel)) {
+            std::vector<OctreeKey> subtree;
+            index.traverseSubtree(key, [&](const OctreeIndexNode& node) {
+                subtree.push_back(node.key);
+                if (store && node.key != key && node.dirty) {
+                    store->erase(node.key);
+                }
+            });
+            lodNode->mesh = gatherOwned(subtree);
+            return finish();
+        }
+        
+        const auto keys = childKeys(key);
+        std::vector<std::shared_ptr<GeometricLodNode>> children(keys.size());
+        forEachChild(keys.size(), config.enableParallelProcessing, [&](size_t i) {
+            auto childLodNode = buildRecursive(keys[i], lodLevel + 1);
+            if (childLodNode && !childLodNode->mesh.empty()) {
+                children[i] = std::move(childLodNode);
+            }
+        });
+        for (size_t i = 0; i < keys.size(); ++i) {
+            if (children[i]) {
+                lodChildKeys.push_back(keys[i]);
+            }
+        }
+        std::erase(children, nullptr);
+        
+        auto owned = gatherOwned({key});
+        
+        // 叶节点保留全部细节
+        if (children.empty()) {
+            lodNode->mesh = std::move(owned);
+            return finish();
+        }
+        
+        // 内部节点：合并子节点网格（松散模式下还有节点自身的三角形），再简化一级
+        std::vector<Mesh> parts;
+        parts.reserve(children.size() + 1);
+        double childError = 0.0;
+        for (const auto& child : children) {
+            parts.push_back(child->mesh);
+            childError = std::max(childError, child->geometricError);
+        }
+        if (!owned.empty()) {
+            parts.push_back(std::move(owned));
+        }
+        const auto merged = Mesh::merge(parts);
+        
+        // 子节点之间的公共边按位置焊接后不是边界，只有节点的外部边界被锁定，保证与相邻节点无裂缝；
+        // 简化选项按节点的实际层级取得，误差预算逐层放宽，根节点使用最粗的一级
+        auto options = config.strategy->simplifyOptions(merged, lodLevel);
+        options.lockBorder = true;
+        options.fallbackFactor = config.simplifyFallbackFactor;
+        auto simplified = simplifierFor(config).simplify(merged, options);
+        reportFallback(*lodNode, options, simplified, config);
+        
+        // 相对源网格的误差不超过子节点误差与本级简化误差之和，且随层级单调不减
+        lodNode->geometricError = childError + measureNodeError(merged, simplified, config);
+        lodNode->mesh = std::move(simplified.mesh);
+        lodNode->children = std::move(children);
+        return finish();
+    };
+    
+    auto root = buildRecursive(kRootOctreeKey, 0);
+    applySkirts(*root, config);
+    return root;
 }
 
 // 通用 LOD 构建
@@ -276,74 +1047,149 @@ LodNode buildLodHierarchy(const Mesh& inputMesh,
     return std::visit([&](const auto& bound) -> LodNode {
         using T = std::decay_t<decltype(bound)>;
         if constexpr (std::is_same_v<T, geo::GeoBBox>) {
-            return buildGeoLodHierarchy(inputMesh, bound, config);
+            return std::move(*buildGeoLodHierarchy(inputMesh, bound, config));
         } else {
-            return buildGeometricLodHierarchy(inputMesh, bound, config);
+            return std::move(*buildGeometricLodHierarchy(inputMesh, bound, config));
         }
     }, bounds);
 }
 
+// 大地坐标包围盒
+std::optional<geo::GeoBBox> computeGeoBounds(const Mesh& mesh) {
+    const auto& vertices = mesh.vertices();
+    if (vertices.empty()) {
+        return std::nullopt;
+    }
+    
+    const bool hasGeoCoords = vertices.geoCoords.size() == vertices.size();
+    const auto pointBounds = [&](size_t v) {
+        if (hasGeoCoords) {
+            const auto& [lon, lat, height] = vertices.geoCoords[v];
+            return geo::GeoBBox{lon, lat, lon, lat, height, height};
+        }
+        const auto& p = vertices.positions[v];
+        return geo::GeoBBox{p[0], p[1], p[0], p[1], p[2], p[2]};
+    };
+    
+    return tbb::parallel_reduce(
+        tbb::blocked_range<size_t>(1, vertices.size()), pointBounds(0),
+        [&](const tbb::blocked_range<size_t>& range, geo::GeoBBox bounds) {
+            for (size_t v = range.begin(); v != range.end(); ++v) {
+                bounds = bounds.unite(pointBounds(v));
+            }
+            return bounds;
+        },
+        [](const geo::GeoBBox& a, const geo::GeoBBox& b) { return a.unite(b); });
+}
+
 // 地理区域分割
 std::vector<std::pair<Mesh, geo::GeoBBox>> splitMeshByRegion(const Mesh& mesh, const geo::GeoBBox& totalRegion, 
                                                             const std::vector<geo::GeoBBox>& subRegions) {
-    // 简化实现：假设网格顶点包含地理坐标信息
-    // 实际实现中需要根据具体的坐标转换来分割网格
     std::vector<std::pair<Mesh, geo::GeoBBox>> results;
-    
-    for (const auto& region : subRegions) {
-        // 这里应该实现真正的地理分割逻辑
-        // 当前返回整个网格作为占位符
-        results.emplace_back(mesh, region);
+    const size_t regionCount = subRegions.size();
+    const size_t triangleCount = mesh.triangleCount();
+    if (regionCount == 0 || triangleCount == 0) {
+        return results;
     }
     
-    return results;
-}
-
-// 统计计算
-GeoLodStats computeGeoLodStats(const GeoLodNode& root) noexcept {
-    GeoLodStats stats;
-    stats.totalRegion = root.region;
+    const auto& vertices = mesh.vertices();
+    const auto& indices = mesh.indices();
+    const bool hasGeoCoords = vertices.geoCoords.size() == vertices.size();
+    const auto lonLat = [&](Index v) -> GeoCoord {
+        if (hasGeoCoords) {
+            return vertices.geoCoords[v];
+        }
+        const auto& p = vertices.positions[v];
+        return {static_cast<double>(p[0]), static_cast<double>(p[1]), static_cast<double>(p[2])};
+    };
     
-    root.traverse([&](const GeoLodNode& node) {
-        stats.totalNodes++;
-        if (node.isLeaf()) {
-            stats.leafNodes++;
+    auto subMeshes = splitByBuckets(mesh, regionCount, [&](size_t tri, std::vector<std::vector<Index>>& buckets) {
+        const auto a = lonLat(indices[tri * 3]);
+        const auto b = lonLat(indices[tri * 3 + 1]);
+        const auto c = lonLat(indices[tri * 3 + 2]);
+        const geo::GeoBBox triRegion{std::min({a[0], b[0], c[0]}), std::min({a[1], b[1], c[1]}),
+                                     std::max({a[0], b[0], c[0]}), std::max({a[1], b[1], c[1]})};
+        if (!triRegion.intersects(totalRegion)) {
+            return;
         }
-        stats.totalTriangles += node.mesh.triangleCount();
-        stats.maxDepth = std::max(stats.maxDepth, node.lodLevel);
-        
-        // 扩展统计数组
-        while (static_cast<int>(stats.trianglesPerLevel.size()) <= node.lodLevel) {
-            stats.trianglesPerLevel.push_back(0);
+        for (size_t r = 0; r < regionCount; ++r) {
+            if (triRegion.intersects(subRegions[r])) {
+                buckets[r].push_back(static_cast<Index>(tri));
+            }
         }
-        
-        stats.trianglesPerLevel[node.lodLevel] += node.mesh.triangleCount();
     });
     
-    return stats;
+    results.reserve(regionCount);
+    for (size_t r = 0; r < regionCount; ++r) {
+        if (!subMeshes[r].empty()) {
+            const auto heights = computeGeoBounds(subMeshes[r]);
+            results.emplace_back(std::move(subMeshes[r]),
+                                 subRegions[r].withHeights(heights->minHeight, heights->maxHeight));
+        }
+    }
+    
+    return results;
 }
 
-GeometricLodStats computeGeometricLodStats(const GeometricLodNode& root) noexcept {
-    GeometricLodStats stats;
-    stats.totalBounds = root.bounds;
+std::vector<std::pair<Mesh, geo::TileKey>> splitMeshByTiles(const Mesh& mesh, const geo::TilingScheme& scheme,
+                                                           std::span<const geo::TileKey> keys) {
+    std::vector<std::pair<Mesh, geo::TileKey>> results;
+    if (keys.empty() || mesh.triangleCount() == 0) {
+        return results;
+    }
     
-    root.traverse([&](const GeometricLodNode& node) {
-        stats.totalNodes++;
-        if (node.isLeaf()) {
-            stats.leafNodes++;
+    // 每个顶点只做一次浮点到定点的换算，三角形的键范围由整数右移得到
+    const auto& vertices = mesh.vertices();
+    const auto& indices = mesh.indices();
+    const bool hasGeoCoords = vertices.geoCoords.size() == vertices.size();
+    std::vector<geo::TileCoord> coords(vertices.size());
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, coords.size()), [&](const tbb::blocked_range<size_t>& range) {
+        for (size_t v = range.begin(); v != range.end(); ++v) {
+            if (hasGeoCoords) {
+                coords[v] = scheme.coordAt(vertices.geoCoords[v][0], vertices.geoCoords[v][1]);
+            } else {
+                coords[v] = scheme.coordAt(vertices.positions[v][0], vertices.positions[v][1]);
+            }
         }
-        stats.totalTriangles += node.mesh.triangleCount();
-        stats.maxDepth = std::max(stats.maxDepth, node.lodLevel);
-        
-        // 扩展统计数组
-        while (static_cast<int>(stats.trianglesPerLevel.size()) <= node.lodLevel) {
-            stats.trianglesPerLevel.push_back(0);
+    });
+    
+    const std::uint32_t shift = geo::TilingScheme::kMaxLevel - keys.front().z;
+    auto subMeshes = splitByBuckets(mesh, keys.size(), [&](size_t tri, std::vector<std::vector<Index>>& buckets) {
+        const auto& a = coords[indices[tri * 3]];
+        const auto& b = coords[indices[tri * 3 + 1]];
+        const auto& c = coords[indices[tri * 3 + 2]];
+        const auto minX = std::min({a.x, b.x, c.x}) >> shift;
+        const auto maxX = std::max({a.x, b.x, c.x}) >> shift;
+        const auto minY = std::min({a.y, b.y, c.y}) >> shift;
+        const auto maxY = std::max({a.y, b.y, c.y}) >> shift;
+        for (size_t k = 0; k < keys.size(); ++k) {
+            if (keys[k].x >= minX && keys[k].x <= maxX && keys[k].y >= minY && keys[k].y <= maxY) {
+                buckets[k].push_back(static_cast<Index>(tri));
+            }
         }
-        
-        stats.trianglesPerLevel[node.lodLevel] += node.mesh.triangleCount();
     });
     
-    return stats;
+    results.reserve(keys.size());
+    for (size_t k = 0; k < keys.size(); ++k) {
+        if (!subMeshes[k].empty()) {
+            results.emplace_back(std::move(subMeshes[k]), keys[k]);
+        }
+    }
+    
+    return results;
+}
+
+// 统计计算：展平为节点表后线性扫描
+GeoLodStats computeGeoLodStats(const GeoLodNode& root) {
+    return computeGeoLodStats(flattenLodTree(root));
+}
+
+GeometricLodStats computeGeometricLodStats(const GeometricLodNode& root) {
+    return computeGeometricLodStats(flattenLodTree(root));
+}
+
+LodStats computeLodStats(const LodNode& root) {
+    return computeLodStats(flattenLodTree(root));
 }
 
 // 模式检测
@@ -2,11 +2,14 @@
 
 #include "Mesh.hpp"
 #include "Geometry.hpp"
+#include "OctreeIndex.hpp"
 #include "../geo/GeoBBox.hpp"
+#include "../geo/TilingScheme.hpp"
 #include <memory>
 #include <vector>
 #include <functional>
 #include <optional>
+#include <string_view>
 #include <variant>
 
 namespace lod::core {
@@ -36,7 +39,38 @@ struct GeoLodNode {
 // LOD 节点的变体类型
 using LodNode = std::variant<GeoLodNode, GeometricLodNode>;
 
-// LOD 简化策略接口
+// 属性感知简化的各属性流权重（0 表示该属性不参与误差度量）
+// 法线为单位向量、纹理坐标与颜色归一化到 [0,1]，权重相对于位置误差
+struct AttributeWeights {
+    float normal{0.0f};
+    float texCoord{0.0f};
+    float color{0.0f};
+    
+    constexpr bool any() const noexcept { return normal > 0.0f || texCoord > 0.0f || color > 0.0f; }
+};
+
+// 网格简化选项
+struct SimplifyOptions {
+    size_t targetTriangleCount{0};      // 0 表示不限数量，只受 targetError 约束
+    float targetError{0.01f};           // 相对于网格尺寸的误差上限
+    AttributeWeights attributeWeights;  // 全为 0 时仅按位置简化
+    bool lockSeams{true};               // 锁定属性接缝（位置相同、属性不同的顶点）
+    bool lockBorder{false};             // 锁定开放边界
+    std::optional<BoundingBox> lockCellFaces;  // 锁定与单元格面相交或越界的三角形顶点，相邻节点因此无裂缝
+    float fallbackFactor{2.0f};         // 保拓扑结果超过目标数量的该倍数时回退到 sloppy 简化；0 表示禁用，存在锁定顶点时不回退
+    bool compactVertices{true};         // 丢弃未引用的顶点；顶点缓冲被多个网格共享时可推迟，之后再调用 compactMesh
+};
+
+// 简化结果：error 为简化器报告的误差换算到世界单位（result_error × meshopt_simplifyScale）；
+// 启用属性权重时包含属性误差的贡献
+struct SimplifyResult {
+    Mesh mesh;
+    double error{0.0};
+    size_t topologyTriangleCount{0};  // 保拓扑简化得到的三角形数
+    bool usedFallback{false};         // 结果来自 sloppy 简化（不保拓扑、忽略属性，仅在无锁定顶点时发生）
+};
+
+// LOD 简化策略接口；节点几何误差不由策略给出，统一取简化器报告的误差（见 LodConfig::measureHausdorffError）
 class ILodStrategy {
 public:
     virtual ~ILodStrategy() = default;
@@ -44,49 +78,91 @@ public:
     // 计算目标面片数
     virtual size_t targetTriangleCount(const Mesh& mesh, int lodLevel) const = 0;
     
-    // 计算几何误差
-    virtual double computeGeometricError(const Mesh& original, const Mesh& simplified) const = 0;
+    // 简化选项（默认仅按位置简化，策略可覆盖以选择属性权重）
+    virtual SimplifyOptions simplifyOptions(const Mesh& mesh, int lodLevel) const {
+        SimplifyOptions options;
+        options.targetTriangleCount = targetTriangleCount(mesh, lodLevel);
+        return options;
+    }
     
     // 判断是否需要进一步细分（地理模式）
     virtual bool shouldSubdivide(const Mesh& mesh, const geo::GeoBBox& region, int currentLevel) const = 0;
     
-    // 判断是否需要进一步细分（几何模式）
-    virtual bool shouldSubdivide(const Mesh& mesh, const BoundingBox& bounds, int currentLevel) const = 0;
+    // 判断是否需要进一步细分（几何模式），默认只看三角形数
+    virtual bool shouldSubdivide(const Mesh& mesh, const BoundingBox& bounds, int currentLevel) const {
+        return shouldSubdivide(mesh.triangleCount(), bounds, currentLevel);
+    }
+    
+    // 按三角形数与范围判断是否细分（几何模式）：自底向上构建据八叉树统计的数量决定截断，无需提取子网格
+    virtual bool shouldSubdivide(size_t triangleCount, const BoundingBox& bounds, int currentLevel) const = 0;
 };
 
 // 基于面片数的策略
 class TriangleCountStrategy : public ILodStrategy {
 public:
     explicit TriangleCountStrategy(size_t maxTrianglesPerTile = 50000, 
-                                  double reductionRatio = 0.5)
-        : maxTrianglesPerTile_(maxTrianglesPerTile), reductionRatio_(reductionRatio) {}
+                                  double reductionRatio = 0.5,
+                                  AttributeWeights attributeWeights = {0.5f, 1.0f, 0.25f})
+        : maxTrianglesPerTile_(maxTrianglesPerTile), reductionRatio_(reductionRatio),
+          attributeWeights_(attributeWeights) {}
     
     size_t targetTriangleCount(const Mesh& mesh, int lodLevel) const override;
-    double computeGeometricError(const Mesh& original, const Mesh& simplified) const override;
+    SimplifyOptions simplifyOptions(const Mesh& mesh, int lodLevel) const override;
     bool shouldSubdivide(const Mesh& mesh, const geo::GeoBBox& region, int currentLevel) const override;
-    bool shouldSubdivide(const Mesh& mesh, const BoundingBox& bounds, int currentLevel) const override;
+    bool shouldSubdivide(size_t triangleCount, const BoundingBox& bounds, int currentLevel) const override;
+    using ILodStrategy::shouldSubdivide;
     
 private:
     size_t maxTrianglesPerTile_;
     double reductionRatio_;
+    AttributeWeights attributeWeights_;  // 纹理接缝优先
 };
 
 // 基于屏幕空间误差的策略
 class ScreenSpaceErrorStrategy : public ILodStrategy {
 public:
-    explicit ScreenSpaceErrorStrategy(double maxScreenSpaceError = 16.0)
-        : maxScreenSpaceError_(maxScreenSpaceError) {}
+    explicit ScreenSpaceErrorStrategy(double maxScreenSpaceError = 16.0,
+                                      AttributeWeights attributeWeights = {1.0f, 0.5f, 0.5f})
+        : maxScreenSpaceError_(maxScreenSpaceError), attributeWeights_(attributeWeights) {}
     
     size_t targetTriangleCount(const Mesh& mesh, int lodLevel) const override;
-    double computeGeometricError(const Mesh& original, const Mesh& simplified) const override;
+    SimplifyOptions simplifyOptions(const Mesh& mesh, int lodLevel) const override;
     bool shouldSubdivide(const Mesh& mesh, const geo::GeoBBox& region, int currentLevel) const override;
-    bool shouldSubdivide(const Mesh& mesh, const BoundingBox& bounds, int currentLevel) const override;
+    bool shouldSubdivide(size_t triangleCount, const BoundingBox& bounds, int currentLevel) const override;
+    using ILodStrategy::shouldSubdivide;
     
 private:
     double maxScreenSpaceError_;
+    AttributeWeights attributeWeights_;  // 着色（法线）优先
+};
+
+// 目标误差驱动的策略：每层给定屏幕空间误差预算（像素），按节点尺寸换算为世界单位容差，
+// 简化只受容差约束而不设三角形数量，平坦区域因此会被充分合并
+class TargetErrorStrategy : public ILodStrategy {
+public:
+    explicit TargetErrorStrategy(std::vector<double> pixelErrorPerLevel = {16.0, 8.0, 4.0, 2.0, 1.0},
+                                 double tileScreenSize = 256.0,
+                                 size_t maxTrianglesPerTile = 50000,
+                                 AttributeWeights attributeWeights = {})
+        : pixelErrorPerLevel_(std::move(pixelErrorPerLevel)), tileScreenSize_(tileScreenSize),
+          maxTrianglesPerTile_(maxTrianglesPerTile), attributeWeights_(attributeWeights) {}
+    
+    size_t targetTriangleCount(const Mesh& mesh, int lodLevel) const override;
+    SimplifyOptions simplifyOptions(const Mesh& mesh, int lodLevel) const override;
+    bool shouldSubdivide(const Mesh& mesh, const geo::GeoBBox& region, int currentLevel) const override;
+    bool shouldSubdivide(size_t triangleCount, const BoundingBox& bounds, int currentLevel) const override;
+    using ILodStrategy::shouldSubdivide;
+    
+private:
+    double pixelErrorAt(int lodLevel) const noexcept;
+    
+    std::vector<double> pixelErrorPerLevel_;  // 超出的层级沿用最后一项
+    double tileScreenSize_;
+    size_t maxTrianglesPerTile_;
+    AttributeWeights attributeWeights_;       // 默认仅按位置，容差即几何误差
 };
 
-// 基于体积的策略（几何模式专用）
+// 基于体积的策略（几何模式专用，只关心形状，使用默认的仅位置简化）
 class VolumeBasedStrategy : public ILodStrategy {
 public:
     explicit VolumeBasedStrategy(float minVolumeThreshold = 0.001f,
@@ -94,23 +170,71 @@ public:
         : minVolumeThreshold_(minVolumeThreshold), reductionRatio_(reductionRatio) {}
     
     size_t targetTriangleCount(const Mesh& mesh, int lodLevel) const override;
-    double computeGeometricError(const Mesh& original, const Mesh& simplified) const override;
     bool shouldSubdivide(const Mesh& mesh, const geo::GeoBBox& region, int currentLevel) const override;
-    bool shouldSubdivide(const Mesh& mesh, const BoundingBox& bounds, int currentLevel) const override;
+    bool shouldSubdivide(size_t triangleCount, const BoundingBox& bounds, int currentLevel) const override;
+    using ILodStrategy::shouldSubdivide;
     
 private:
     float minVolumeThreshold_;
     double reductionRatio_;
 };
 
-// LOD 生成配置
+// 网格简化后端接口：策略决定简化选项，后端负责执行；实现须无状态或线程安全（兄弟节点并行简化）
+class ISimplifier {
+public:
+    virtual ~ISimplifier() = default;
+    
+    virtual SimplifyResult simplify(const Mesh& mesh, const SimplifyOptions& options) const = 0;
+    
+    // 后端名称（用于日志与基准对比）
+    virtual std::string_view name() const noexcept = 0;
+};
+
+// meshoptimizer 后端（默认），即 simplifyMeshWithError
+class MeshoptSimplifier : public ISimplifier {
+public:
+    SimplifyResult simplify(const Mesh& mesh, const SimplifyOptions& options) const override;
+    std::string_view name() const noexcept override { return "meshopt"; }
+};
+
+// 内置简化后端
+enum class SimplifierBackend {
+    Meshopt,  // meshoptimizer
+    Qem       // 自研二次误差度量边折叠（见 QemSimplifier.hpp）
+};
+
+// 工厂函数：创建简化后端
+[[nodiscard]] std::unique_ptr<ISimplifier> createSimplifier(SimplifierBackend backend);
+
+// 简化回退事件：保拓扑简化受拓扑约束远未达到目标、改用 sloppy 简化的节点
+struct SimplifyFallbackEvent {
+    int lodLevel{0};
+    std::variant<geo::GeoBBox, BoundingBox> bounds;
+    size_t targetTriangleCount{0};
+    size_t topologyTriangleCount{0};  // 保拓扑简化得到的三角形数
+    size_t resultTriangleCount{0};    // 回退后的三角形数
+};
+
+// 可能从并行任务中调用，实现须线程安全
+using SimplifyFallbackCallback = std::function<void(const SimplifyFallbackEvent&)>;
+
+// 相邻节点边界的处理方式
+enum class BorderMode {
+    None,           // 各节点独立简化
+    LockCellFaces,  // 锁定单元格面上的顶点
+    Skirts          // 不锁定，简化后沿开放边界向下生成裙边（更便宜，但会多出少量三角形）
+};
+
+// LOD 生成配置（可复制：策略与简化后端只读共享，复制出的配置可以并发使用）
 struct LodConfig {
-    std::unique_ptr<ILodStrategy> strategy;
+    std::shared_ptr<ILodStrategy> strategy;
+    std::shared_ptr<ISimplifier> simplifier;  // 为空时使用 meshoptimizer 后端
     int maxLodLevels{8};
     size_t minTrianglesForSubdivision{100};
     
     // 地理模式配置
     double minTileSizeDegrees{0.001};  // 最小瓦片尺寸（度）
+    std::optional<geo::TilingScheme> tilingScheme;  // 设置时按全球瓦片方案细分，否则四分数据自身的包围盒
     
     // 几何模式配置
     float minNodeSize{0.001f};         // 最小节点尺寸
@@ -119,8 +243,17 @@ struct LodConfig {
     OctreeConfig octreeConfig;
     
     // 通用配置
-    bool enableParallelProcessing{true};
+    bool enableParallelProcessing{true};  // 兄弟子树并行构建；并发上限由调用方的 task_arena 决定
     bool useOctreeSubdivision{true};   // 是否使用八叉树细分
+    BorderMode borderMode{BorderMode::LockCellFaces};
+    float skirtDepthRatio{0.02f};      // 裙边深度相对于节点尺寸的比例
+    float simplifyFallbackFactor{2.0f};           // 覆盖简化选项中的 fallbackFactor；0 表示禁用回退
+    SimplifyFallbackCallback onSimplifyFallback;  // 记录走了回退路径的节点
+    bool bottomUpConstruction{false};  // 自底向上：叶节点保留全部细节，父节点由子节点合并后再简化
+    
+    // 几何误差度量：默认取简化器报告的误差，可额外计算简化结果到源网格的采样 Hausdorff 距离并取较大值
+    bool measureHausdorffError{false};
+    size_t hausdorffSamples{65536};
 };
 
 // LOD 构建模式
@@ -129,20 +262,55 @@ enum class LodMode {
     Geometric    // 几何模式（使用八叉树）
 };
 
-// 纯函数：网格简化
+// 纯函数：网格简化（仅位置）
 [[nodiscard]] Mesh simplifyMesh(const Mesh& mesh, size_t targetTriangleCount) noexcept;
 
-// 纯函数：根据地理区域分割网格
+// 纯函数：按选项简化（属性加权 + 顶点锁定）
+[[nodiscard]] Mesh simplifyMesh(const Mesh& mesh, const SimplifyOptions& options) noexcept;
+
+// 纯函数：简化并返回误差
+[[nodiscard]] SimplifyResult simplifyMeshWithError(const Mesh& mesh, const SimplifyOptions& options) noexcept;
+
+// 纯函数：压缩网格，只保留被索引引用的顶点（按首次引用顺序重排，利于顶点缓存）
+[[nodiscard]] Mesh compactMesh(const Mesh& mesh);
+
+// 纯函数：标记与单元格面相交或位于单元格外的三角形的全部顶点；
+// 容差为单元格最大跨度的 relativeTolerance 倍
+[[nodiscard]] std::vector<unsigned char> computeCellFaceLocks(const Mesh& mesh, const BoundingBox& cell,
+                                                              float relativeTolerance = 1e-5f);
+
+// 纯函数：沿开放边界（按位置焊接后只被一个三角形使用的边）向 -Z 方向生成深度为 depth 的裙边。
+// 假定 +Z 向上（地理模式的 ENU 局部坐标系），缓存的大地高同样降低 depth；任意朝向的几何输入上裙边方向未必正确
+[[nodiscard]] Mesh addSkirts(const Mesh& mesh, float depth);
+
+// 纯函数：计算顶点锁定标记（接缝/边界顶点为 1）
+[[nodiscard]] std::vector<unsigned char> computeVertexLocks(const Mesh& mesh, bool lockSeams, bool lockBorder);
+
+// 纯函数：顶点大地坐标的包围盒（含椭球高范围），并行归约；
+// 坐标取自 geoCoords 缓存，缺失时把位置的 x/y/z 视为经度/纬度/高度。空网格返回 nullopt
+[[nodiscard]] std::optional<geo::GeoBBox> computeGeoBounds(const Mesh& mesh);
+
+// 纯函数：根据地理区域分割网格。顶点坐标的来源同 computeGeoBounds，
+// 单遍并行分桶：与几何分割相同，跨越区域边界的三角形分配到它触及的每个子区域；
+// 完全落在 totalRegion 之外的三角形被丢弃，空的子区域不出现在结果中。
+// 返回的子区域经纬度范围不变，高度范围收紧到子网格的实际高度
 [[nodiscard]] std::vector<std::pair<Mesh, geo::GeoBBox>> 
 splitMeshByRegion(const Mesh& mesh, const geo::GeoBBox& totalRegion, 
                   const std::vector<geo::GeoBBox>& subRegions);
 
+// 纯函数：按全球瓦片方案分割网格，keys 须同属一个层级。顶点坐标的来源同 computeGeoBounds，
+// 每个顶点换算一次定点瓦片坐标后，单遍并行按键分桶（整数运算）；跨越瓦片边界的三角形分配到它触及的每个瓦片，
+// 不在 keys 中的瓦片上的三角形被丢弃，空瓦片不出现在结果中
+[[nodiscard]] std::vector<std::pair<Mesh, geo::TileKey>>
+splitMeshByTiles(const Mesh& mesh, const geo::TilingScheme& scheme, std::span<const geo::TileKey> keys);
+
 // 纯函数：根据几何包围盒分割网格
 [[nodiscard]] std::vector<std::pair<Mesh, BoundingBox>>
 splitMeshByBounds(const Mesh& mesh, const BoundingBox& totalBounds,
                   const std::vector<BoundingBox>& subBounds);
 
-// 纯函数：构建地理 LOD 层次结构
+// 纯函数：构建地理 LOD 层次结构。配置了 tilingScheme 时忽略 region，
+// 节点区域均为方案中的瓦片，瓦片边界与数据集和运行无关
 [[nodiscard]] std::shared_ptr<GeoLodNode> 
 buildGeoLodHierarchy(const Mesh& inputMesh, const geo::GeoBBox& region, 
                      const LodConfig& config);
@@ -152,6 +320,12 @@ buildGeoLodHierarchy(const Mesh& inputMesh, const geo::GeoBBox& region,
 buildGeometricLodHierarchy(const Mesh& inputMesh, const BoundingBox& bounds,
                           const LodConfig& config);
 
+// 纯函数：在已有八叉树上构建几何 LOD（如由持久化索引恢复的八叉树），按配置选择自顶向下或自底向上；
+// 八叉树的三角形编号指向 inputMesh
+[[nodiscard]] std::shared_ptr<GeometricLodNode>
+buildGeometricLodHierarchy(const Mesh& inputMesh, const OctreeNode& octree,
+                          const LodConfig& config);
+
 // 纯函数：通用 LOD 构建（自动选择模式）
 [[nodiscard]] LodNode
 buildLodHierarchy(const Mesh& inputMesh, 
@@ -162,6 +336,38 @@ buildLodHierarchy(const Mesh& inputMesh,
 [[nodiscard]] std::shared_ptr<GeometricLodNode>
 buildOctreeLodHierarchy(const Mesh& inputMesh, const LodConfig& config);
 
+[[nodiscard]] std::shared_ptr<GeometricLodNode>
+buildOctreeLodHierarchy(const Mesh& inputMesh, const OctreeNode& octree, const LodConfig& config);
+
+// 纯函数：自底向上构建几何 LOD（每层只简化子节点合并后的网格，外部边界锁定）
+[[nodiscard]] std::shared_ptr<GeometricLodNode>
+buildBottomUpLodHierarchy(const Mesh& inputMesh, const LodConfig& config);
+
+[[nodiscard]] std::shared_ptr<GeometricLodNode>
+buildBottomUpLodHierarchy(const Mesh& inputMesh, const OctreeNode& octree, const LodConfig& config);
+
+// 自底向上增量构建的节点结果存储：按八叉树键保存重新构建的节点（添加裙边之前的网格与误差），
+// 下次构建时未变化的子树直接取回。store 会被兄弟节点并发调用，实现须线程安全
+class ILodNodeStore {
+public:
+    virtual ~ILodNodeStore() = default;
+    
+    // 取回键对应的整棵子树；缺失或损坏时返回空指针，该子树改为重新构建
+    virtual std::shared_ptr<GeometricLodNode> load(OctreeKey key) const = 0;
+    
+    // 保存一个重新构建的节点，childKeys 与 node.children 一一对应
+    virtual void store(OctreeKey key, const GeometricLodNode& node, std::span<const OctreeKey> childKeys) const = 0;
+    
+    // 删除键对应的节点结果：并入 LOD 叶节点的脏后代不再单独构建，旧结果已过期
+    virtual void erase(OctreeKey key) const = 0;
+};
+
+// 纯函数：在八叉树索引上自底向上构建。非脏节点的子树从 store 取回，只有脏节点（及取不回的子树）重新构建，
+// 并且只向 resolver 请求这些节点归属的源文件（构建前串行调用）；store 为空时全部重新构建
+[[nodiscard]] std::shared_ptr<GeometricLodNode>
+buildBottomUpLodHierarchy(const OctreeIndex& index, const SourceMeshResolver& resolver,
+                          const ILodNodeStore* store, const LodConfig& config);
+
 // 纯函数：合并相邻的地理 LOD 节点
 [[nodiscard]] std::shared_ptr<GeoLodNode> 
 mergeGeoLodNodes(std::span<const std::shared_ptr<GeoLodNode>> nodes);
@@ -180,7 +386,7 @@ struct GeoLodStats {
     geo::GeoBBox totalRegion;
 };
 
-[[nodiscard]] GeoLodStats computeGeoLodStats(const GeoLodNode& root) noexcept;
+[[nodiscard]] GeoLodStats computeGeoLodStats(const GeoLodNode& root);
 
 // 纯函数：计算几何 LOD 节点统计信息
 struct GeometricLodStats {
@@ -192,13 +398,13 @@ struct GeometricLodStats {
     BoundingBox totalBounds;
 };
 
-[[nodiscard]] GeometricLodStats computeGeometricLodStats(const GeometricLodNode& root) noexcept;
+[[nodiscard]] GeometricLodStats computeGeometricLodStats(const GeometricLodNode& root);
 
 // 通用 LOD 统计信息
 using LodStats = std::variant<GeoLodStats, GeometricLodStats>;
 
 // 纯函数：计算通用 LOD 统计
-[[nodiscard]] LodStats computeLodStats(const LodNode& root) noexcept;
+[[nodiscard]] LodStats computeLodStats(const LodNode& root);
 
 // 辅助函数：检测 LOD 模式
 [[nodiscard]] LodMode detectLodMode(const std::variant<geo::GeoBBox, BoundingBox>& bounds) noexcept;
@@ -0,0 +1,97 @@
+#include "LodTable.hpp"
+#include <algorithm>
+
+namespace lod::core {
+
+namespace {
+    const geo::GeoBBox& nodeBounds(const GeoLodNode& node) noexcept { return node.region; }
+    const BoundingBox& nodeBounds(const GeometricLodNode& node) noexcept { return node.bounds; }
+    
+    // BFS 展平：order 既是队列也是表中节点的顺序
+    template<typename Node, typename Bounds>
+    LodNodeTable<Bounds> flattenTree(const Node& root) {
+        LodNodeTable<Bounds> table;
+        std::vector<const Node*> order{&root};
+        
+        for (size_t i = 0; i < order.size(); ++i) {
+            const Node& node = *order[i];
+            const auto mesh = node.mesh.empty() ? kNoMesh : table.addMeshRef(node.mesh);
+            const auto index = table.addNode(nodeBounds(node), node.lodLevel, node.geometricError, mesh);
+            
+            const auto first = static_cast<LodNodeIndex>(order.size());
+            for (const auto& child : node.children) {
+                if (child) {
+                    order.push_back(child.get());
+                }
+            }
+            table.setChildren(index, first, static_cast<std::uint32_t>(order.size() - first));
+        }
+        
+        return table;
+    }
+    
+    template<typename Stats, typename Table>
+    void accumulateStats(Stats& stats, const Table& table) noexcept {
+        stats.totalNodes = table.size();
+        for (LodNodeIndex i = 0; i < table.size(); ++i) {
+            const int level = table.level(i);
+            const size_t triangles = table.hasMesh(i) ? table.mesh(i).triangleCount() : 0;
+            
+            if (table.isLeaf(i)) {
+                stats.leafNodes++;
+            }
+            stats.totalTriangles += triangles;
+            stats.maxDepth = std::max(stats.maxDepth, level);
+            
+            if (static_cast<int>(stats.trianglesPerLevel.size()) <= level) {
+                stats.trianglesPerLevel.resize(static_cast<size_t>(level) + 1, 0);
+            }
+            stats.trianglesPerLevel[level] += triangles;
+        }
+    }
+} // namespace
+
+GeoLodTable flattenLodTree(const GeoLodNode& root) {
+    return flattenTree<GeoLodNode, geo::GeoBBox>(root);
+}
+
+GeometricLodTable flattenLodTree(const GeometricLodNode& root) {
+    return flattenTree<GeometricLodNode, BoundingBox>(root);
+}
+
+LodTable flattenLodTree(const LodNode& root) {
+    return std::visit([](const auto& node) -> LodTable {
+        return flattenLodTree(node);
+    }, root);
+}
+
+GeoLodStats computeGeoLodStats(const GeoLodTable& table) {
+    GeoLodStats stats;
+    if (!table.empty()) {
+        stats.totalRegion = table.bounds(0);
+    }
+    accumulateStats(stats, table);
+    return stats;
+}
+
+GeometricLodStats computeGeometricLodStats(const GeometricLodTable& table) {
+    GeometricLodStats stats;
+    if (!table.empty()) {
+        stats.totalBounds = table.bounds(0);
+    }
+    accumulateStats(stats, table);
+    return stats;
+}
+
+LodStats computeLodStats(const LodTable& table) {
+    return std::visit([](const auto& t) -> LodStats {
+        using T = std::decay_t<decltype(t)>;
+        if constexpr (std::is_same_v<T, GeoLodTable>) {
+            return computeGeoLodStats(t);
+        } else {
+            return computeGeometricLodStats(t);
+        }
+    }, table);
+}
+
+} // namespace lod::core
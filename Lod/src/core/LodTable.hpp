@@ -0,0 +1,174 @@
+#pragma once
+
+#include "LodAlgorithm.hpp"
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <ranges>
+#include <span>
+#include <variant>
+#include <vector>
+
+namespace lod::core {
+
+using LodNodeIndex = std::uint32_t;
+using MeshHandle = std::uint32_t;
+
+inline constexpr MeshHandle kNoMesh = std::numeric_limits<MeshHandle>::max();
+
+// 扁平化 LOD 节点表：节点按 BFS 顺序编号，各字段按列（SoA）连续存储，
+// 同一父节点的子节点在表中相邻，由 firstChild/childCount 描述。
+// 遍历只做线性扫描，不再沿 shared_ptr 跳转
+template<typename Bounds>
+class LodNodeTable {
+public:
+    // 单个节点的只读视图
+    class NodeView {
+    public:
+        NodeView(const LodNodeTable& table, LodNodeIndex index) noexcept
+            : table_(&table), index_(index) {}
+        
+        LodNodeIndex index() const noexcept { return index_; }
+        const Bounds& bounds() const noexcept { return table_->bounds(index_); }
+        int level() const noexcept { return table_->level(index_); }
+        double geometricError() const noexcept { return table_->geometricError(index_); }
+        bool isLeaf() const noexcept { return table_->isLeaf(index_); }
+        bool hasMesh() const noexcept { return table_->hasMesh(index_); }
+        const Mesh& mesh() const noexcept { return table_->mesh(index_); }
+        auto children() const noexcept { return table_->children(index_); }
+    
+    private:
+        const LodNodeTable* table_;
+        LodNodeIndex index_;
+    };
+    
+    // BFS 顺序迭代器
+    class Iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = NodeView;
+        using difference_type = std::ptrdiff_t;
+        
+        Iterator() = default;
+        Iterator(const LodNodeTable& table, LodNodeIndex index) noexcept : table_(&table), index_(index) {}
+        
+        NodeView operator*() const noexcept { return NodeView{*table_, index_}; }
+        Iterator& operator++() noexcept { ++index_; return *this; }
+        Iterator operator++(int) noexcept { auto copy = *this; ++index_; return copy; }
+        bool operator==(const Iterator& other) const noexcept { return index_ == other.index_; }
+    
+    private:
+        const LodNodeTable* table_{nullptr};
+        LodNodeIndex index_{0};
+    };
+    
+    // 构建
+    void reserve(size_t nodeCount) {
+        bounds_.reserve(nodeCount);
+        levels_.reserve(nodeCount);
+        errors_.reserve(nodeCount);
+        firstChild_.reserve(nodeCount);
+        childCount_.reserve(nodeCount);
+        meshHandles_.reserve(nodeCount);
+    }
+    
+    LodNodeIndex addNode(const Bounds& bounds, int level, double geometricError, MeshHandle mesh = kNoMesh) {
+        const auto index = static_cast<LodNodeIndex>(bounds_.size());
+        bounds_.push_back(bounds);
+        levels_.push_back(level);
+        errors_.push_back(geometricError);
+        firstChild_.push_back(0);
+        childCount_.push_back(0);
+        meshHandles_.push_back(mesh);
+        return index;
+    }
+    
+    // 子节点必须是 [first, first + count) 的连续区间
+    void setChildren(LodNodeIndex parent, LodNodeIndex first, std::uint32_t count) noexcept {
+        firstChild_[parent] = first;
+        childCount_[parent] = count;
+    }
+    
+    // 表自身持有的网格（拷贝表时共享）
+    MeshHandle addMesh(Mesh mesh) {
+        meshes_.push_back(std::make_shared<const Mesh>(std::move(mesh)));
+        return static_cast<MeshHandle>(meshes_.size() - 1);
+    }
+    
+    // 引用外部网格（须比表存活更久）
+    MeshHandle addMeshRef(const Mesh& mesh) {
+        meshes_.push_back(std::shared_ptr<const Mesh>(std::shared_ptr<const Mesh>{}, &mesh));
+        return static_cast<MeshHandle>(meshes_.size() - 1);
+    }
+    
+    // 查询
+    size_t size() const noexcept { return bounds_.size(); }
+    bool empty() const noexcept { return bounds_.empty(); }
+    
+    const Bounds& bounds(LodNodeIndex i) const noexcept { return bounds_[i]; }
+    int level(LodNodeIndex i) const noexcept { return levels_[i]; }
+    double geometricError(LodNodeIndex i) const noexcept { return errors_[i]; }
+    LodNodeIndex firstChild(LodNodeIndex i) const noexcept { return firstChild_[i]; }
+    std::uint32_t childCount(LodNodeIndex i) const noexcept { return childCount_[i]; }
+    bool isLeaf(LodNodeIndex i) const noexcept { return childCount_[i] == 0; }
+    MeshHandle meshHandle(LodNodeIndex i) const noexcept { return meshHandles_[i]; }
+    bool hasMesh(LodNodeIndex i) const noexcept { return meshHandles_[i] != kNoMesh; }
+    const Mesh& mesh(LodNodeIndex i) const noexcept { return *meshes_[meshHandles_[i]]; }
+    
+    auto children(LodNodeIndex i) const noexcept {
+        return std::views::iota(firstChild_[i], firstChild_[i] + childCount_[i]);
+    }
+    
+    // 整列访问，便于向量化统计
+    std::span<const Bounds> boundsColumn() const noexcept { return bounds_; }
+    std::span<const int> levelColumn() const noexcept { return levels_; }
+    std::span<const double> errorColumn() const noexcept { return errors_; }
+    std::span<const std::uint32_t> childCountColumn() const noexcept { return childCount_; }
+    
+    NodeView node(LodNodeIndex i) const noexcept { return NodeView{*this, i}; }
+    Iterator begin() const noexcept { return Iterator{*this, 0}; }
+    Iterator end() const noexcept { return Iterator{*this, static_cast<LodNodeIndex>(size())}; }
+    
+    // 访问器：BFS 顺序（父节点先于子节点）
+    template<typename Visitor>
+    void forEach(Visitor&& visitor) const {
+        for (LodNodeIndex i = 0; i < size(); ++i) {
+            visitor(NodeView{*this, i});
+        }
+    }
+    
+    // 访问器：逆 BFS 顺序（子节点先于父节点），用于自底向上汇总
+    template<typename Visitor>
+    void forEachBottomUp(Visitor&& visitor) const {
+        for (auto i = static_cast<LodNodeIndex>(size()); i-- > 0;) {
+            visitor(NodeView{*this, i});
+        }
+    }
+
+private:
+    std::vector<Bounds> bounds_;
+    std::vector<int> levels_;
+    std::vector<double> errors_;
+    std::vector<LodNodeIndex> firstChild_;
+    std::vector<std::uint32_t> childCount_;
+    std::vector<MeshHandle> meshHandles_;
+    
+    std::vector<std::shared_ptr<const Mesh>> meshes_;  // 句柄 -> 网格；外部引用使用空所有者
+};
+
+using GeoLodTable = LodNodeTable<geo::GeoBBox>;
+using GeometricLodTable = LodNodeTable<BoundingBox>;
+using LodTable = std::variant<GeoLodTable, GeometricLodTable>;
+
+// 纯函数：把 shared_ptr 树展平为节点表（网格以引用方式登记，树须比表存活更久）
+[[nodiscard]] GeoLodTable flattenLodTree(const GeoLodNode& root);
+[[nodiscard]] GeometricLodTable flattenLodTree(const GeometricLodNode& root);
+[[nodiscard]] LodTable flattenLodTree(const LodNode& root);
+
+// 纯函数：基于节点表的统计（线性扫描）
+[[nodiscard]] GeoLodStats computeGeoLodStats(const GeoLodTable& table);
+[[nodiscard]] GeometricLodStats computeGeometricLodStats(const GeometricLodTable& table);
+[[nodiscard]] LodStats computeLodStats(const LodTable& table);
+
+} // namespace lod::core
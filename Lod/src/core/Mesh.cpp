@@ -54,6 +54,9 @@ Mesh Mesh::subset(std::span<const Index> triangleIndices) const {
             if (oldIndex < vertices_.colors.size()) {
                 newVertices.colors.push_back(vertices_.colors[oldIndex]);
             }
+            if (oldIndex < vertices_.geoCoords.size()) {
+                newVertices.geoCoords.push_back(vertices_.geoCoords[oldIndex]);
+            }
         }
     }
     
@@ -120,6 +123,8 @@ Mesh Mesh::merge(std::span<const Mesh> meshes) {
                                        vertices.texCoords.begin(), vertices.texCoords.end());
         mergedVertices.colors.insert(mergedVertices.colors.end(),
                                     vertices.colors.begin(), vertices.colors.end());
+        mergedVertices.geoCoords.insert(mergedVertices.geoCoords.end(),
+                                       vertices.geoCoords.begin(), vertices.geoCoords.end());
         
         // 复制索引（需要加上偏移）
         std::transform(indices.begin(), indices.end(), std::back_inserter(mergedIndices),
@@ -12,6 +12,7 @@ using Vertex = std::array<float, 3>;
 using Normal = std::array<float, 3>;
 using TexCoord = std::array<float, 2>;
 using Color = std::array<uint8_t, 4>;
+using GeoCoord = std::array<double, 3>;  // WGS84 经度、纬度（度）与椭球高（米）
 using Index = uint32_t;
 
 // 顶点属性集合
@@ -20,6 +21,7 @@ struct VertexAttributes {
     std::vector<Normal> normals;
     std::vector<TexCoord> texCoords;
     std::vector<Color> colors;
+    std::vector<GeoCoord> geoCoords;  // 可选：地理模式下由读取器一次性换算的大地坐标缓存
     
     constexpr size_t size() const noexcept { return positions.size(); }
     constexpr bool empty() const noexcept { return positions.empty(); }
@@ -29,6 +31,7 @@ struct VertexAttributes {
         normals.reserve(count);
         texCoords.reserve(count);
         colors.reserve(count);
+        geoCoords.reserve(count);
     }
     
     void clear() noexcept {
@@ -36,6 +39,7 @@ struct VertexAttributes {
         normals.clear();
         texCoords.clear();
         colors.clear();
+        geoCoords.clear();
     }
 };
 
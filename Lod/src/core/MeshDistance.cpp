@@ -0,0 +1,254 @@
+#include "MeshDistance.hpp"
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_reduce.h>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+
+namespace lod::core {
+
+namespace {
+    constexpr std::uint32_t kLeafSize = 4;
+    
+    using Vec3d = std::array<double, 3>;
+    
+    Vec3d toDouble(const Vertex& v) noexcept {
+        return {v[0], v[1], v[2]};
+    }
+    
+    Vec3d sub(const Vec3d& a, const Vec3d& b) noexcept {
+        return {a[0] - b[0], a[1] - b[1], a[2] - b[2]};
+    }
+    
+    double dot(const Vec3d& a, const Vec3d& b) noexcept {
+        return a[0] * b[0] + a[1] * b[1] + a[2] * b[2];
+    }
+    
+    double distanceSquared(const Vec3d& p, const Vec3d& q) noexcept {
+        const auto d = sub(p, q);
+        return dot(d, d);
+    }
+    
+    // 点到三角形的最近距离平方（按 Voronoi 区域分类）
+    double pointTriangleDistanceSquared(const Vec3d& p, const std::array<Vertex, 3>& triangle) noexcept {
+        const auto a = toDouble(triangle[0]);
+        const auto b = toDouble(triangle[1]);
+        const auto c = toDouble(triangle[2]);
+        const auto ab = sub(b, a);
+        const auto ac = sub(c, a);
+        const auto ap = sub(p, a);
+        
+        const double d1 = dot(ab, ap);
+        const double d2 = dot(ac, ap);
+        if (d1 <= 0.0 && d2 <= 0.0) {
+            return distanceSquared(p, a);
+        }
+        
+        const auto bp = sub(p, b);
+        const double d3 = dot(ab, bp);
+        const double d4 = dot(ac, bp);
+        if (d3 >= 0.0 && d4 <= d3) {
+            return distanceSquared(p, b);
+        }
+        
+        const double vc = d1 * d4 - d3 * d2;
+        if (vc <= 0.0 && d1 >= 0.0 && d3 <= 0.0) {
+            const double v = d1 / (d1 - d3);
+            return distanceSquared(p, {a[0] + v * ab[0], a[1] + v * ab[1], a[2] + v * ab[2]});
+        }
+        
+        const auto cp = sub(p, c);
+        const double d5 = dot(ab, cp);
+        const double d6 = dot(ac, cp);
+        if (d6 >= 0.0 && d5 <= d6) {
+            return distanceSquared(p, c);
+        }
+        
+        const double vb = d5 * d2 - d1 * d6;
+        if (vb <= 0.0 && d2 >= 0.0 && d6 <= 0.0) {
+            const double w = d2 / (d2 - d6);
+            return distanceSquared(p, {a[0] + w * ac[0], a[1] + w * ac[1], a[2] + w * ac[2]});
+        }
+        
+        const double va = d3 * d6 - d5 * d4;
+        if (va <= 0.0 && (d4 - d3) >= 0.0 && (d5 - d6) >= 0.0) {
+            const double w = (d4 - d3) / ((d4 - d3) + (d5 - d6));
+            return distanceSquared(p, {b[0] + w * (c[0] - b[0]), b[1] + w * (c[1] - b[1]), b[2] + w * (c[2] - b[2])});
+        }
+        
+        // 投影落在三角形内部
+        const double denom = va + vb + vc;
+        if (denom <= 0.0) {
+            // 退化三角形：退回到顶点距离
+            return std::min({distanceSquared(p, a), distanceSquared(p, b), distanceSquared(p, c)});
+        }
+        const double v = vb / denom;
+        const double w = vc / denom;
+        return distanceSquared(p, {a[0] + ab[0] * v + ac[0] * w,
+                                   a[1] + ab[1] * v + ac[1] * w,
+                                   a[2] + ab[2] * v + ac[2] * w});
+    }
+    
+    double boxDistanceSquared(const Vec3d& p, const BoundingBox& box) noexcept {
+        double result = 0.0;
+        for (int axis = 0; axis < 3; ++axis) {
+            const double d = std::max({static_cast<double>(box.min[axis]) - p[axis], 0.0,
+                                       p[axis] - static_cast<double>(box.max[axis])});
+            result += d * d;
+        }
+        return result;
+    }
+    
+    BoundingBox triangleBounds(const std::array<Vertex, 3>& triangle) noexcept {
+        BoundingBox box(triangle[0], triangle[0]);
+        for (int axis = 0; axis < 3; ++axis) {
+            box.min[axis] = std::min({triangle[0][axis], triangle[1][axis], triangle[2][axis]});
+            box.max[axis] = std::max({triangle[0][axis], triangle[1][axis], triangle[2][axis]});
+        }
+        return box;
+    }
+} // namespace
+
+TriangleBvh::TriangleBvh(const Mesh& mesh) {
+    const auto& positions = mesh.vertices().positions;
+    const auto& indices = mesh.indices();
+    
+    triangles_.reserve(mesh.triangleCount());
+    for (size_t i = 0; i + 2 < indices.size(); i += 3) {
+        triangles_.push_back({positions[indices[i]], positions[indices[i + 1]], positions[indices[i + 2]]});
+    }
+    if (triangles_.empty()) {
+        return;
+    }
+    
+    std::vector<Vertex> centroids(triangles_.size());
+    std::transform(triangles_.begin(), triangles_.end(), centroids.begin(), [](const auto& t) {
+        return Vertex{(t[0][0] + t[1][0] + t[2][0]) / 3.0f,
+                      (t[0][1] + t[1][1] + t[2][1]) / 3.0f,
+                      (t[0][2] + t[1][2] + t[2][2]) / 3.0f};
+    });
+    
+    nodes_.reserve(2 * triangles_.size() / kLeafSize + 1);
+    buildNode(0, static_cast<std::uint32_t>(triangles_.size()), centroids);
+}
+
+// 按重心沿最长轴中位数划分；三角形与重心在划分时同步重排
+std::uint32_t TriangleBvh::buildNode(std::uint32_t first, std::uint32_t count, std::vector<Vertex>& centroids) {
+    const auto index = static_cast<std::uint32_t>(nodes_.size());
+    nodes_.emplace_back();
+    
+    BoundingBox bounds = triangleBounds(triangles_[first]);
+    BoundingBox centroidBounds(centroids[first], centroids[first]);
+    for (std::uint32_t i = first + 1; i < first + count; ++i) {
+        bounds = bounds.unite(triangleBounds(triangles_[i]));
+        centroidBounds = centroidBounds.unite(BoundingBox(centroids[i], centroids[i]));
+    }
+    nodes_[index].bounds = bounds;
+    
+    const auto extent = centroidBounds.size();
+    const int axis = static_cast<int>(std::max_element(extent.begin(), extent.end()) - extent.begin());
+    
+    if (count <= kLeafSize || extent[axis] <= 0.0f) {
+        nodes_[index].first = first;
+        nodes_[index].count = count;
+        return index;
+    }
+    
+    // 对下标排序后按同一顺序重排两个数组
+    std::vector<std::uint32_t> order(count);
+    std::iota(order.begin(), order.end(), first);
+    const auto middle = order.begin() + count / 2;
+    std::nth_element(order.begin(), middle, order.end(), [&](std::uint32_t a, std::uint32_t b) {
+        return centroids[a][axis] < centroids[b][axis];
+    });
+    
+    std::vector<std::array<Vertex, 3>> triangles(count);
+    std::vector<Vertex> sortedCentroids(count);
+    for (std::uint32_t i = 0; i < count; ++i) {
+        triangles[i] = triangles_[order[i]];
+        sortedCentroids[i] = centroids[order[i]];
+    }
+    std::copy(triangles.begin(), triangles.end(), triangles_.begin() + first);
+    std::copy(sortedCentroids.begin(), sortedCentroids.end(), centroids.begin() + first);
+    
+    const std::uint32_t leftCount = count / 2;
+    buildNode(first, leftCount, centroids);
+    const auto right = buildNode(first + leftCount, count - leftCount, centroids);
+    nodes_[index].rightChild = right;
+    return index;
+}
+
+double TriangleBvh::closestDistanceSquared(const Vertex& point) const noexcept {
+    double best = std::numeric_limits<double>::infinity();
+    if (nodes_.empty()) {
+        return best;
+    }
+    
+    const auto p = toDouble(point);
+    std::array<std::uint32_t, 64> stack;
+    size_t stackSize = 0;
+    stack[stackSize++] = 0;
+    
+    while (stackSize > 0) {
+        const auto& node = nodes_[stack[--stackSize]];
+        if (boxDistanceSquared(p, node.bounds) >= best) {
+            continue;
+        }
+        
+        if (node.count > 0) {
+            for (std::uint32_t i = node.first; i < node.first + node.count; ++i) {
+                best = std::min(best, pointTriangleDistanceSquared(p, triangles_[i]));
+            }
+            continue;
+        }
+        
+        // 先访问较近的子节点（后入栈先出）
+        const auto left = static_cast<std::uint32_t>(&node - nodes_.data()) + 1;
+        const auto right = node.rightChild;
+        const bool leftFirst = boxDistanceSquared(p, nodes_[left].bounds) <= boxDistanceSquared(p, nodes_[right].bounds);
+        stack[stackSize++] = leftFirst ? right : left;
+        stack[stackSize++] = leftFirst ? left : right;
+    }
+    
+    return best;
+}
+
+double sampledHausdorffDistance(const Mesh& from, const TriangleBvh& to, size_t maxSamples) {
+    if (from.empty() || to.empty() || maxSamples == 0) {
+        return 0.0;
+    }
+    
+    const auto& positions = from.vertices().positions;
+    const auto& indices = from.indices();
+    const size_t vertexCount = positions.size();
+    const size_t candidateCount = vertexCount + from.triangleCount();
+    const size_t stride = (candidateCount + maxSamples - 1) / maxSamples;
+    const size_t sampleCount = (candidateCount + stride - 1) / stride;
+    
+    // 第 i 个候选点：先是全部顶点，然后是各三角形重心
+    const auto samplePoint = [&](size_t i) -> Vertex {
+        if (i < vertexCount) {
+            return positions[i];
+        }
+        const size_t base = (i - vertexCount) * 3;
+        const auto& a = positions[indices[base]];
+        const auto& b = positions[indices[base + 1]];
+        const auto& c = positions[indices[base + 2]];
+        return {(a[0] + b[0] + c[0]) / 3.0f, (a[1] + b[1] + c[1]) / 3.0f, (a[2] + b[2] + c[2]) / 3.0f};
+    };
+    
+    const double maxDistanceSquared = tbb::parallel_reduce(
+        tbb::blocked_range<size_t>(0, sampleCount), 0.0,
+        [&](const tbb::blocked_range<size_t>& range, double current) {
+            for (size_t s = range.begin(); s != range.end(); ++s) {
+                current = std::max(current, to.closestDistanceSquared(samplePoint(s * stride)));
+            }
+            return current;
+        },
+        [](double a, double b) { return std::max(a, b); });
+    
+    return std::sqrt(maxDistanceSquared);
+}
+
+} // namespace lod::core
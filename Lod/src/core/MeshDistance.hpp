@@ -0,0 +1,42 @@
+#pragma once
+
+#include "Geometry.hpp"
+#include "Mesh.hpp"
+#include <cstdint>
+#include <vector>
+
+namespace lod::core {
+
+// 三角形 BVH：用于点到网格表面的最近距离查询（只读，可多线程并发查询）
+class TriangleBvh {
+public:
+    TriangleBvh() = default;
+    explicit TriangleBvh(const Mesh& mesh);
+    
+    // 点到网格表面的最近距离的平方；空 BVH 返回无穷大
+    [[nodiscard]] double closestDistanceSquared(const Vertex& point) const noexcept;
+    
+    [[nodiscard]] bool empty() const noexcept { return triangles_.empty(); }
+    [[nodiscard]] size_t triangleCount() const noexcept { return triangles_.size(); }
+    [[nodiscard]] BoundingBox bounds() const noexcept { return nodes_.empty() ? BoundingBox{} : nodes_.front().bounds; }
+
+private:
+    // 节点按深度优先顺序存储：左子节点紧随父节点，右子节点由 rightChild 给出
+    struct Node {
+        BoundingBox bounds;
+        std::uint32_t first{0};       // 叶节点：三角形起始位置
+        std::uint32_t count{0};       // 叶节点三角形数量，0 表示内部节点
+        std::uint32_t rightChild{0};
+    };
+    
+    std::uint32_t buildNode(std::uint32_t first, std::uint32_t count, std::vector<Vertex>& centroids);
+    
+    std::vector<Node> nodes_;
+    std::vector<std::array<Vertex, 3>> triangles_;
+};
+
+// 纯函数：采样单向 Hausdorff 距离 max_{p∈from} d(p, to)，
+// 采样点为 from 的顶点与三角形重心，超过 maxSamples 时等间隔抽取；并行计算
+[[nodiscard]] double sampledHausdorffDistance(const Mesh& from, const TriangleBvh& to, size_t maxSamples = 65536);
+
+} // namespace lod::core
@@ -0,0 +1,398 @@
+#include "OctreeIndex.hpp"
+#include <algorithm>
+#include <iterator>
+#include <numeric>
+#include <optional>
+
+namespace lod::core {
+
+namespace {
+    std::array<Vertex, 3> triangleVertices(const Mesh& mesh, Index triIdx) noexcept {
+        const auto& positions = mesh.vertices().positions;
+        const auto& indices = mesh.indices();
+        return {
+            positions[indices[triIdx * 3]],
+            positions[indices[triIdx * 3 + 1]],
+            positions[indices[triIdx * 3 + 2]]
+        };
+    }
+
+    std::optional<BoundingBox> trianglesBounds(const Mesh& mesh, std::span<const Index> triangles) {
+        std::optional<BoundingBox> result;
+        for (const auto triIdx : triangles) {
+            const auto triBounds = computeTriangleBounds(triangleVertices(mesh, triIdx));
+            result = result ? result->unite(triBounds) : triBounds;
+        }
+        return result;
+    }
+
+    // 把三角形合并进节点中对应源文件的区间列表
+    void appendSourceTriangles(OctreeIndexNode& node, SourceId sourceId, std::span<const Index> triangles) {
+        auto it = std::lower_bound(node.sources.begin(), node.sources.end(), sourceId,
+                                   [](const SourceTriangleRanges& s, SourceId id) { return s.sourceId < id; });
+        if (it == node.sources.end() || it->sourceId != sourceId) {
+            it = node.sources.insert(it, SourceTriangleRanges{sourceId, {}});
+        }
+
+        auto merged = expandTriangleRanges(it->ranges);
+        merged.insert(merged.end(), triangles.begin(), triangles.end());
+        std::sort(merged.begin(), merged.end());
+        merged.erase(std::unique(merged.begin(), merged.end()), merged.end());
+        it->ranges = compressTriangleRanges(merged);
+    }
+} // namespace
+
+std::vector<TriangleRange> compressTriangleRanges(std::span<const Index> sortedTriangles) {
+    std::vector<TriangleRange> ranges;
+    for (const auto triIdx : sortedTriangles) {
+        if (!ranges.empty() && ranges.back().first + ranges.back().count == triIdx) {
+            ++ranges.back().count;
+        } else {
+            ranges.push_back({triIdx, 1});
+        }
+    }
+    return ranges;
+}
+
+std::vector<Index> expandTriangleRanges(std::span<const TriangleRange> ranges) {
+    std::vector<Index> triangles;
+    for (const auto& range : ranges) {
+        for (Index i = 0; i < range.count; ++i) {
+            triangles.push_back(range.first + i);
+        }
+    }
+    return triangles;
+}
+
+OctreeIndex OctreeIndex::build(std::span<const Mesh> sources, const OctreeConfig& config) {
+    std::vector<size_t> triangleCounts;
+    triangleCounts.reserve(sources.size());
+    for (const auto& source : sources) {
+        triangleCounts.push_back(source.triangleCount());
+    }
+
+    const auto merged = Mesh::merge(sources);
+    auto octree = buildOctree(merged, config);
+    if (!octree) {
+        return OctreeIndex{config};
+    }
+    return fromOctree(*octree, triangleCounts, config);
+}
+
+OctreeIndex OctreeIndex::fromOctree(const OctreeNode& root,
+                                    std::span<const size_t> sourceTriangleCounts,
+                                    const OctreeConfig& config) {
+    // 合并网格中每个源文件的起始三角形编号
+    std::vector<size_t> offsets(sourceTriangleCounts.size() + 1, 0);
+    for (size_t i = 0; i < sourceTriangleCounts.size(); ++i) {
+        offsets[i + 1] = offsets[i] + sourceTriangleCounts[i];
+    }
+
+    OctreeIndex index{config};
+
+    std::function<void(const OctreeNode&, OctreeKey)> convert = [&](const OctreeNode& node, OctreeKey key) {
+        OctreeIndexNode indexNode;
+        indexNode.key = key;
+        indexNode.bounds = node.bounds;
+        indexNode.tightBounds = node.tightBounds;
+
+        auto triangles = node.triangleIndices;
+        std::sort(triangles.begin(), triangles.end());
+
+        // 按源文件切分已排序的全局编号
+        auto begin = triangles.begin();
+        while (begin != triangles.end()) {
+            const auto source = static_cast<size_t>(
+                std::upper_bound(offsets.begin(), offsets.end(), static_cast<size_t>(*begin)) - offsets.begin() - 1);
+            const auto end = std::lower_bound(begin, triangles.end(), static_cast<Index>(offsets[source + 1]));
+
+            std::vector<Index> local;
+            local.reserve(static_cast<size_t>(std::distance(begin, end)));
+            for (auto it = begin; it != end; ++it) {
+                local.push_back(static_cast<Index>(*it - offsets[source]));
+            }
+            indexNode.sources.push_back({static_cast<SourceId>(source), compressTriangleRanges(local)});
+            begin = end;
+        }
+
+        index.nodes_.emplace(key, std::move(indexNode));
+
+        for (int i = 0; i < 8; ++i) {
+            if (node.children[i]) {
+                convert(*node.children[i], childOctreeKey(key, i));
+            }
+        }
+    };
+
+    convert(root, kRootOctreeKey);
+    return index;
+}
+
+OctreeIndex OctreeIndex::fromNodes(OctreeConfig config, std::vector<OctreeIndexNode> nodes) {
+    OctreeIndex index{std::move(config)};
+    for (auto& node : nodes) {
+        const auto key = node.key;
+        index.nodes_.insert_or_assign(key, std::move(node));
+    }
+    return index;
+}
+
+std::unique_ptr<OctreeNode> OctreeIndex::toOctree(std::span<const size_t> sourceTriangleCounts) const {
+    const auto* rootNode = find(kRootOctreeKey);
+    if (!rootNode) {
+        return nullptr;
+    }
+
+    std::vector<size_t> offsets(sourceTriangleCounts.size() + 1, 0);
+    for (size_t i = 0; i < sourceTriangleCounts.size(); ++i) {
+        offsets[i + 1] = offsets[i] + sourceTriangleCounts[i];
+    }
+
+    std::function<std::unique_ptr<OctreeNode>(const OctreeIndexNode&)> convert =
+        [&](const OctreeIndexNode& indexNode) {
+        auto node = std::make_unique<OctreeNode>();
+        node->bounds = indexNode.bounds;
+        node->tightBounds = indexNode.tightBounds;
+        node->depth = octreeKeyDepth(indexNode.key);
+
+        // sources 按编号升序，换算后的全局编号同样升序
+        for (const auto& source : indexNode.sources) {
+            if (source.sourceId >= sourceTriangleCounts.size()) {
+                continue;
+            }
+            for (const auto& range : source.ranges) {
+                for (Index i = 0; i < range.count; ++i) {
+                    node->triangleIndices.push_back(static_cast<Index>(offsets[source.sourceId] + range.first + i));
+                }
+            }
+        }
+
+        for (int i = 0; i < 8; ++i) {
+            if (const auto* child = find(childOctreeKey(indexNode.key, i))) {
+                node->children[i] = convert(*child);
+            }
+        }
+        return node;
+    };
+
+    return convert(*rootNode);
+}
+
+void OctreeIndex::markDirty(OctreeKey key) {
+    for (; key != 0; key = parentOctreeKey(key)) {
+        if (auto it = nodes_.find(key); it != nodes_.end()) {
+            it->second.dirty = true;
+        }
+    }
+}
+
+void OctreeIndex::removeSource(SourceId sourceId) {
+    for (auto& [key, node] : nodes_) {
+        auto it = std::find_if(node.sources.begin(), node.sources.end(),
+                               [&](const SourceTriangleRanges& s) { return s.sourceId == sourceId; });
+        if (it != node.sources.end()) {
+            node.sources.erase(it);
+            markDirty(key);
+        }
+    }
+
+    // 自底向上裁剪变空的叶节点（键越大越深，逆序即先处理子节点）
+    for (auto it = nodes_.rbegin(); it != nodes_.rend();) {
+        const auto key = it->first;
+        if (key != kRootOctreeKey && it->second.sources.empty() && isLeaf(key)) {
+            it = std::make_reverse_iterator(nodes_.erase(std::next(it).base()));
+            markDirty(parentOctreeKey(key));
+        } else {
+            ++it;
+        }
+    }
+}
+
+void OctreeIndex::insertSource(SourceId sourceId, const Mesh& mesh) {
+    if (mesh.triangleCount() == 0) {
+        return;
+    }
+
+    std::vector<Index> triangles(mesh.triangleCount());
+    std::iota(triangles.begin(), triangles.end(), Index{0});
+
+    if (nodes_.empty()) {
+        OctreeIndexNode root;
+        root.bounds = trianglesBounds(mesh, triangles).value_or(BoundingBox{});
+        root.tightBounds = root.bounds;
+        nodes_.emplace(kRootOctreeKey, std::move(root));
+    }
+
+    insertTriangles(kRootOctreeKey, sourceId, mesh, std::move(triangles));
+}
+
+void OctreeIndex::insertTriangles(OctreeKey key, SourceId sourceId, const Mesh& mesh, std::vector<Index> triangles) {
+    auto& node = nodes_.at(key);
+    node.dirty = true;
+    if (auto bounds = trianglesBounds(mesh, triangles)) {
+        node.tightBounds = node.triangleCount() == 0 && isLeaf(key) ? *bounds : node.tightBounds.unite(*bounds);
+    }
+
+    // 只沿已有子节点下放；落不进任何子节点的三角形留在当前节点
+    std::vector<OctreeKey> childKeys;
+    std::vector<BoundingBox> childBounds;
+    for (int i = 0; i < 8; ++i) {
+        const auto childKey = childOctreeKey(key, i);
+        if (auto it = nodes_.find(childKey); it != nodes_.end()) {
+            childKeys.push_back(childKey);
+            childBounds.push_back(it->second.bounds);
+        }
+    }
+
+    if (childKeys.empty()) {
+        appendSourceTriangles(node, sourceId, triangles);
+        return;
+    }
+
+    std::vector<std::vector<Index>> buckets(childKeys.size());
+    std::vector<Index> kept;
+
+    if (config_.looseOctree) {
+        for (const auto triIdx : triangles) {
+            const auto triBounds = computeTriangleBounds(triangleVertices(mesh, triIdx));
+            const auto center = triBounds.center();
+            auto it = std::find_if(childBounds.begin(), childBounds.end(),
+                                   [&](const BoundingBox& child) { return child.contains(center); });
+            const auto childIdx = static_cast<size_t>(std::distance(childBounds.begin(), it));
+            if (it != childBounds.end() && it->expanded(config_.looseness).containsBox(triBounds)) {
+                buckets[childIdx].push_back(triIdx);
+            } else {
+                kept.push_back(triIdx);
+            }
+        }
+    } else {
+        buckets = bucketTrianglesByBounds(mesh, triangles, childBounds);
+
+        // triangles 始终升序（根为 iota，分桶保持原顺序），与已分配编号做差集即得留在本节点的三角形；
+        // 只与本节点的三角形数量成正比，不随整个网格增长
+        std::vector<Index> assigned;
+        for (const auto& bucket : buckets) {
+            assigned.insert(assigned.end(), bucket.begin(), bucket.end());
+        }
+        std::sort(assigned.begin(), assigned.end());
+        assigned.erase(std::unique(assigned.begin(), assigned.end()), assigned.end());
+        std::set_difference(triangles.begin(), triangles.end(), assigned.begin(), assigned.end(),
+                            std::back_inserter(kept));
+    }
+
+    if (!kept.empty()) {
+        appendSourceTriangles(node, sourceId, kept);
+    }
+
+    for (size_t i = 0; i < childKeys.size(); ++i) {
+        if (!buckets[i].empty()) {
+            insertTriangles(childKeys[i], sourceId, mesh, std::move(buckets[i]));
+        }
+    }
+}
+
+void OctreeIndex::refitDirtyBounds(const SourceMeshResolver& resolver) {
+    for (auto it = nodes_.rbegin(); it != nodes_.rend(); ++it) {
+        auto& node = it->second;
+        if (!node.dirty) {
+            continue;
+        }
+
+        std::optional<BoundingBox> tight;
+        for (const auto& source : node.sources) {
+            const Mesh* mesh = resolver(source.sourceId);
+            if (!mesh) {
+                continue;
+            }
+            const auto triangles = expandTriangleRanges(source.ranges);
+            if (auto bounds = trianglesBounds(*mesh, triangles)) {
+                tight = tight ? tight->unite(*bounds) : *bounds;
+            }
+        }
+        for (int i = 0; i < 8; ++i) {
+            if (const auto* child = find(childOctreeKey(it->first, i))) {
+                tight = tight ? tight->unite(child->tightBounds) : child->tightBounds;
+            }
+        }
+
+        node.tightBounds = tight.value_or(node.bounds);
+    }
+}
+
+Mesh OctreeIndex::gatherMesh(OctreeKey key, const SourceMeshResolver& resolver) const {
+    std::map<SourceId, std::vector<Index>> perSource;
+    traverseSubtree(key, [&](const OctreeIndexNode& node) {
+        for (const auto& source : node.sources) {
+            auto triangles = expandTriangleRanges(source.ranges);
+            auto& target = perSource[source.sourceId];
+            target.insert(target.end(), triangles.begin(), triangles.end());
+        }
+    });
+
+    std::vector<Mesh> parts;
+    parts.reserve(perSource.size());
+    for (auto& [sourceId, triangles] : perSource) {
+        const Mesh* mesh = resolver(sourceId);
+        if (!mesh) {
+            continue;
+        }
+        std::sort(triangles.begin(), triangles.end());
+        triangles.erase(std::unique(triangles.begin(), triangles.end()), triangles.end());
+        parts.push_back(mesh->subset(triangles));
+    }
+
+    return parts.size() == 1 ? std::move(parts.front()) : Mesh::merge(parts);
+}
+
+std::vector<SourceId> OctreeIndex::sourcesInSubtree(OctreeKey key) const {
+    std::vector<SourceId> result;
+    traverseSubtree(key, [&](const OctreeIndexNode& node) {
+        for (const auto& source : node.sources) {
+            result.push_back(source.sourceId);
+        }
+    });
+    std::sort(result.begin(), result.end());
+    result.erase(std::unique(result.begin(), result.end()), result.end());
+    return result;
+}
+
+std::vector<OctreeKey> OctreeIndex::dirtyKeys() const {
+    std::vector<OctreeKey> keys;
+    for (const auto& [key, node] : nodes_) {
+        if (node.dirty) {
+            keys.push_back(key);
+        }
+    }
+    return keys;
+}
+
+void OctreeIndex::clearDirty() noexcept {
+    for (auto& [key, node] : nodes_) {
+        node.dirty = false;
+    }
+}
+
+void OctreeIndex::markAllDirty() noexcept {
+    for (auto& [key, node] : nodes_) {
+        node.dirty = true;
+    }
+}
+
+size_t OctreeIndex::overfullLeafCount() const {
+    return static_cast<size_t>(std::count_if(nodes_.begin(), nodes_.end(), [&](const auto& entry) {
+        return isLeaf(entry.first) && entry.second.triangleCount() > config_.maxTrianglesPerNode;
+    }));
+}
+
+const OctreeIndexNode* OctreeIndex::find(OctreeKey key) const {
+    auto it = nodes_.find(key);
+    return it != nodes_.end() ? &it->second : nullptr;
+}
+
+bool OctreeIndex::isLeaf(OctreeKey key) const {
+    // 子节点键连续：[key << 3, (key << 3) | 7]
+    auto it = nodes_.lower_bound(childOctreeKey(key, 0));
+    return it == nodes_.end() || it->first > childOctreeKey(key, 7);
+}
+
+} // namespace lod::core
@@ -0,0 +1,153 @@
+#pragma once
+
+#include "Geometry.hpp"
+#include "Mesh.hpp"
+#include <bit>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <span>
+#include <vector>
+
+namespace lod::core {
+
+// 八叉树节点键：根为 1，子节点键 = (父键 << 3) | 子序号；
+// 同一深度的键连续，数值越大深度越深
+using OctreeKey = std::uint64_t;
+using SourceId = std::uint32_t;
+
+inline constexpr OctreeKey kRootOctreeKey = 1;
+
+[[nodiscard]] constexpr OctreeKey childOctreeKey(OctreeKey key, int childIndex) noexcept {
+    return (key << 3) | static_cast<OctreeKey>(childIndex);
+}
+
+[[nodiscard]] constexpr OctreeKey parentOctreeKey(OctreeKey key) noexcept {
+    return key >> 3;
+}
+
+[[nodiscard]] constexpr int octreeKeyDepth(OctreeKey key) noexcept {
+    return (std::bit_width(key) - 1) / 3;
+}
+
+// 源文件内连续的三角形区间 [first, first + count)
+struct TriangleRange {
+    Index first{0};
+    Index count{0};
+
+    bool operator==(const TriangleRange&) const = default;
+};
+
+// 某个源文件落在节点内的三角形
+struct SourceTriangleRanges {
+    SourceId sourceId{0};
+    std::vector<TriangleRange> ranges;  // 按 first 升序、互不重叠
+
+    size_t triangleCount() const noexcept {
+        size_t count = 0;
+        for (const auto& range : ranges) {
+            count += range.count;
+        }
+        return count;
+    }
+};
+
+// 可持久化的八叉树节点：只记录三角形的来源（源文件 + 区间），不持有几何
+struct OctreeIndexNode {
+    OctreeKey key{kRootOctreeKey};
+    BoundingBox bounds;
+    BoundingBox tightBounds;                   // 子树几何的紧致包围盒
+    std::vector<SourceTriangleRanges> sources; // 按 sourceId 升序
+    bool dirty{false};                         // 子树内容自上次构建后发生变化
+
+    size_t triangleCount() const noexcept {
+        size_t count = 0;
+        for (const auto& source : sources) {
+            count += source.triangleCount();
+        }
+        return count;
+    }
+};
+
+// 按源文件编号取网格（增量更新时只需加载受影响的源文件）
+using SourceMeshResolver = std::function<const Mesh*(SourceId)>;
+
+// 多源文件八叉树索引：记录每个节点包含哪些源文件的哪些三角形，
+// 支持按源文件增量替换，只把受影响的节点及其祖先标记为脏
+class OctreeIndex {
+public:
+    OctreeIndex() = default;
+    explicit OctreeIndex(OctreeConfig config) : config_(std::move(config)) {}
+
+    // 全量构建：合并所有源网格后构建八叉树，源文件编号即 sources 中的下标
+    [[nodiscard]] static OctreeIndex build(std::span<const Mesh> sources, const OctreeConfig& config = {});
+
+    // 从已有八叉树转换；八叉树的三角形编号为按源文件顺序合并后的编号
+    [[nodiscard]] static OctreeIndex fromOctree(const OctreeNode& root,
+                                                std::span<const size_t> sourceTriangleCounts,
+                                                const OctreeConfig& config = {});
+
+    // 从持久化的节点恢复
+    [[nodiscard]] static OctreeIndex fromNodes(OctreeConfig config, std::vector<OctreeIndexNode> nodes);
+
+    // 转换回八叉树（fromOctree 的逆过程）：三角形编号为按源文件顺序合并后的编号，
+    // 节点划分保持不变，可直接用于构建 LOD
+    [[nodiscard]] std::unique_ptr<OctreeNode> toOctree(std::span<const size_t> sourceTriangleCounts) const;
+
+    // 增量更新：删除源文件的全部三角形 / 插入新版本 / 两者组合
+    void removeSource(SourceId sourceId);
+    void insertSource(SourceId sourceId, const Mesh& mesh);
+    void replaceSource(SourceId sourceId, const Mesh& mesh) {
+        removeSource(sourceId);
+        insertSource(sourceId, mesh);
+    }
+
+    // 用源网格重新计算脏节点的紧致包围盒（删除后包围盒只会保守地保持原值）
+    void refitDirtyBounds(const SourceMeshResolver& resolver);
+
+    // 收集子树内全部三角形组成网格（跨界重复的三角形只保留一份）
+    [[nodiscard]] Mesh gatherMesh(OctreeKey key, const SourceMeshResolver& resolver) const;
+
+    // 子树涉及的源文件
+    [[nodiscard]] std::vector<SourceId> sourcesInSubtree(OctreeKey key) const;
+
+    [[nodiscard]] std::vector<OctreeKey> dirtyKeys() const;
+    void clearDirty() noexcept;
+    void markAllDirty() noexcept;  // 全量重建后所有节点都需要重新生成结果
+
+    // 增量插入不会重新细分：超出 maxTrianglesPerNode 的叶节点数量过多时应全量重建
+    [[nodiscard]] size_t overfullLeafCount() const;
+
+    [[nodiscard]] const OctreeIndexNode* find(OctreeKey key) const;
+    [[nodiscard]] bool isLeaf(OctreeKey key) const;
+    [[nodiscard]] bool empty() const noexcept { return nodes_.empty(); }
+    [[nodiscard]] const std::map<OctreeKey, OctreeIndexNode>& nodes() const noexcept { return nodes_; }
+    [[nodiscard]] const OctreeConfig& config() const noexcept { return config_; }
+
+    // 按键序（即逐层）遍历子树
+    template<typename Visitor>
+    void traverseSubtree(OctreeKey key, Visitor&& visitor) const {
+        for (OctreeKey first = key, last = key; first != 0 && octreeKeyDepth(first) <= config_.maxDepth;
+             first <<= 3, last = (last << 3) | 7) {
+            for (auto it = nodes_.lower_bound(first); it != nodes_.end() && it->first <= last; ++it) {
+                visitor(it->second);
+            }
+        }
+    }
+
+private:
+    void markDirty(OctreeKey key);
+    void insertTriangles(OctreeKey key, SourceId sourceId, const Mesh& mesh, std::vector<Index> triangles);
+
+    OctreeConfig config_;
+    std::map<OctreeKey, OctreeIndexNode> nodes_;
+};
+
+// 将升序三角形编号压缩为区间
+[[nodiscard]] std::vector<TriangleRange> compressTriangleRanges(std::span<const Index> sortedTriangles);
+
+// 将区间展开为三角形编号
+[[nodiscard]] std::vector<Index> expandTriangleRanges(std::span<const TriangleRange> ranges);
+
+} // namespace lod::core
@@ -0,0 +1,266 @@
+#include "OrientedBox.hpp"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <utility>
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_reduce.h>
+
+namespace lod::core {
+
+namespace {
+    using Vec3 = std::array<double, 3>;
+    using Mat3 = std::array<Vec3, 3>;
+    
+    // 每个并行块处理的点数
+    constexpr size_t kBlockSize = size_t{1} << 14;
+    
+    // 退化轴的最小半长：最大半轴的百万分之一，且不小于 1e-6
+    constexpr double kMinRelativeHalfExtent = 1e-6;
+    
+    double dot(const Vec3& a, const Vec3& b) noexcept {
+        return a[0] * b[0] + a[1] * b[1] + a[2] * b[2];
+    }
+    
+    template<typename Point>
+    Vec3 toVec3(const Point& p) noexcept {
+        return {static_cast<double>(p[0]), static_cast<double>(p[1]), static_cast<double>(p[2])};
+    }
+    
+    // 相对首点平移后的一阶与二阶矩，避免远离原点的坐标在协方差中相消
+    struct Moments {
+        Vec3 sum{0.0, 0.0, 0.0};
+        std::array<double, 6> products{};  // xx, xy, xz, yy, yz, zz
+        size_t count{0};
+        
+        Moments& operator+=(const Moments& other) noexcept {
+            for (int i = 0; i < 3; ++i) {
+                sum[i] += other.sum[i];
+            }
+            for (int i = 0; i < 6; ++i) {
+                products[i] += other.products[i];
+            }
+            count += other.count;
+            return *this;
+        }
+    };
+    
+    // 三个单位方向上的投影范围
+    struct Extents {
+        Vec3 min{std::numeric_limits<double>::max(), std::numeric_limits<double>::max(),
+                 std::numeric_limits<double>::max()};
+        Vec3 max{std::numeric_limits<double>::lowest(), std::numeric_limits<double>::lowest(),
+                 std::numeric_limits<double>::lowest()};
+        
+        Extents& operator+=(const Extents& other) noexcept {
+            for (int i = 0; i < 3; ++i) {
+                min[i] = std::min(min[i], other.min[i]);
+                max[i] = std::max(max[i], other.max[i]);
+            }
+            return *this;
+        }
+    };
+    
+    template<typename Point>
+    Mat3 covariance(std::span<const Point> points, const Vec3& origin) {
+        const auto moments = tbb::parallel_reduce(
+            tbb::blocked_range<size_t>(0, points.size(), kBlockSize), Moments{},
+            [&](const tbb::blocked_range<size_t>& range, Moments current) {
+                for (size_t i = range.begin(); i != range.end(); ++i) {
+                    const auto p = toVec3(points[i]);
+                    const double x = p[0] - origin[0];
+                    const double y = p[1] - origin[1];
+                    const double z = p[2] - origin[2];
+                    current.sum[0] += x;
+                    current.sum[1] += y;
+                    current.sum[2] += z;
+                    current.products[0] += x * x;
+                    current.products[1] += x * y;
+                    current.products[2] += x * z;
+                    current.products[3] += y * y;
+                    current.products[4] += y * z;
+                    current.products[5] += z * z;
+                }
+                current.count += range.size();
+                return current;
+            },
+            [](Moments a, const Moments& b) { return a += b; });
+        
+        const double n = static_cast<double>(moments.count);
+        const Vec3 mean{moments.sum[0] / n, moments.sum[1] / n, moments.sum[2] / n};
+        const auto& m = moments.products;
+        const double xy = m[1] / n - mean[0] * mean[1];
+        const double xz = m[2] / n - mean[0] * mean[2];
+        const double yz = m[4] / n - mean[1] * mean[2];
+        return Mat3{{{m[0] / n - mean[0] * mean[0], xy, xz},
+                     {xy, m[3] / n - mean[1] * mean[1], yz},
+                     {xz, yz, m[5] / n - mean[2] * mean[2]}}};
+    }
+    
+    // 对称矩阵的循环 Jacobi 特征分解，返回按行存放的单位正交特征向量
+    Mat3 eigenvectors(Mat3 a) noexcept {
+        Mat3 v{{{1.0, 0.0, 0.0}, {0.0, 1.0, 0.0}, {0.0, 0.0, 1.0}}};
+        const double scale = std::abs(a[0][0]) + std::abs(a[1][1]) + std::abs(a[2][2]);
+        constexpr std::array<std::pair<int, int>, 3> kPairs{{{0, 1}, {0, 2}, {1, 2}}};
+        
+        for (int sweep = 0; sweep < 32; ++sweep) {
+            const double offDiagonal = std::abs(a[0][1]) + std::abs(a[0][2]) + std::abs(a[1][2]);
+            if (offDiagonal <= 1e-15 * scale) {
+                break;
+            }
+            for (const auto& [p, q] : kPairs) {
+                if (a[p][q] == 0.0) {
+                    continue;
+                }
+                const double theta = (a[q][q] - a[p][p]) / (2.0 * a[p][q]);
+                const double t = std::copysign(1.0, theta) / (std::abs(theta) + std::sqrt(theta * theta + 1.0));
+                const double c = 1.0 / std::sqrt(t * t + 1.0);
+                const double s = t * c;
+                for (int k = 0; k < 3; ++k) {
+                    const double akp = a[k][p];
+                    const double akq = a[k][q];
+                    a[k][p] = c * akp - s * akq;
+                    a[k][q] = s * akp + c * akq;
+                }
+                for (int k = 0; k < 3; ++k) {
+                    const double apk = a[p][k];
+                    const double aqk = a[q][k];
+                    a[p][k] = c * apk - s * aqk;
+                    a[q][k] = s * apk + c * aqk;
+                }
+                for (int k = 0; k < 3; ++k) {
+                    const double vkp = v[k][p];
+                    const double vkq = v[k][q];
+                    v[k][p] = c * vkp - s * vkq;
+                    v[k][q] = s * vkp + c * vkq;
+                }
+            }
+        }
+        
+        // 特征向量是 v 的列
+        return Mat3{{{v[0][0], v[1][0], v[2][0]}, {v[0][1], v[1][1], v[2][1]}, {v[0][2], v[1][2], v[2][2]}}};
+    }
+    
+    template<typename Point>
+    Extents project(std::span<const Point> points, const Mat3& axes, const Vec3& origin) {
+        return tbb::parallel_reduce(
+            tbb::blocked_range<size_t>(0, points.size(), kBlockSize), Extents{},
+            [&](const tbb::blocked_range<size_t>& range, Extents current) {
+                for (size_t i = range.begin(); i != range.end(); ++i) {
+                    const auto p = toVec3(points[i]);
+                    const Vec3 d{p[0] - origin[0], p[1] - origin[1], p[2] - origin[2]};
+                    for (int axis = 0; axis < 3; ++axis) {
+                        const double t = dot(d, axes[axis]);
+                        current.min[axis] = std::min(current.min[axis], t);
+                        current.max[axis] = std::max(current.max[axis], t);
+                    }
+                }
+                return current;
+            },
+            [](Extents a, const Extents& b) { return a += b; });
+    }
+    
+    // 由单位轴与投影范围组装盒子，退化轴补足最小厚度
+    OrientedBox assemble(const Mat3& axes, const Extents& extents, const Vec3& origin) noexcept {
+        Vec3 half{};
+        for (int axis = 0; axis < 3; ++axis) {
+            half[axis] = 0.5 * (extents.max[axis] - extents.min[axis]);
+        }
+        const double minHalf = kMinRelativeHalfExtent * std::max({half[0], half[1], half[2], 1.0});
+        
+        OrientedBox box;
+        box.center = origin;
+        for (int axis = 0; axis < 3; ++axis) {
+            const double mid = 0.5 * (extents.min[axis] + extents.max[axis]);
+            const double length = std::max(half[axis], minHalf);
+            for (int k = 0; k < 3; ++k) {
+                box.center[k] += axes[axis][k] * mid;
+                box.halfAxes[axis][k] = axes[axis][k] * length;
+            }
+        }
+        return box;
+    }
+    
+    // 体积相同（如都是平面）时按表面积比较
+    std::pair<double, double> tightness(const OrientedBox& box) noexcept {
+        std::array<double, 3> length{};
+        for (int axis = 0; axis < 3; ++axis) {
+            length[axis] = std::sqrt(dot(box.halfAxes[axis], box.halfAxes[axis]));
+        }
+        return {box.volume(), length[0] * length[1] + length[1] * length[2] + length[2] * length[0]};
+    }
+    
+    template<typename Point>
+    std::optional<OrientedBox> computeOrientedBoxImpl(std::span<const Point> points) {
+        if (points.empty()) {
+            return std::nullopt;
+        }
+        
+        const auto origin = toVec3(points.front());
+        const Mat3 worldAxes{{{1.0, 0.0, 0.0}, {0.0, 1.0, 0.0}, {0.0, 0.0, 1.0}}};
+        const auto principalAxes = eigenvectors(covariance(points, origin));
+        
+        const auto aligned = assemble(worldAxes, project(points, worldAxes, origin), origin);
+        const auto principal = assemble(principalAxes, project(points, principalAxes, origin), origin);
+        return tightness(principal) < tightness(aligned) ? principal : aligned;
+    }
+} // namespace
+
+double OrientedBox::volume() const noexcept {
+    const auto& [u, v, w] = halfAxes;
+    const double det = u[0] * (v[1] * w[2] - v[2] * w[1]) -
+                       u[1] * (v[0] * w[2] - v[2] * w[0]) +
+                       u[2] * (v[0] * w[1] - v[1] * w[0]);
+    return 8.0 * std::abs(det);
+}
+
+std::array<std::array<double, 3>, 8> OrientedBox::corners() const noexcept {
+    std::array<std::array<double, 3>, 8> result{};
+    for (int i = 0; i < 8; ++i) {
+        result[i] = center;
+        for (int axis = 0; axis < 3; ++axis) {
+            const double sign = (i >> axis) & 1 ? 1.0 : -1.0;
+            for (int k = 0; k < 3; ++k) {
+                result[i][k] += sign * halfAxes[axis][k];
+            }
+        }
+    }
+    return result;
+}
+
+bool OrientedBox::contains(const std::array<double, 3>& point, double tolerance) const noexcept {
+    const Vec3 d{point[0] - center[0], point[1] - center[1], point[2] - center[2]};
+    for (const auto& axis : halfAxes) {
+        const double lengthSquared = dot(axis, axis);
+        if (std::abs(dot(d, axis)) > lengthSquared * (1.0 + tolerance) + tolerance) {
+            return false;
+        }
+    }
+    return true;
+}
+
+std::array<double, 12> OrientedBox::toTilesBox() const noexcept {
+    return {center[0], center[1], center[2],
+            halfAxes[0][0], halfAxes[0][1], halfAxes[0][2],
+            halfAxes[1][0], halfAxes[1][1], halfAxes[1][2],
+            halfAxes[2][0], halfAxes[2][1], halfAxes[2][2]};
+}
+
+OrientedBox OrientedBox::fromBounds(const BoundingBox& bounds) noexcept {
+    const auto c = bounds.center();
+    const auto s = bounds.size();
+    OrientedBox box;
+    box.center = {c[0], c[1], c[2]};
+    box.halfAxes = {{{0.5 * s[0], 0.0, 0.0}, {0.0, 0.5 * s[1], 0.0}, {0.0, 0.0, 0.5 * s[2]}}};
+    return box;
+}
+
+std::optional<OrientedBox> computeOrientedBox(std::span<const Vertex> points) {
+    return computeOrientedBoxImpl(points);
+}
+
+std::optional<OrientedBox> computeOrientedBox(std::span<const std::array<double, 3>> points) {
+    return computeOrientedBoxImpl(points);
+}
+
+} // namespace lod::core
@@ -0,0 +1,33 @@
+#pragma once
+
+#include "Geometry.hpp"
+#include <array>
+#include <optional>
+#include <span>
+
+namespace lod::core {
+
+// 有向包围盒（OBB）：中心加三个两两正交的半轴向量
+struct OrientedBox {
+    std::array<double, 3> center{0.0, 0.0, 0.0};
+    std::array<std::array<double, 3>, 3> halfAxes{};
+    
+    [[nodiscard]] double volume() const noexcept;
+    [[nodiscard]] std::array<std::array<double, 3>, 8> corners() const noexcept;
+    
+    // 点在盒内（含边界，按相对 tolerance 放宽）
+    [[nodiscard]] bool contains(const std::array<double, 3>& point, double tolerance = 1e-9) const noexcept;
+    
+    // 3D Tiles boundingVolume.box 的 12 个数：中心、x 半轴、y 半轴、z 半轴
+    [[nodiscard]] std::array<double, 12> toTilesBox() const noexcept;
+    
+    [[nodiscard]] static OrientedBox fromBounds(const BoundingBox& bounds) noexcept;
+};
+
+// 纯函数：点集的紧致有向包围盒。候选方向为 PCA 主轴（协方差矩阵的 Jacobi 特征分解）
+// 与坐标轴，各自投影求范围后取体积较小者；协方差与投影范围均为并行归约。
+// 平面或共线点集的退化轴保留一个极小的厚度，使半轴方向始终可求。空点集返回 nullopt
+[[nodiscard]] std::optional<OrientedBox> computeOrientedBox(std::span<const Vertex> points);
+[[nodiscard]] std::optional<OrientedBox> computeOrientedBox(std::span<const std::array<double, 3>> points);
+
+} // namespace lod::core
@@ -0,0 +1,639 @@
+#include "QemSimplifier.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <numeric>
+#include <queue>
+
+namespace lod::core {
+
+namespace {
+    constexpr std::uint32_t kInvalid = std::numeric_limits<std::uint32_t>::max();
+    
+    using Vec3d = std::array<double, 3>;
+    
+    Vec3d sub(const double* a, const double* b) noexcept {
+        return {a[0] - b[0], a[1] - b[1], a[2] - b[2]};
+    }
+    
+    Vec3d cross(const Vec3d& a, const Vec3d& b) noexcept {
+        return {a[1] * b[2] - a[2] * b[1], a[2] * b[0] - a[0] * b[2], a[0] * b[1] - a[1] * b[0]};
+    }
+    
+    double dot(const Vec3d& a, const Vec3d& b) noexcept {
+        return a[0] * b[0] + a[1] * b[1] + a[2] * b[2];
+    }
+    
+    // 紧凑半边结构：半边 h 属于三角形 h / 3，起点为 corners[h]（即索引缓冲本身），
+    // next/prev 由下标隐式给出，只额外存储对边与每个顶点的一条出边
+    struct HalfEdgeMesh {
+        std::vector<Index> corners;
+        std::vector<std::uint32_t> twins;       // 边界边为 kInvalid
+        std::vector<std::uint32_t> vertexEdge;  // 孤立或已删除的顶点为 kInvalid
+        std::vector<unsigned char> faceRemoved;
+        std::vector<unsigned char> nonManifold; // 非流形边的端点与蝴蝶结顶点
+        
+        HalfEdgeMesh(std::vector<Index> indices, size_t vertexCount);
+        
+        static std::uint32_t next(std::uint32_t h) noexcept { return h - h % 3 + (h + 1) % 3; }
+        static std::uint32_t prev(std::uint32_t h) noexcept { return h - h % 3 + (h + 2) % 3; }
+        
+        Index origin(std::uint32_t h) const noexcept { return corners[h]; }
+        Index target(std::uint32_t h) const noexcept { return corners[next(h)]; }
+        bool alive(std::uint32_t h) const noexcept { return h != kInvalid && !faceRemoved[h / 3]; }
+        
+        // 按扇形顺序收集顶点的出边（先沿一个方向旋转，遇到边界再从起点反向旋转）
+        void outgoing(Index v, std::vector<std::uint32_t>& result) const {
+            result.clear();
+            const auto start = vertexEdge[v];
+            if (start == kInvalid) {
+                return;
+            }
+            
+            const size_t limit = corners.size();
+            auto h = start;
+            while (result.size() < limit) {
+                result.push_back(h);
+                const auto t = twins[prev(h)];
+                if (t == kInvalid) {
+                    break;
+                }
+                if (t == start) {
+                    return;  // 闭合扇
+                }
+                h = t;
+            }
+            
+            h = start;
+            while (result.size() < limit) {
+                const auto t = twins[h];
+                if (t == kInvalid) {
+                    return;
+                }
+                h = next(t);
+                result.push_back(h);
+            }
+        }
+        
+        // 一环邻接顶点（出边终点与入边起点）
+        void neighbors(Index v, std::vector<std::uint32_t>& edges, std::vector<Index>& result) const {
+            outgoing(v, edges);
+            result.clear();
+            for (const auto h : edges) {
+                result.push_back(target(h));
+                result.push_back(origin(prev(h)));
+            }
+            std::sort(result.begin(), result.end());
+            result.erase(std::unique(result.begin(), result.end()), result.end());
+        }
+        
+        bool isBorder(std::span<const std::uint32_t> edges) const noexcept {
+            return std::any_of(edges.begin(), edges.end(), [&](std::uint32_t h) {
+                return twins[h] == kInvalid || twins[prev(h)] == kInvalid;
+            });
+        }
+    };
+    
+    HalfEdgeMesh::HalfEdgeMesh(std::vector<Index> indices, size_t vertexCount)
+        : corners(std::move(indices)) {
+        const auto halfEdgeCount = static_cast<std::uint32_t>(corners.size());
+        twins.assign(halfEdgeCount, kInvalid);
+        vertexEdge.assign(vertexCount, kInvalid);
+        faceRemoved.assign(halfEdgeCount / 3, 0);
+        nonManifold.assign(vertexCount, 0);
+        
+        // 有向边 (a, b) 与 (b, a) 各恰好出现一次时配对为对边，否则两端视为非流形
+        const auto key = [](Index a, Index b) { return (static_cast<std::uint64_t>(a) << 32) | b; };
+        std::vector<std::pair<std::uint64_t, std::uint32_t>> edges(halfEdgeCount);
+        for (std::uint32_t h = 0; h < halfEdgeCount; ++h) {
+            edges[h] = {key(origin(h), target(h)), h};
+        }
+        std::sort(edges.begin(), edges.end());
+        
+        const auto range = [&](std::uint64_t k) {
+            return std::equal_range(edges.begin(), edges.end(), std::pair{k, std::uint32_t{0}},
+                                    [](const auto& a, const auto& b) { return a.first < b.first; });
+        };
+        
+        std::vector<std::uint32_t> incidence(vertexCount, 0);
+        for (std::uint32_t h = 0; h < halfEdgeCount; ++h) {
+            const auto a = origin(h);
+            const auto b = target(h);
+            vertexEdge[a] = h;
+            ++incidence[a];
+            
+            const auto forward = range(key(a, b));
+            const auto backward = range(key(b, a));
+            const auto forwardCount = forward.second - forward.first;
+            const auto backwardCount = backward.second - backward.first;
+            if (forwardCount == 1 && backwardCount == 1) {
+                twins[h] = backward.first->second;
+            } else if (forwardCount > 1 || backwardCount > 1) {
+                nonManifold[a] = nonManifold[b] = 1;
+            }
+        }
+        
+        // 扇形遍历只能到达一个扇，遍历到的三角形少于关联三角形即为蝴蝶结顶点
+        std::vector<std::uint32_t> fan;
+        for (Index v = 0; v < vertexCount; ++v) {
+            if (vertexEdge[v] != kInvalid && !nonManifold[v]) {
+                outgoing(v, fan);
+                nonManifold[v] = fan.size() != incidence[v];
+            }
+        }
+    }
+    
+    // 广义二次误差：Q(v) = vᵀAv + 2bᵀv + c，A 为对称矩阵（按上三角存储），另存面积权重之和
+    class QuadricStore {
+    public:
+        QuadricStore(size_t vertexCount, size_t dimension)
+            : dimension_(dimension), matrixSize_(dimension * (dimension + 1) / 2),
+              stride_(matrixSize_ + dimension + 2), data_(vertexCount * stride_, 0.0) {}
+        
+        // 三角形所在平面（位于 dimension 维空间）的距离平方，按面积加权
+        void addTriangle(Index v, const double* p0, const double* p1, const double* p2, double weight) {
+            const size_t n = dimension_;
+            std::array<double, 16> e1{};
+            std::array<double, 16> e2{};
+            
+            double length1 = 0.0;
+            for (size_t i = 0; i < n; ++i) {
+                e1[i] = p1[i] - p0[i];
+                length1 += e1[i] * e1[i];
+            }
+            length1 = std::sqrt(length1);
+            if (length1 <= 1e-12) {
+                return;
+            }
+            
+            double projection = 0.0;
+            for (size_t i = 0; i < n; ++i) {
+                e1[i] /= length1;
+                projection += (p2[i] - p0[i]) * e1[i];
+            }
+            
+            double length2 = 0.0;
+            for (size_t i = 0; i < n; ++i) {
+                e2[i] = p2[i] - p0[i] - projection * e1[i];
+                length2 += e2[i] * e2[i];
+            }
+            length2 = std::sqrt(length2);
+            if (length2 <= 1e-12) {
+                return;
+            }
+            
+            double pe1 = 0.0;
+            double pe2 = 0.0;
+            double pp = 0.0;
+            for (size_t i = 0; i < n; ++i) {
+                e2[i] /= length2;
+                pe1 += p0[i] * e1[i];
+                pe2 += p0[i] * e2[i];
+                pp += p0[i] * p0[i];
+            }
+            
+            double* q = quadric(v);
+            size_t k = 0;
+            for (size_t i = 0; i < n; ++i) {
+                for (size_t j = i; j < n; ++j, ++k) {
+                    q[k] += weight * ((i == j ? 1.0 : 0.0) - e1[i] * e1[j] - e2[i] * e2[j]);
+                }
+            }
+            for (size_t i = 0; i < n; ++i) {
+                q[matrixSize_ + i] += weight * (pe1 * e1[i] + pe2 * e2[i] - p0[i]);
+            }
+            q[matrixSize_ + n] += weight * (pp - pe1 * pe1 - pe2 * pe2);
+            q[matrixSize_ + n + 1] += weight;
+        }
+        
+        // 只作用于位置分量的平面 n·p + d = 0
+        void addPlane(Index v, const Vec3d& normal, double d, double weight) {
+            double* q = quadric(v);
+            for (size_t i = 0; i < 3; ++i) {
+                for (size_t j = i; j < 3; ++j) {
+                    q[upperIndex(i, j)] += weight * normal[i] * normal[j];
+                }
+                q[matrixSize_ + i] += weight * d * normal[i];
+            }
+            q[matrixSize_ + dimension_] += weight * d * d;
+            q[matrixSize_ + dimension_ + 1] += weight;
+        }
+        
+        void accumulate(Index into, Index from) {
+            double* a = quadric(into);
+            const double* b = quadric(from);
+            for (size_t i = 0; i < stride_; ++i) {
+                a[i] += b[i];
+            }
+        }
+        
+        double evaluate(Index v, const double* point) const noexcept {
+            const size_t n = dimension_;
+            const double* q = quadric(v);
+            double result = q[matrixSize_ + n];
+            size_t k = 0;
+            for (size_t i = 0; i < n; ++i) {
+                result += q[k++] * point[i] * point[i];
+                for (size_t j = i + 1; j < n; ++j) {
+                    result += 2.0 * q[k++] * point[i] * point[j];
+                }
+                result += 2.0 * q[matrixSize_ + i] * point[i];
+            }
+            return result;
+        }
+        
+        double weight(Index v) const noexcept { return quadric(v)[matrixSize_ + dimension_ + 1]; }
+    
+    private:
+        double* quadric(Index v) noexcept { return data_.data() + static_cast<size_t>(v) * stride_; }
+        const double* quadric(Index v) const noexcept { return data_.data() + static_cast<size_t>(v) * stride_; }
+        
+        size_t upperIndex(size_t i, size_t j) const noexcept {
+            return i * dimension_ - i * (i - 1) / 2 + (j - i);
+        }
+        
+        size_t dimension_;
+        size_t matrixSize_;
+        size_t stride_;
+        std::vector<double> data_;
+    };
+    
+    // 按全部属性流排序：位置相同的顶点相邻，其中属性也完全相同的再相邻
+    std::vector<Index> sortVertices(const VertexAttributes& vertices) {
+        const size_t vertexCount = vertices.positions.size();
+        const bool hasNormals = vertices.normals.size() == vertexCount;
+        const bool hasTexCoords = vertices.texCoords.size() == vertexCount;
+        const bool hasColors = vertices.colors.size() == vertexCount;
+        
+        std::vector<Index> order(vertexCount);
+        std::iota(order.begin(), order.end(), Index{0});
+        std::sort(order.begin(), order.end(), [&](Index a, Index b) {
+            if (vertices.positions[a] != vertices.positions[b]) {
+                return vertices.positions[a] < vertices.positions[b];
+            }
+            if (hasNormals && vertices.normals[a] != vertices.normals[b]) {
+                return vertices.normals[a] < vertices.normals[b];
+            }
+            if (hasTexCoords && vertices.texCoords[a] != vertices.texCoords[b]) {
+                return vertices.texCoords[a] < vertices.texCoords[b];
+            }
+            return hasColors && vertices.colors[a] < vertices.colors[b];
+        });
+        return order;
+    }
+    
+    // 属性完全相同的顶点映射到同一个代表顶点；位置相同但属性不同的顶点（接缝）加入锁定
+    std::vector<Index> mergeDuplicates(const VertexAttributes& vertices, std::vector<unsigned char>& locks) {
+        const size_t vertexCount = vertices.positions.size();
+        const bool hasNormals = vertices.normals.size() == vertexCount;
+        const bool hasTexCoords = vertices.texCoords.size() == vertexCount;
+        const bool hasColors = vertices.colors.size() == vertexCount;
+        const auto sameAttributes = [&](Index a, Index b) {
+            return (!hasNormals || vertices.normals[a] == vertices.normals[b]) &&
+                   (!hasTexCoords || vertices.texCoords[a] == vertices.texCoords[b]) &&
+                   (!hasColors || vertices.colors[a] == vertices.colors[b]);
+        };
+        
+        const auto order = sortVertices(vertices);
+        std::vector<Index> canonical(vertexCount);
+        for (size_t begin = 0; begin < vertexCount;) {
+            size_t end = begin + 1;
+            while (end < vertexCount && vertices.positions[order[end]] == vertices.positions[order[begin]]) {
+                ++end;
+            }
+            
+            bool split = false;
+            Index representative = order[begin];
+            for (size_t i = begin; i < end; ++i) {
+                if (!sameAttributes(order[i], representative)) {
+                    representative = order[i];
+                    split = true;
+                }
+                canonical[order[i]] = representative;
+            }
+            if (split) {
+                for (size_t i = begin; i < end; ++i) {
+                    locks[order[i]] = 1;
+                }
+            }
+            begin = end;
+        }
+        return canonical;
+    }
+    
+    struct Collapse {
+        double error;
+        Index from;
+        Index to;
+        std::uint32_t fromVersion;
+        std::uint32_t toVersion;
+    };
+    
+    struct CollapseGreater {
+        bool operator()(const Collapse& a, const Collapse& b) const noexcept { return a.error > b.error; }
+    };
+} // namespace
+
+SimplifyResult QemSimplifier::simplify(const Mesh& mesh, const SimplifyOptions& options) const {
+    if (mesh.empty() || mesh.triangleCount() <= options.targetTriangleCount) {
+        return {mesh, 0.0, mesh.triangleCount(), false};
+    }
+    
+    const auto& vertices = mesh.vertices();
+    const size_t vertexCount = vertices.positions.size();
+    
+    // 位置归一化到单位尺寸，误差因此与 targetError 同为相对量
+    Vertex minimum = vertices.positions.front();
+    Vertex maximum = vertices.positions.front();
+    for (const auto& p : vertices.positions) {
+        for (int axis = 0; axis < 3; ++axis) {
+            minimum[axis] = std::min(minimum[axis], p[axis]);
+            maximum[axis] = std::max(maximum[axis], p[axis]);
+        }
+    }
+    const double scale = std::max({maximum[0] - minimum[0], maximum[1] - minimum[1], maximum[2] - minimum[2]});
+    if (scale <= 0.0) {
+        return {mesh, 0.0, mesh.triangleCount(), false};
+    }
+    
+    // 扩展向量：归一化位置 + 加权属性
+    const auto& weights = options.attributeWeights;
+    const bool useNormals = weights.normal > 0.0f && vertices.normals.size() == vertexCount;
+    const bool useTexCoords = weights.texCoord > 0.0f && vertices.texCoords.size() == vertexCount;
+    const bool useColors = weights.color > 0.0f && vertices.colors.size() == vertexCount;
+    const size_t dimension = 3 + (useNormals ? 3 : 0) + (useTexCoords ? 2 : 0) + (useColors ? 4 : 0);
+    
+    std::vector<double> points(vertexCount * dimension);
+    for (size_t v = 0; v < vertexCount; ++v) {
+        double* point = points.data() + v * dimension;
+        for (int axis = 0; axis < 3; ++axis) {
+            *point++ = (vertices.positions[v][axis] - minimum[axis]) / scale;
+        }
+        if (useNormals) {
+            for (const auto component : vertices.normals[v]) {
+                *point++ = component * weights.normal;
+            }
+        }
+        if (useTexCoords) {
+            for (const auto component : vertices.texCoords[v]) {
+                *point++ = component * weights.texCoord;
+            }
+        }
+        if (useColors) {
+            for (const auto channel : vertices.colors[v]) {
+                *point++ = channel / 255.0 * weights.color;
+            }
+        }
+    }
+    const auto pointOf = [&](Index v) { return points.data() + static_cast<size_t>(v) * dimension; };
+    
+    auto locks = computeVertexLocks(mesh, options.lockSeams, options.lockBorder);
+    if (options.lockCellFaces) {
+        const auto cellLocks = computeCellFaceLocks(mesh, *options.lockCellFaces);
+        for (size_t v = 0; v < vertexCount; ++v) {
+            locks[v] |= cellLocks[v];
+        }
+    }
+    
+    // 合并重复顶点后丢弃退化三角形
+    const auto canonical = mergeDuplicates(vertices, locks);
+    std::vector<Index> corners;
+    corners.reserve(mesh.indices().size());
+    const auto& indices = mesh.indices();
+    for (size_t i = 0; i + 2 < indices.size(); i += 3) {
+        const Index a = canonical[indices[i]];
+        const Index b = canonical[indices[i + 1]];
+        const Index c = canonical[indices[i + 2]];
+        if (a != b && b != c && a != c) {
+            corners.insert(corners.end(), {a, b, c});
+        }
+    }
+    
+    HalfEdgeMesh topology(std::move(corners), vertexCount);
+    const auto halfEdgeCount = static_cast<std::uint32_t>(topology.corners.size());
+    for (size_t v = 0; v < vertexCount; ++v) {
+        locks[v] |= topology.nonManifold[v];
+    }
+    
+    // 初始二次误差：三角形平面按面积加权，边界边再加一个垂直于三角形的约束平面，防止边界向内收缩
+    QuadricStore quadrics(vertexCount, dimension);
+    for (std::uint32_t h = 0; h < halfEdgeCount; h += 3) {
+        const Index v[3] = {topology.corners[h], topology.corners[h + 1], topology.corners[h + 2]};
+        const auto normal = cross(sub(pointOf(v[1]), pointOf(v[0])), sub(pointOf(v[2]), pointOf(v[0])));
+        const double doubleArea = std::sqrt(dot(normal, normal));
+        if (doubleArea <= 0.0) {
+            continue;
+        }
+        
+        for (int corner = 0; corner < 3; ++corner) {
+            quadrics.addTriangle(v[corner], pointOf(v[0]), pointOf(v[1]), pointOf(v[2]), 0.5 * doubleArea);
+            if (topology.twins[h + corner] != kInvalid) {
+                continue;
+            }
+            
+            const Index a = v[corner];
+            const Index b = v[(corner + 1) % 3];
+            const auto edge = sub(pointOf(b), pointOf(a));
+            auto planeNormal = cross(edge, normal);
+            const double length = std::sqrt(dot(planeNormal, planeNormal));
+            if (length <= 0.0) {
+                continue;
+            }
+            for (auto& component : planeNormal) {
+                component /= length;
+            }
+            const double d = -dot(planeNormal, {pointOf(a)[0], pointOf(a)[1], pointOf(a)[2]});
+            const double weight = dot(edge, edge);
+            quadrics.addPlane(a, planeNormal, d, weight);
+            quadrics.addPlane(b, planeNormal, d, weight);
+        }
+    }
+    
+    // 折叠代价：两端二次误差之和在目标顶点处的值，按面积权重归一化为相对距离
+    std::vector<std::uint32_t> versions(vertexCount, 0);
+    const auto collapseError = [&](Index from, Index to) {
+        const double cost = quadrics.evaluate(from, pointOf(to)) + quadrics.evaluate(to, pointOf(to));
+        const double weight = quadrics.weight(from) + quadrics.weight(to);
+        return weight > 0.0 ? std::sqrt(std::max(cost, 0.0) / weight) : 0.0;
+    };
+    
+    std::priority_queue<Collapse, std::vector<Collapse>, CollapseGreater> heap;
+    const auto push = [&](Index from, Index to) {
+        if (!locks[from]) {
+            heap.push({collapseError(from, to), from, to, versions[from], versions[to]});
+        }
+    };
+    
+    std::vector<std::uint32_t> fromEdges;
+    std::vector<std::uint32_t> toEdges;
+    std::vector<Index> fromNeighbors;
+    std::vector<Index> toNeighbors;
+    for (Index v = 0; v < vertexCount; ++v) {
+        if (!locks[v] && topology.vertexEdge[v] != kInvalid) {
+            topology.neighbors(v, fromEdges, fromNeighbors);
+            for (const auto n : fromNeighbors) {
+                push(v, n);
+            }
+        }
+    }
+    
+    // 校验折叠 from → to 并执行；返回删除的三角形数，0 表示折叠非法
+    const auto tryCollapse = [&](Index from, Index to) -> size_t {
+        topology.neighbors(from, fromEdges, fromNeighbors);
+        std::uint32_t h1 = kInvalid;  // from → to
+        std::uint32_t h2 = kInvalid;  // to → from
+        for (const auto h : fromEdges) {
+            if (topology.target(h) == to) {
+                h1 = h;
+            }
+            if (topology.origin(HalfEdgeMesh::prev(h)) == to) {
+                h2 = HalfEdgeMesh::prev(h);
+            }
+        }
+        if (h1 == kInvalid && h2 == kInvalid) {
+            return 0;
+        }
+        
+        // 边界顶点只能沿边界边折叠
+        const bool borderEdge = h1 == kInvalid || h2 == kInvalid;
+        if (!borderEdge && topology.isBorder(fromEdges)) {
+            return 0;
+        }
+        
+        // 链接条件：公共邻点恰好是被删除三角形的对顶点，否则折叠后出现非流形
+        topology.neighbors(to, toEdges, toNeighbors);
+        std::vector<Index> shared;
+        std::set_intersection(fromNeighbors.begin(), fromNeighbors.end(),
+                              toNeighbors.begin(), toNeighbors.end(), std::back_inserter(shared));
+        if (shared.size() != (h1 != kInvalid ? 1u : 0u) + (h2 != kInvalid ? 1u : 0u)) {
+            return 0;
+        }
+        
+        // 剩余三角形不得翻转或退化
+        for (const auto h : fromEdges) {
+            if (h / 3 == h1 / 3 || h / 3 == h2 / 3) {
+                continue;
+            }
+            const double* a = pointOf(topology.target(h));
+            const double* b = pointOf(topology.origin(HalfEdgeMesh::prev(h)));
+            const auto before = cross(sub(a, pointOf(from)), sub(b, pointOf(from)));
+            const auto after = cross(sub(a, pointOf(to)), sub(b, pointOf(to)));
+            const double afterLength = dot(after, after);
+            if (afterLength <= 1e-24 || dot(before, after) <= 0.0) {
+                return 0;
+            }
+        }
+        
+        // 删除 from-to 两侧的三角形，并把各自另外两条边的对边缝合
+        const auto stitch = [&](std::uint32_t a, std::uint32_t b) {
+            if (a != kInvalid) {
+                topology.twins[a] = b;
+            }
+            if (b != kInvalid) {
+                topology.twins[b] = a;
+            }
+        };
+        
+        Index x = kInvalid;
+        Index y = kInvalid;
+        std::array<std::uint32_t, 2> xCandidates{kInvalid, kInvalid};
+        std::array<std::uint32_t, 2> yCandidates{kInvalid, kInvalid};
+        size_t removed = 0;
+        if (h1 != kInvalid) {
+            const auto a = HalfEdgeMesh::next(h1);  // to → x
+            const auto b = HalfEdgeMesh::prev(h1);  // x → from
+            x = topology.target(a);
+            const auto ta = topology.twins[a];
+            const auto tb = topology.twins[b];
+            stitch(ta, tb);
+            xCandidates = {ta, tb == kInvalid ? kInvalid : HalfEdgeMesh::next(tb)};
+            topology.faceRemoved[h1 / 3] = 1;
+            ++removed;
+        }
+        if (h2 != kInvalid) {
+            const auto c = HalfEdgeMesh::next(h2);  // from → y
+            const auto d = HalfEdgeMesh::prev(h2);  // y → to
+            y = topology.origin(d);
+            const auto tc = topology.twins[c];
+            const auto td = topology.twins[d];
+            stitch(tc, td);
+            yCandidates = {tc, td == kInvalid ? kInvalid : HalfEdgeMesh::next(td)};
+            topology.faceRemoved[h2 / 3] = 1;
+            ++removed;
+        }
+        
+        for (const auto h : fromEdges) {
+            if (topology.alive(h)) {
+                topology.corners[h] = to;
+            }
+        }
+        
+        // 修复出边指向已删除三角形的顶点
+        const auto repair = [&](Index v, std::span<const std::uint32_t> candidates) {
+            if (v == kInvalid || topology.alive(topology.vertexEdge[v])) {
+                return;
+            }
+            const auto found = std::find_if(candidates.begin(), candidates.end(),
+                                            [&](std::uint32_t h) { return topology.alive(h); });
+            topology.vertexEdge[v] = found != candidates.end() ? *found : kInvalid;
+        };
+        repair(to, toEdges);
+        repair(to, fromEdges);
+        repair(x, xCandidates);
+        repair(y, yCandidates);
+        topology.vertexEdge[from] = kInvalid;
+        return removed;
+    };
+    
+    size_t triangleCount = halfEdgeCount / 3;
+    double resultError = 0.0;
+    while (!heap.empty() && triangleCount > options.targetTriangleCount) {
+        const auto candidate = heap.top();
+        heap.pop();
+        
+        // 惰性失效：任一端点在入堆后发生过折叠则丢弃
+        if (candidate.fromVersion != versions[candidate.from] || candidate.toVersion != versions[candidate.to] ||
+            topology.vertexEdge[candidate.from] == kInvalid) {
+            continue;
+        }
+        if (candidate.error > options.targetError) {
+            break;
+        }
+        
+        const size_t removed = tryCollapse(candidate.from, candidate.to);
+        if (removed == 0) {
+            continue;
+        }
+        triangleCount -= removed;
+        resultError = std::max(resultError, candidate.error);
+        
+        quadrics.accumulate(candidate.to, candidate.from);
+        ++versions[candidate.from];
+        ++versions[candidate.to];
+        
+        topology.neighbors(candidate.to, toEdges, toNeighbors);
+        for (const auto n : toNeighbors) {
+            push(n, candidate.to);
+            push(candidate.to, n);
+        }
+    }
+    
+    std::vector<Index> result;
+    result.reserve(triangleCount * 3);
+    for (std::uint32_t h = 0; h < halfEdgeCount; h += 3) {
+        if (!topology.faceRemoved[h / 3]) {
+            result.insert(result.end(), {topology.corners[h], topology.corners[h + 1], topology.corners[h + 2]});
+        }
+    }
+    
+    auto simplified = mesh.withIndices(std::move(result));
+    if (options.compactVertices) {
+        simplified = compactMesh(simplified);
+    }
+    const size_t resultCount = simplified.triangleCount();
+    return {std::move(simplified), resultError * scale, resultCount, false};
+}
+
+} // namespace lod::core
@@ -0,0 +1,20 @@
+#pragma once
+
+#include "LodAlgorithm.hpp"
+
+namespace lod::core {
+
+// 自研二次误差度量（QEM）简化后端：半边折叠（保留目标顶点的位置与属性），
+// 位置与加权属性构成的广义二次误差（Garland & Heckbert 1998），惰性失效的二叉堆按误差从小到大折叠。
+//
+// 与 meshoptimizer 后端的差异：
+// - 属性完全相同的重复顶点先合并，位置相同但属性不同的接缝顶点始终锁定；
+// - 非流形边的端点与蝴蝶结顶点锁定，边界顶点只能沿边界折叠；
+// - 不做 sloppy 回退（忽略 fallbackFactor），误差含义与 meshoptimizer 一致（相对网格尺寸，结果换算到世界单位）。
+class QemSimplifier : public ISimplifier {
+public:
+    SimplifyResult simplify(const Mesh& mesh, const SimplifyOptions& options) const override;
+    std::string_view name() const noexcept override { return "qem"; }
+};
+
+} // namespace lod::core
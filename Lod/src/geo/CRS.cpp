@@ -1,74 +1,425 @@
 #include "CRS.hpp"
+#include <proj.h>
+#include <tbb/parallel_for.h>
 #include <algorithm>
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <memory>
+#include <mutex>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
 namespace lod::geo {
 
+namespace {
+    // 每块点数：足够摊薄 proj_trans_generic 的调用开销，又能让多线程均衡
+    constexpr size_t kTransformBlockSize = size_t{1} << 14;
+    
+    using PjPtr = std::unique_ptr<PJ, decltype(&proj_destroy)>;
+    using CRSPair = std::pair<const CRSInfo*, const CRSInfo*>;
+    
+    struct CRSPairHash {
+        size_t operator()(const CRSPair& pair) const noexcept {
+            const std::hash<const void*> hash;
+            return hash(pair.first) * 31 + hash(pair.second);
+        }
+    };
+    
+    // 线程私有的 PROJ 上下文与转换对象缓存，转换按注册表中的 CRS 对象（指针）索引
+    class ThreadProjPool {
+    public:
+        ThreadProjPool() : context_(proj_context_create(), &proj_context_destroy) {}
+        
+        PJ_CONTEXT* context() const noexcept { return context_.get(); }
+        
+        // 经度在前的 (源, 目标) 转换；任一 CRS 未解析或无法建立转换时返回空指针（后者同样缓存）
+        PJ* transform(const CRSInfo* source, const CRSInfo* target) {
+            if (!source || !target) {
+                return nullptr;
+            }
+            auto [it, inserted] = transforms_.try_emplace(CRSPair{source, target}, nullptr, &proj_destroy);
+            if (inserted) {
+                const PjPtr raw(proj_create_crs_to_crs(context(), source->definition.c_str(),
+                                                       target->definition.c_str(), nullptr),
+                                &proj_destroy);
+                if (raw) {
+                    it->second.reset(proj_normalize_for_visualization(context(), raw.get()));
+                }
+            }
+            return it->second.get();
+        }
+    
+    private:
+        // 成员逆序析构：PJ 先于其上下文销毁
+        std::unique_ptr<PJ_CONTEXT, decltype(&proj_context_destroy)> context_;
+        std::unordered_map<CRSPair, PjPtr, CRSPairHash> transforms_;
+    };
+    
+    ThreadProjPool& threadProjPool() {
+        thread_local ThreadProjPool pool;
+        return pool;
+    }
+    
+    bool isFailed(double x, double y) noexcept {
+        return !std::isfinite(x) || !std::isfinite(y);
+    }
+    
+    CRSType toCRSType(PJ_TYPE type) noexcept {
+        switch (type) {
+            case PJ_TYPE_GEOGRAPHIC_2D_CRS: return CRSType::Geographic2D;
+            case PJ_TYPE_GEOGRAPHIC_3D_CRS: return CRSType::Geographic3D;
+            case PJ_TYPE_GEOCENTRIC_CRS: return CRSType::Geocentric;
+            case PJ_TYPE_PROJECTED_CRS: return CRSType::Projected;
+            case PJ_TYPE_COMPOUND_CRS: return CRSType::Compound;
+            case PJ_TYPE_VERTICAL_CRS: return CRSType::Vertical;
+            default: return CRSType::Other;
+        }
+    }
+    
+    // 查询 PROJ 数据库得到 CRS 元数据；定义无法识别或不是 CRS 时返回 nullopt
+    std::optional<CRSInfo> queryCRS(PJ_CONTEXT* context, const std::string& definition) {
+        PjPtr crs(proj_create(context, definition.c_str()), &proj_destroy);
+        if (!crs || !proj_is_crs(crs.get())) {
+            return std::nullopt;
+        }
+        
+        CRSInfo info;
+        info.definition = definition;
+        const char* name = proj_get_name(crs.get());
+        info.name = name ? name : "";
+        const char* authority = proj_get_id_auth_name(crs.get(), 0);
+        const char* id = proj_get_id_code(crs.get(), 0);
+        info.code = authority && id ? std::string(authority) + ':' + id : definition;
+        
+        // 带基准转换参数的 CRS 按其源 CRS 分类；复合 CRS 的单位与轴取自水平分量
+        PjPtr base(proj_get_type(crs.get()) == PJ_TYPE_BOUND_CRS ? proj_get_source_crs(context, crs.get()) : nullptr,
+                   &proj_destroy);
+        const PJ* classified = base ? base.get() : crs.get();
+        info.type = toCRSType(proj_get_type(classified));
+        PjPtr horizontal(info.type == CRSType::Compound ? proj_crs_get_sub_crs(context, classified, 0) : nullptr,
+                         &proj_destroy);
+        
+        const PjPtr cs(proj_crs_get_coordinate_system(context, horizontal ? horizontal.get() : classified),
+                       &proj_destroy);
+        if (cs && proj_cs_get_axis_count(context, cs.get()) >= 2) {
+            std::array<std::string, 2> directions;
+            for (int axis = 0; axis < 2; ++axis) {
+                const char* direction = nullptr;
+                const char* unitName = nullptr;
+                if (proj_cs_get_axis_info(context, cs.get(), axis, nullptr, nullptr, &direction, nullptr,
+                                          &unitName, nullptr, nullptr)) {
+                    directions[axis] = direction ? direction : "";
+                    if (axis == 0 && unitName) {
+                        info.unit = unitName;
+                    }
+                }
+            }
+            if (directions[0] == "east" && directions[1] == "north") {
+                info.axisOrder = AxisOrder::EastNorth;
+            } else if (directions[0] == "north" && directions[1] == "east") {
+                info.axisOrder = AxisOrder::NorthEast;
+            }
+        }
+        
+        // 数据库未记录适用范围时各值为 -1000
+        double west = 0.0, south = 0.0, east = 0.0, north = 0.0;
+        if (proj_get_area_of_use(context, crs.get(), &west, &south, &east, &north, nullptr) && west > -1000.0) {
+            info.areaOfUse = GeoBBox{west, south, east, north};
+        }
+        return info;
+    }
+} // namespace
+
+// CRSRegistry 实现
+CRSRegistry& CRSRegistry::instance() {
+    static CRSRegistry registry;
+    return registry;
+}
+
+const CRSInfo* CRSRegistry::resolve(std::string_view definition) {
+    const std::string key(definition);
+    {
+        std::shared_lock lock(mutex_);
+        if (const auto it = index_.find(key); it != index_.end()) {
+            return it->second;
+        }
+    }
+    
+    // 查询数据库时不持锁，多个线程可同时解析不同的定义
+    return intern(key, queryCRS(threadProjPool().context(), key));
+}
+
+const CRSInfo* CRSRegistry::intern(const std::string& definition, std::optional<CRSInfo> info) {
+    std::unique_lock lock(mutex_);
+    
+    // 其他线程可能已先一步登记了同一定义
+    if (const auto it = index_.find(definition); it != index_.end()) {
+        return it->second;
+    }
+    if (!info) {
+        index_.emplace(definition, nullptr);
+        return nullptr;
+    }
+    
+    // 同一权威代码的不同写法共用一个对象
+    if (const auto it = index_.find(info->code); it != index_.end() && it->second) {
+        index_.emplace(definition, it->second);
+        return it->second;
+    }
+    
+    storage_.push_back(std::make_unique<const CRSInfo>(std::move(*info)));
+    const CRSInfo* interned = storage_.back().get();
+    index_.emplace(definition, interned);
+    index_.insert_or_assign(interned->code, interned);
+    return interned;
+}
+
+void CRSRegistry::preload(std::span<const std::string> definitions) {
+    std::vector<std::string> pending;
+    {
+        std::shared_lock lock(mutex_);
+        for (const auto& definition : definitions) {
+            if (!index_.contains(definition)) {
+                pending.push_back(definition);
+            }
+        }
+    }
+    std::sort(pending.begin(), pending.end());
+    pending.erase(std::unique(pending.begin(), pending.end()), pending.end());
+    
+    tbb::parallel_for(size_t{0}, pending.size(), [&](size_t i) {
+        (void)resolve(pending[i]);
+    });
+}
+
+size_t CRSRegistry::size() const {
+    std::shared_lock lock(mutex_);
+    return index_.size();
+}
+
 // CRS 实现
 bool CRS::isGeographic() const noexcept {
-    // 简化实现：检查是否为 EPSG:4326 或其他地理坐标系
-    return code_ == "EPSG:4326" || code_ == "EPSG:4269" || code_ == "EPSG:4979";
+    return info_ && info_->isGeographic();
 }
 
 bool CRS::isProjected() const noexcept {
-    // 简化实现：检查是否为投影坐标系
-    return !isGeographic() && (code_.find("EPSG:") == 0);
+    return info_ && info_->type == CRSType::Projected;
 }
 
 std::string CRS::getUnit() const noexcept {
-    if (isGeographic()) {
-        return "degree";
-    } else if (isProjected()) {
-        return "metre";
-    } else {
-        return "unknown";
-    }
+    return info_ && !info_->unit.empty() ? info_->unit : "unknown";
 }
 
 // CoordinateTransformer 实现
-CoordinateTransformer::CoordinateTransformer(const CRS& sourceCRS, const CRS& targetCRS)
-    : sourceCRS_(sourceCRS), targetCRS_(targetCRS) {
+CoordinateTransformer::CoordinateTransformer(const CRS& sourceCRS, const CRS& targetCRS,
+                                             HeightDatum sourceHeights, HeightDatum targetHeights)
+    : sourceCRS_(sourceCRS), targetCRS_(targetCRS),
+      sourceHeights_(std::move(sourceHeights)), targetHeights_(std::move(targetHeights)) {
 }
 
 std::optional<GeoPoint> CoordinateTransformer::transform(const GeoPoint& point) const {
-    // 简化实现：当前仅支持相同 CRS 之间的"转换"
-    if (sourceCRS_.code() == targetCRS_.code()) {
-        return point;
+    GeoPoint result = point;
+    auto failed = transformStrided(&result.longitude, &result.latitude, &result.altitude, sizeof(GeoPoint), 1);
+    if (!failed || *failed != 0) {
+        return std::nullopt;
     }
-    
-    // 这里应该使用 PROJ 库进行实际的坐标转换
-    // 当前返回原点作为占位符
-    return std::nullopt;
+    return result;
 }
 
 std::optional<GeoBBox> CoordinateTransformer::transform(const GeoBBox& bbox) const {
-    // 简化实现：转换包围盒的四个角点
-    if (sourceCRS_.code() == targetCRS_.code()) {
+    // 包围盒只转换水平范围，不涉及高程基准
+    if (sourceCRS_ == targetCRS_) {
         return bbox;
     }
     
-    // 当前返回原包围盒作为占位符
-    return std::nullopt;
+    auto& pool = threadProjPool();
+    PJ* pj = pool.transform(sourceCRS_.info(), targetCRS_.info());
+    if (!pj) {
+        return std::nullopt;
+    }
+    
+    // 每条边加密 21 个点，覆盖投影下边界弯曲的情况
+    GeoBBox result;
+    if (!proj_trans_bounds(pool.context(), pj, PJ_FWD, bbox.minLon, bbox.minLat, bbox.maxLon, bbox.maxLat,
+                           &result.minLon, &result.minLat, &result.maxLon, &result.maxLat, 21)) {
+        return std::nullopt;
+    }
+    return result;
 }
 
 std::vector<GeoPoint> CoordinateTransformer::transform(const std::vector<GeoPoint>& points) const {
-    std::vector<GeoPoint> result;
-    result.reserve(points.size());
-    
-    for (const auto& point : points) {
-        auto transformedPoint = transform(point);
-        if (transformedPoint) {
-            result.push_back(*transformedPoint);
-        }
+    std::vector<GeoPoint> result = points;
+    if (result.empty()) {
+        return result;
+    }
+    if (!transformStrided(&result.data()->longitude, &result.data()->latitude, &result.data()->altitude,
+                          sizeof(GeoPoint), result.size())) {
+        return {};
     }
     
+    std::erase_if(result, [](const GeoPoint& point) { return isFailed(point.longitude, point.latitude); });
     return result;
 }
 
-std::optional<std::array<double, 3>> CoordinateTransformer::transformInternal(const std::array<double, 3>& coords) const {
-    // 这里应该实现具体的坐标转换逻辑
-    // 当前简化实现直接返回输入坐标
-    return coords;
+std::expected<void, TransformError> CoordinateTransformer::transformInPlace(std::span<GeoPoint> points) const {
+    if (points.empty()) {
+        return {};
+    }
+    auto failed = transformStrided(&points.data()->longitude, &points.data()->latitude, &points.data()->altitude,
+                                   sizeof(GeoPoint), points.size());
+    if (!failed) {
+        return std::unexpected(failed.error());
+    }
+    if (*failed != 0) {
+        return std::unexpected(TransformError::TransformFailed);
+    }
+    return {};
+}
+
+std::expected<void, TransformError> CoordinateTransformer::transformInPlace(std::span<double> x, std::span<double> y,
+                                                                            std::span<double> z) const {
+    if (x.size() != y.size() || (!z.empty() && z.size() != x.size())) {
+        return std::unexpected(TransformError::TransformFailed);
+    }
+    
+    auto failed = transformStrided(x.data(), y.data(), z.empty() ? nullptr : z.data(), sizeof(double), x.size());
+    if (!failed) {
+        return std::unexpected(failed.error());
+    }
+    if (*failed != 0) {
+        return std::unexpected(TransformError::TransformFailed);
+    }
+    return {};
+}
+
+std::expected<size_t, TransformError> CoordinateTransformer::transformStrided(double* x, double* y, double* z,
+                                                                              size_t stride, size_t count) const {
+    if (count == 0 || isIdentity()) {
+        return size_t{0};
+    }
+    
+    // 需要改正高程时分两段：源 → WGS84 经纬度 → 目标，与 WGS84 相同的一段省略
+    const bool shiftHeights = sourceHeights_ != targetHeights_;
+    const CRSInfo* source = sourceCRS_.info();
+    const CRSInfo* target = targetCRS_.info();
+    const CRSInfo* geographic = crs::WGS84().info();
+    const CRSInfo* firstTarget = shiftHeights ? geographic : target;
+    const bool firstStage = source != firstTarget;
+    const bool secondStage = shiftHeights && target != geographic;
+    
+    // 先在调用线程上确认转换可以建立，避免每个工作线程各自失败
+    auto& pool = threadProjPool();
+    if (!source || !target || (firstStage && !pool.transform(source, firstTarget)) ||
+        (secondStage && !pool.transform(geographic, target))) {
+        return std::unexpected(TransformError::InvalidCRS);
+    }
+    
+    const auto at = [stride](double* base, size_t i) {
+        return base ? reinterpret_cast<double*>(reinterpret_cast<char*>(base) + i * stride) : nullptr;
+    };
+    
+    std::atomic<size_t> failed{0};
+    const size_t blockCount = (count + kTransformBlockSize - 1) / kTransformBlockSize;
+    tbb::parallel_for(size_t{0}, blockCount, [&](size_t block) {
+        const size_t begin = block * kTransformBlockSize;
+        const size_t n = std::min(kTransformBlockSize, count - begin);
+        
+        // 未给出高程但需改正时，按正高 0 在块内临时数组上改正
+        std::vector<double> heights(!z && shiftHeights ? n : 0, 0.0);
+        double* const xb = at(x, begin);
+        double* const yb = at(y, begin);
+        double* const zb = z ? at(z, begin) : (heights.empty() ? nullptr : heights.data());
+        const size_t zStride = z ? stride : sizeof(double);
+        
+        const auto run = [&](const CRSInfo* from, const CRSInfo* to) {
+            PJ* pj = threadProjPool().transform(from, to);
+            if (!pj) {
+                return false;
+            }
+            proj_trans_generic(pj, PJ_FWD,
+                               xb, stride, n,
+                               yb, stride, n,
+                               zb, zb ? zStride : 0, zb ? n : 0,
+                               nullptr, 0, 0);
+            return true;
+        };
+        
+        if (firstStage && !run(source, firstTarget)) {
+            failed += n;
+            return;
+        }
+        if (shiftHeights) {
+            applyHeightDatums(xb, yb, stride, zb, zStride, n);
+            if (secondStage && !run(geographic, target)) {
+                failed += n;
+                return;
+            }
+        }
+        
+        // 失败的点被 PROJ 置为 HUGE_VAL
+        size_t localFailed = 0;
+        for (size_t i = begin; i < begin + n; ++i) {
+            localFailed += isFailed(*at(x, i), *at(y, i)) ? 1 : 0;
+        }
+        failed += localFailed;
+    });
+    
+    return failed.load();
+}
+
+void CoordinateTransformer::applyHeightDatums(double* lon, double* lat, size_t stride, double* height,
+                                              size_t heightStride, size_t count) const noexcept {
+    const auto at = [](double* base, size_t i, size_t step) {
+        return reinterpret_cast<double*>(reinterpret_cast<char*>(base) + i * step);
+    };
+    
+    for (size_t i = 0; i < count; ++i) {
+        double& x = *at(lon, i, stride);
+        double& y = *at(lat, i, stride);
+        if (isFailed(x, y)) {
+            continue;
+        }
+        
+        // h = H_源 + N_源，H_目标 = h - N_目标
+        const auto sourceN = sourceHeights_ ? sourceHeights_->undulation(x, y) : std::optional{0.0};
+        const auto targetN = targetHeights_ ? targetHeights_->undulation(x, y) : std::optional{0.0};
+        if (!sourceN || !targetN) {
+            x = HUGE_VAL;
+            y = HUGE_VAL;
+            continue;
+        }
+        *at(height, i, heightStride) += *sourceN - *targetN;
+    }
+}
+
+// 常用 CRS
+namespace crs {
+    const CRS& WGS84() {
+        static const CRS instance("EPSG:4326");
+        return instance;
+    }
+    
+    const CRS& ECEF() {
+        static const CRS instance("EPSG:4978");
+        return instance;
+    }
+    
+    const CRS& WebMercator() {
+        static const CRS instance("EPSG:3857");
+        return instance;
+    }
+    
+    const CRS& UTM_Zone_49N() {
+        static const CRS instance("EPSG:32649");
+        return instance;
+    }
+    
+    const CRS& UTM_Zone_50N() {
+        static const CRS instance("EPSG:32650");
+        return instance;
+    }
 }
 
 // 工厂函数实现
@@ -80,49 +431,27 @@ std::optional<CRS> createCRS(const std::string& code) {
 }
 
 std::optional<CRS> parseCRSFromString(const std::string& crsString) {
-    // 简化解析：支持 "EPSG:xxxx" 格式
-    if (crsString.find("EPSG:") == 0 && crsString.length() > 5) {
-        try {
-            int epsgCode = std::stoi(crsString.substr(5));
-            if (epsgCode > 0) {
-                return CRS{crsString};
-            }
-        } catch (const std::exception&) {
-            // 解析失败
-        }
-    }
-    
-    return std::nullopt;
+    return createCRS(crsString);
 }
 
-bool isValidCRS(const std::string& code) noexcept {
-    // 简化验证：检查常见的 EPSG 代码
-    static const std::unordered_map<std::string, bool> validCodes = {
-        {"EPSG:4326", true},  // WGS84
-        {"EPSG:3857", true},  // Web Mercator
-        {"EPSG:4269", true},  // NAD83
-        {"EPSG:4979", true},  // WGS84 3D
-        {"EPSG:32649", true}, // UTM Zone 49N
-        {"EPSG:32650", true}, // UTM Zone 50N
-        {"EPSG:2154", true},  // RGF93 / Lambert-93
-        {"EPSG:25832", true}, // ETRS89 / UTM zone 32N
-    };
-    
-    auto it = validCodes.find(code);
-    return it != validCodes.end() && it->second;
+bool isValidCRS(const std::string& code) {
+    return CRSRegistry::instance().resolve(code) != nullptr;
 }
 
-std::vector<std::string> getSupportedCRS() noexcept {
-    return {
-        "EPSG:4326",   // WGS84 Geographic
-        "EPSG:3857",   // Web Mercator
-        "EPSG:4269",   // NAD83 Geographic
-        "EPSG:4979",   // WGS84 3D Geographic
-        "EPSG:32649",  // UTM Zone 49N
-        "EPSG:32650",  // UTM Zone 50N
-        "EPSG:2154",   // RGF93 / Lambert-93
-        "EPSG:25832",  // ETRS89 / UTM zone 32N
-    };
+std::vector<std::string> getSupportedCRS() {
+    static const std::vector<std::string> codes = [] {
+        std::vector<std::string> result;
+        int count = 0;
+        PROJ_CRS_INFO** list = proj_get_crs_info_list_from_database(threadProjPool().context(), "EPSG", nullptr, &count);
+        for (int i = 0; i < count; ++i) {
+            if (!list[i]->deprecated) {
+                result.push_back(std::string(list[i]->auth_name) + ':' + list[i]->code);
+            }
+        }
+        proj_crs_info_list_destroy(list);
+        return result;
+    }();
+    return codes;
 }
 
 } // namespace lod::geo 
\ No newline at end of file
@@ -1,20 +1,91 @@
 #pragma once
 
 #include "GeoBBox.hpp"
+#include "GeoidGrid.hpp"
 #include <string>
+#include <string_view>
 #include <optional>
 #include <array>
+#include <expected>
+#include <memory>
+#include <shared_mutex>
+#include <span>
+#include <unordered_map>
+#include <vector>
 
 namespace lod::geo {
 
-// 坐标参考系统类
+// CRS 类型（按 PROJ 数据库）
+enum class CRSType {
+    Geographic2D,
+    Geographic3D,
+    Geocentric,
+    Projected,
+    Compound,
+    Vertical,
+    Other
+};
+
+// 水平坐标轴顺序
+enum class AxisOrder {
+    EastNorth,   // 经度/东向在前
+    NorthEast,   // 纬度/北向在前（如 EPSG:4326 的权威定义）
+    Other        // 地心坐标系等
+};
+
+// 由 PROJ 数据库解析得到的 CRS 元数据；由 CRSRegistry 持有，地址在进程内稳定且唯一
+struct CRSInfo {
+    std::string code;        // 权威代码，如 "EPSG:4326"；没有权威编号时为原始定义
+    std::string definition;  // 首次解析时使用的定义字符串，用于创建 PROJ 对象
+    std::string name;
+    CRSType type{CRSType::Other};
+    std::string unit;        // 第一根水平轴的单位名，如 "degree"、"metre"
+    AxisOrder axisOrder{AxisOrder::Other};
+    std::optional<GeoBBox> areaOfUse;  // 适用范围（WGS84 经纬度），数据库未记录时为空
+    
+    bool isGeographic() const noexcept { return type == CRSType::Geographic2D || type == CRSType::Geographic3D; }
+};
+
+// 进程级 CRS 注册表：每个定义只查询一次 PROJ 数据库，结果驻留到进程结束。
+// 同一 CRS 的不同写法（如 "epsg:4326" 与 "EPSG:4326"）解析到同一个 CRSInfo，
+// 因此比较 CRS 只需比较指针。可在线程间并发使用
+class CRSRegistry {
+public:
+    [[nodiscard]] static CRSRegistry& instance();
+    
+    // 解析定义（"EPSG:xxxx"、WKT、PROJ 字符串等）；无法识别时返回 nullptr，失败结果同样缓存
+    [[nodiscard]] const CRSInfo* resolve(std::string_view definition);
+    
+    // 并发解析全部尚未缓存的定义（按块并行，每个线程使用自己的 PROJ 上下文）
+    void preload(std::span<const std::string> definitions);
+    
+    // 已缓存的定义数（含无法识别的）
+    [[nodiscard]] size_t size() const;
+
+private:
+    CRSRegistry() = default;
+    
+    // 把查询结果登记到索引：权威代码已存在时复用已有对象
+    const CRSInfo* intern(const std::string& definition, std::optional<CRSInfo> info);
+    
+    mutable std::shared_mutex mutex_;
+    std::unordered_map<std::string, const CRSInfo*> index_;  // 定义或权威代码 -> 元数据
+    std::vector<std::unique_ptr<const CRSInfo>> storage_;
+};
+
+// 坐标参考系统：构造时经注册表解析一次，之后的查询都是成员访问与指针比较
 class CRS {
 public:
-    explicit CRS(const std::string& code) : code_(code) {}
+    explicit CRS(const std::string& code)
+        : code_(code), info_(CRSRegistry::instance().resolve(code)) {}
     
-    // 获取 CRS 代码
+    // 获取 CRS 代码（构造时给出的写法）
     const std::string& code() const noexcept { return code_; }
     
+    // 解析得到的元数据；PROJ 无法识别时为空
+    const CRSInfo* info() const noexcept { return info_; }
+    bool isValid() const noexcept { return info_ != nullptr; }
+    
     // 判断是否为地理坐标系
     bool isGeographic() const noexcept;
     
@@ -24,50 +95,89 @@ public:
     // 获取单位（米、度等）
     std::string getUnit() const noexcept;
     
+    // 同一 CRS 的不同写法相等；无法解析时按代码比较
+    bool operator==(const CRS& other) const noexcept {
+        return info_ && other.info_ ? info_ == other.info_ : code_ == other.code_;
+    }
+
 private:
     std::string code_;
+    const CRSInfo* info_;
+};
+
+// 坐标转换错误类型
+enum class TransformError {
+    InvalidCRS,       // PROJ 无法建立源/目标之间的转换
+    TransformFailed   // 至少一个点转换失败（超出定义域等）
 };
 
-// 坐标转换器
+// 高程基准：空指针表示椭球高，否则表示相对该大地水准面格网的正高（如 EGM96/EGM2008）
+using HeightDatum = std::shared_ptr<const GeoidGrid>;
+
+// 坐标转换器（PROJ）：轴顺序统一为经度在前；目标为地心坐标系时 longitude/latitude/altitude 依次存放 X/Y/Z。
+// PJ 对象不能跨线程共享，每个线程按 (源, 目标) 缓存自己的 PJ_CONTEXT/PJ，转换器本身可在线程间共享。
+// 源或目标为正高时，每块点先转到 WGS84 经纬度、按格网改正高程，再转到目标，与坐标转换在同一遍内完成；
+// 格网范围外的点按转换失败处理
 class CoordinateTransformer {
 public:
-    CoordinateTransformer(const CRS& sourceCRS, const CRS& targetCRS);
+    CoordinateTransformer(const CRS& sourceCRS, const CRS& targetCRS,
+                          HeightDatum sourceHeights = nullptr, HeightDatum targetHeights = nullptr);
     
     // 转换单个点
     std::optional<GeoPoint> transform(const GeoPoint& point) const;
     
-    // 转换包围盒
+    // 转换包围盒（沿边加密采样后取外包）
     std::optional<GeoBBox> transform(const GeoBBox& bbox) const;
     
-    // 批量转换
+    // 批量转换（丢弃转换失败的点）
     std::vector<GeoPoint> transform(const std::vector<GeoPoint>& points) const;
     
+    // 原地批量转换：按块并行，每块一次 proj_trans_generic
+    [[nodiscard]] std::expected<void, TransformError> transformInPlace(std::span<GeoPoint> points) const;
+    
+    // 原地批量转换 SoA 坐标数组；z 可为空（按高度 0 转换）
+    [[nodiscard]] std::expected<void, TransformError> transformInPlace(std::span<double> x, std::span<double> y,
+                                                                       std::span<double> z) const;
+    
+    const CRS& source() const noexcept { return sourceCRS_; }
+    const CRS& target() const noexcept { return targetCRS_; }
+
 private:
     CRS sourceCRS_;
     CRS targetCRS_;
+    HeightDatum sourceHeights_;
+    HeightDatum targetHeights_;
+    
+    bool isIdentity() const noexcept { return sourceCRS_ == targetCRS_ && sourceHeights_ == targetHeights_; }
+    
+    // 在 WGS84 经纬度下把一块点的高程由源基准改正到目标基准；格网外的点置为 HUGE_VAL（与 PROJ 的失败标记一致）
+    void applyHeightDatums(double* lon, double* lat, size_t stride, double* height, size_t heightStride,
+                           size_t count) const noexcept;
     
-    // 内部转换实现
-    std::optional<std::array<double, 3>> transformInternal(const std::array<double, 3>& coords) const;
+    // 步长数组上的分块并行转换，返回失败的点数；转换无法建立时返回错误
+    std::expected<size_t, TransformError> transformStrided(double* x, double* y, double* z,
+                                                           size_t stride, size_t count) const;
 };
 
-// 常用的坐标参考系统
+// 常用的坐标参考系统：首次调用时才经注册表解析（函数内静态对象），不在静态初始化阶段查询 PROJ 数据库
 namespace crs {
-    const CRS WGS84("EPSG:4326");          // WGS84 地理坐标系
-    const CRS WebMercator("EPSG:3857");    // Web 墨卡托投影
-    const CRS UTM_Zone_49N("EPSG:32649");  // UTM 49N 投影
-    const CRS UTM_Zone_50N("EPSG:32650");  // UTM 50N 投影
+    [[nodiscard]] const CRS& WGS84();         // WGS84 地理坐标系
+    [[nodiscard]] const CRS& ECEF();          // WGS84 地心坐标系
+    [[nodiscard]] const CRS& WebMercator();   // Web 墨卡托投影
+    [[nodiscard]] const CRS& UTM_Zone_49N();  // UTM 49N 投影
+    [[nodiscard]] const CRS& UTM_Zone_50N();  // UTM 50N 投影
 }
 
-// 工厂函数
+// 工厂函数：PROJ 无法识别时返回 nullopt
 [[nodiscard]] std::optional<CRS> createCRS(const std::string& code);
 
-// 辅助函数：从字符串解析 CRS
+// 辅助函数：从字符串解析 CRS（"EPSG:xxxx"、WKT、PROJ 字符串等）
 [[nodiscard]] std::optional<CRS> parseCRSFromString(const std::string& crsString);
 
-// 辅助函数：检查 CRS 是否有效
-[[nodiscard]] bool isValidCRS(const std::string& code) noexcept;
+// 辅助函数：检查 CRS 是否有效（经注册表缓存）
+[[nodiscard]] bool isValidCRS(const std::string& code);
 
-// 辅助函数：获取支持的 CRS 列表
-[[nodiscard]] std::vector<std::string> getSupportedCRS() noexcept;
+// 辅助函数：PROJ 数据库中全部未废弃的 EPSG CRS 代码（首次调用时查询并缓存）
+[[nodiscard]] std::vector<std::string> getSupportedCRS();
 
 } // namespace lod::geo 
\ No newline at end of file
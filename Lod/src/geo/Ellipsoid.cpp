@@ -0,0 +1,108 @@
+#include "geo/Ellipsoid.hpp"
+#include <tbb/parallel_for.h>
+#include <algorithm>
+#include <cmath>
+#include <numbers>
+
+namespace lod::geo {
+
+namespace {
+    constexpr double kDegreesToRadians = std::numbers::pi / 180.0;
+    constexpr double kRadiansToDegrees = 180.0 / std::numbers::pi;
+    
+    // Vermeille 闭式解用到的常量
+    constexpr double kInverseASquared = 1.0 / (wgs84::kSemiMajorAxis * wgs84::kSemiMajorAxis);
+    constexpr double kE2 = wgs84::kEccentricitySquared;
+    constexpr double kE4 = kE2 * kE2;
+    
+    // 每块点数：块内是紧凑的向量化循环，块间由 TBB 并行
+    constexpr size_t kBlockSize = size_t{1} << 14;
+    
+    template<typename Kernel>
+    void forEachBlock(size_t count, Kernel&& kernel) {
+        const size_t blockCount = (count + kBlockSize - 1) / kBlockSize;
+        tbb::parallel_for(size_t{0}, blockCount, [&](size_t block) {
+            const size_t begin = block * kBlockSize;
+            kernel(begin, std::min(begin + kBlockSize, count));
+        });
+    }
+    
+    inline void toEcef(double lonDegrees, double latDegrees, double height,
+                       double& x, double& y, double& z) noexcept {
+        const double lon = lonDegrees * kDegreesToRadians;
+        const double lat = latDegrees * kDegreesToRadians;
+        const double sinLat = std::sin(lat);
+        const double cosLat = std::cos(lat);
+        
+        // 卯酉圈曲率半径
+        const double n = wgs84::kSemiMajorAxis / std::sqrt(1.0 - kE2 * sinLat * sinLat);
+        const double horizontal = (n + height) * cosLat;
+        x = horizontal * std::cos(lon);
+        y = horizontal * std::sin(lon);
+        z = (n * (1.0 - kE2) + height) * sinLat;
+    }
+    
+    inline void toGeodetic(double x, double y, double z,
+                           double& lonDegrees, double& latDegrees, double& height) noexcept {
+        const double horizontalSquared = x * x + y * y;
+        const double horizontal = std::sqrt(horizontalSquared);
+        
+        const double p = horizontalSquared * kInverseASquared;
+        const double q = (1.0 - kE2) * kInverseASquared * z * z;
+        const double r = (p + q - kE4) / 6.0;
+        const double s = kE4 * p * q / (4.0 * r * r * r);
+        const double t = std::cbrt(1.0 + s + std::sqrt(s * (2.0 + s)));
+        const double u = r * (1.0 + t + 1.0 / t);
+        const double v = std::sqrt(u * u + kE4 * q);
+        const double w = kE2 * (u + v - q) / (2.0 * v);
+        const double k = std::sqrt(u + v + w * w) - w;
+        const double d = k * horizontal / (k + kE2);
+        const double dz = std::sqrt(d * d + z * z);
+        
+        lonDegrees = std::atan2(y, x) * kRadiansToDegrees;
+        latDegrees = 2.0 * std::atan2(z, d + dz) * kRadiansToDegrees;
+        height = (k + kE2 - 1.0) / k * dz;
+    }
+} // namespace
+
+Vec3d geodeticToEcef(const GeoPoint& point) noexcept {
+    Vec3d ecef;
+    toEcef(point.longitude, point.latitude, point.altitude, ecef[0], ecef[1], ecef[2]);
+    return ecef;
+}
+
+GeoPoint ecefToGeodetic(const Vec3d& ecef) noexcept {
+    GeoPoint point;
+    toGeodetic(ecef[0], ecef[1], ecef[2], point.longitude, point.latitude, point.altitude);
+    return point;
+}
+
+void geodeticToEcef(std::span<const double> lon, std::span<const double> lat, std::span<const double> height,
+                    std::span<double> x, std::span<double> y, std::span<double> z) {
+    const size_t count = std::min({lon.size(), lat.size(), height.size(), x.size(), y.size(), z.size()});
+    forEachBlock(count, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            double ox, oy, oz;
+            toEcef(lon[i], lat[i], height[i], ox, oy, oz);
+            x[i] = ox;
+            y[i] = oy;
+            z[i] = oz;
+        }
+    });
+}
+
+void ecefToGeodetic(std::span<const double> x, std::span<const double> y, std::span<const double> z,
+                    std::span<double> lon, std::span<double> lat, std::span<double> height) {
+    const size_t count = std::min({x.size(), y.size(), z.size(), lon.size(), lat.size(), height.size()});
+    forEachBlock(count, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            double oLon, oLat, oHeight;
+            toGeodetic(x[i], y[i], z[i], oLon, oLat, oHeight);
+            lon[i] = oLon;
+            lat[i] = oLat;
+            height[i] = oHeight;
+        }
+    });
+}
+
+} // namespace lod::geo
@@ -0,0 +1,35 @@
+#pragma once
+
+#include "GeoBBox.hpp"
+#include <array>
+#include <span>
+
+namespace lod::geo {
+
+// 双精度三维向量（地心坐标或局部坐标，米）
+using Vec3d = std::array<double, 3>;
+
+// WGS84 椭球参数
+namespace wgs84 {
+    constexpr double kSemiMajorAxis = 6378137.0;
+    constexpr double kFlattening = 1.0 / 298.257223563;
+    constexpr double kSemiMinorAxis = kSemiMajorAxis * (1.0 - kFlattening);
+    constexpr double kEccentricitySquared = kFlattening * (2.0 - kFlattening);
+}
+
+// 纯函数：WGS84 大地坐标（度、椭球高）转地心地固坐标（ECEF）
+[[nodiscard]] Vec3d geodeticToEcef(const GeoPoint& point) noexcept;
+
+// 纯函数：ECEF 转 WGS84 大地坐标，Vermeille (2011) 闭式解，无迭代、无分支；
+// 适用于距地心远大于 e²a（约 43 km）的点，地表附近精度优于 1e-9 度与 1 µm
+[[nodiscard]] GeoPoint ecefToGeodetic(const Vec3d& ecef) noexcept;
+
+// 批量版本，作用于 SoA 双精度数组：按块并行，块内循环无分支、无跨迭代依赖以便编译器向量化。
+// 各数组长度须相同；输出可与输入为同一数组（原地转换）
+void geodeticToEcef(std::span<const double> lon, std::span<const double> lat, std::span<const double> height,
+                    std::span<double> x, std::span<double> y, std::span<double> z);
+
+void ecefToGeodetic(std::span<const double> x, std::span<const double> y, std::span<const double> z,
+                    std::span<double> lon, std::span<double> lat, std::span<double> height);
+
+} // namespace lod::geo
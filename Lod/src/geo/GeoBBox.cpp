@@ -1,5 +1,7 @@
 #define _USE_MATH_DEFINES
 #include "geo/GeoBBox.hpp"
+#include "geo/Ellipsoid.hpp"
+#include <geodesic.h>
 #include <cmath>
 #include <algorithm>
 #include <numeric>
@@ -7,8 +9,9 @@
 namespace lod::geo {
 
 namespace {
-    // 地球半径（米）
-    constexpr double EARTH_RADIUS = 6378137.0;
+    // 纬度带表的步长（度）与带数（覆盖 -90° 到 90°，含两端）
+    constexpr double kBandStep = 0.1;
+    constexpr size_t kBandCount = 1801;
     
     // 角度转弧度
     constexpr double toRadians(double degrees) {
@@ -30,31 +33,32 @@ std::optional<GeoBBox> computeBounds(std::span<const GeoPoint> points) noexcept
     auto maxLon = points[0].longitude;
     auto minLat = points[0].latitude;
     auto maxLat = points[0].latitude;
+    auto minHeight = points[0].altitude;
+    auto maxHeight = points[0].altitude;
     
     for (const auto& point : points) {
         minLon = std::min(minLon, point.longitude);
         maxLon = std::max(maxLon, point.longitude);
         minLat = std::min(minLat, point.latitude);
         maxLat = std::max(maxLat, point.latitude);
+        minHeight = std::min(minHeight, point.altitude);
+        maxHeight = std::max(maxHeight, point.altitude);
     }
     
-    return GeoBBox{minLon, minLat, maxLon, maxLat};
+    return GeoBBox{minLon, minLat, maxLon, maxLat, minHeight, maxHeight};
 }
 
 double distanceMeters(const GeoPoint& p1, const GeoPoint& p2) noexcept {
-    // 使用 Haversine 公式计算球面距离
-    const double lat1 = toRadians(p1.latitude);
-    const double lat2 = toRadians(p2.latitude);
-    const double deltaLat = toRadians(p2.latitude - p1.latitude);
-    const double deltaLon = toRadians(p2.longitude - p1.longitude);
+    // PROJ 自带的 Karney 测地线算法：全球任意两点（含近对跖点）均收敛，精度达纳米级
+    static const geod_geodesic geodesic = [] {
+        geod_geodesic g;
+        geod_init(&g, wgs84::kSemiMajorAxis, wgs84::kFlattening);
+        return g;
+    }();
     
-    const double a = std::sin(deltaLat / 2) * std::sin(deltaLat / 2) +
-                     std::cos(lat1) * std::cos(lat2) *
-                     std::sin(deltaLon / 2) * std::sin(deltaLon / 2);
-    
-    const double c = 2 * std::atan2(std::sqrt(a), std::sqrt(1 - a));
-    
-    return EARTH_RADIUS * c;
+    double distance = 0.0;
+    geod_inverse(&geodesic, p1.latitude, p1.longitude, p2.latitude, p2.longitude, &distance, nullptr, nullptr);
+    return distance;
 }
 
 double areaSquareMeters(const GeoBBox& bbox) noexcept {
@@ -62,21 +66,85 @@ double areaSquareMeters(const GeoBBox& bbox) noexcept {
         return 0.0;
     }
     
-    // 近似计算：对于小区域，使用简化的投影面积
-    const double lat1 = toRadians(bbox.minLat);
-    const double lat2 = toRadians(bbox.maxLat);
-    const double deltaLon = toRadians(bbox.width());
-    const double deltaLat = toRadians(bbox.height());
+    // 经纬度矩形的边是纬线而非测地线，面积有闭式解：
+    // A = b² / 2 · Δλ · [q(φ2) - q(φ1)]，q(φ) = sinφ / (1 - e² sin²φ) + artanh(e sinφ) / e
+    const double e = std::sqrt(wgs84::kEccentricitySquared);
+    const auto q = [e](double latitude) {
+        const double s = std::sin(toRadians(latitude));
+        return s / (1.0 - e * e * s * s) + std::atanh(e * s) / e;
+    };
     
-    // 使用平均纬度来修正经度的变形
-    const double avgLat = (lat1 + lat2) / 2;
-    const double adjustedDeltaLon = deltaLon * std::cos(avgLat);
+    const double b = wgs84::kSemiMinorAxis;
+    return 0.5 * b * b * toRadians(bbox.width()) * (q(bbox.maxLat) - q(bbox.minLat));
+}
+
+namespace {
+    struct LatitudeBand {
+        double metersPerDegreeLon;
+        double metersPerDegreeLat;
+        double meridianArc;  // 自赤道起算的子午线弧长（米），南半球为负
+    };
     
-    // 转换为米并计算面积
-    const double latMeters = deltaLat * EARTH_RADIUS;
-    const double lonMeters = adjustedDeltaLon * EARTH_RADIUS;
+    // 子午线弧长的 Helmert 级数（第三扁率 n 展开到 n⁴，误差远小于 1 mm）
+    double meridianArc(double latitude) noexcept {
+        constexpr double n = wgs84::kFlattening / (2.0 - wgs84::kFlattening);
+        const double phi = toRadians(latitude);
+        return wgs84::kSemiMajorAxis / (1.0 + n) *
+               ((1.0 + n * n / 4.0 + n * n * n * n / 64.0) * phi -
+                1.5 * (n - n * n * n / 8.0) * std::sin(2.0 * phi) +
+                15.0 / 16.0 * (n * n - n * n * n * n / 4.0) * std::sin(4.0 * phi) -
+                35.0 / 48.0 * n * n * n * std::sin(6.0 * phi) +
+                315.0 / 512.0 * n * n * n * n * std::sin(8.0 * phi));
+    }
+    
+    // 首次使用时构建，之后只读，可被多线程并发访问
+    const std::array<LatitudeBand, kBandCount>& latitudeBands() noexcept {
+        static const auto table = [] {
+            std::array<LatitudeBand, kBandCount> bands{};
+            for (size_t i = 0; i < kBandCount; ++i) {
+                const double latitude = -90.0 + kBandStep * static_cast<double>(i);
+                const double s = std::sin(toRadians(latitude));
+                const double w = std::sqrt(1.0 - wgs84::kEccentricitySquared * s * s);
+                const double primeVertical = wgs84::kSemiMajorAxis / w;
+                const double meridional = wgs84::kSemiMajorAxis * (1.0 - wgs84::kEccentricitySquared) / (w * w * w);
+                bands[i] = {toRadians(primeVertical * std::cos(toRadians(latitude))), toRadians(meridional),
+                            meridianArc(latitude)};
+            }
+            // 极点处纬线退化为一点
+            bands.front().metersPerDegreeLon = 0.0;
+            bands.back().metersPerDegreeLon = 0.0;
+            return bands;
+        }();
+        return table;
+    }
     
-    return latMeters * lonMeters;
+    // 按纬度在表中线性插值
+    template<typename Field>
+    double interpolateBand(double latitude, Field field) noexcept {
+        const auto& bands = latitudeBands();
+        const double t = (std::clamp(latitude, -90.0, 90.0) + 90.0) / kBandStep;
+        const size_t i = std::min(static_cast<size_t>(t), kBandCount - 2);
+        const double fraction = t - static_cast<double>(i);
+        return (1.0 - fraction) * bands[i].*field + fraction * bands[i + 1].*field;
+    }
+}
+
+double metersPerDegreeLon(double lat) noexcept {
+    return interpolateBand(lat, &LatitudeBand::metersPerDegreeLon);
+}
+
+double metersPerDegreeLat(double lat) noexcept {
+    return interpolateBand(lat, &LatitudeBand::metersPerDegreeLat);
+}
+
+double widthMeters(const GeoBBox& bbox) noexcept {
+    const double widestLat = bbox.minLat > 0.0 ? bbox.minLat : (bbox.maxLat < 0.0 ? bbox.maxLat : 0.0);
+    return std::max(bbox.width(), 0.0) * metersPerDegreeLon(widestLat);
+}
+
+double heightMeters(const GeoBBox& bbox) noexcept {
+    return std::max(interpolateBand(bbox.maxLat, &LatitudeBand::meridianArc) -
+                    interpolateBand(bbox.minLat, &LatitudeBand::meridianArc), 0.0);
 }
 
 } // namespace lod::geo 
\ No newline at end of file
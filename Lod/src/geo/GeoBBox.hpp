@@ -1,21 +1,26 @@
 #pragma once
 
+#include <algorithm>
 #include <array>
 #include <vector>
 #include <optional>
 
 namespace lod::geo {
 
-// WGS84 地理坐标包围盒
+// WGS84 地理坐标包围盒（带椭球高范围，米）
 struct GeoBBox {
     double minLon{0.0};
     double minLat{0.0};
     double maxLon{0.0};
     double maxLat{0.0};
+    double minHeight{0.0};
+    double maxHeight{0.0};
     
     constexpr GeoBBox() = default;
-    constexpr GeoBBox(double minLon, double minLat, double maxLon, double maxLat)
-        : minLon(minLon), minLat(minLat), maxLon(maxLon), maxLat(maxLat) {}
+    constexpr GeoBBox(double minLon, double minLat, double maxLon, double maxLat,
+                      double minHeight = 0.0, double maxHeight = 0.0)
+        : minLon(minLon), minLat(minLat), maxLon(maxLon), maxLat(maxLat),
+          minHeight(minHeight), maxHeight(maxHeight) {}
     
     // 查询方法
     constexpr double width() const noexcept { return maxLon - minLon; }
@@ -39,7 +44,9 @@ struct GeoBBox {
             std::max(minLon, other.minLon),
             std::max(minLat, other.minLat),
             std::min(maxLon, other.maxLon),
-            std::min(maxLat, other.maxLat)
+            std::min(maxLat, other.maxLat),
+            std::max(minHeight, other.minHeight),
+            std::min(maxHeight, other.maxHeight)
         };
     }
     
@@ -48,20 +55,32 @@ struct GeoBBox {
             std::min(minLon, other.minLon),
             std::min(minLat, other.minLat),
             std::max(maxLon, other.maxLon),
-            std::max(maxLat, other.maxLat)
+            std::max(maxLat, other.maxLat),
+            std::min(minHeight, other.minHeight),
+            std::max(maxHeight, other.maxHeight)
         };
     }
     
-    // 四叉树分割
+    // 替换高度范围
+    constexpr GeoBBox withHeights(double newMinHeight, double newMaxHeight) const noexcept {
+        return GeoBBox{minLon, minLat, maxLon, maxLat, newMinHeight, newMaxHeight};
+    }
+    
+    // 四叉树分割（几何中心）
     constexpr std::array<GeoBBox, 4> subdivide() const noexcept {
-        const double midLon = centerLon();
-        const double midLat = centerLat();
+        return subdivide(centerLon(), centerLat());
+    }
+    
+    // 四叉树分割（指定划分点，越界时夹取到包围盒内）；子区域沿用父区域的高度范围
+    constexpr std::array<GeoBBox, 4> subdivide(double splitLon, double splitLat) const noexcept {
+        const double midLon = std::clamp(splitLon, minLon, maxLon);
+        const double midLat = std::clamp(splitLat, minLat, maxLat);
         
         return {{
-            {minLon, minLat, midLon, midLat},  // SW
-            {midLon, minLat, maxLon, midLat},  // SE
-            {minLon, midLat, midLon, maxLat},  // NW
-            {midLon, midLat, maxLon, maxLat}   // NE
+            {minLon, minLat, midLon, midLat, minHeight, maxHeight},  // SW
+            {midLon, minLat, maxLon, midLat, minHeight, maxHeight},  // SE
+            {minLon, midLat, midLon, maxLat, minHeight, maxHeight},  // NW
+            {midLon, midLat, maxLon, maxLat, minHeight, maxHeight}   // NE
         }};
     }
 };
@@ -80,12 +99,21 @@ struct GeoPoint {
 // 纯函数：从点集合计算包围盒
 [[nodiscard]] std::optional<GeoBBox> computeBounds(const std::vector<GeoPoint>& points) noexcept;
 
-// 纯函数：计算两点间距离（米）
+// 纯函数：两点间 WGS84 椭球面上的测地线距离（米，Karney 算法，忽略高度）
 [[nodiscard]] double distanceMeters(const GeoPoint& p1, const GeoPoint& p2) noexcept;
 
-// 纯函数：包围盒面积（平方米）
+// 纯函数：包围盒在 WGS84 椭球面上的精确面积（平方米）
 [[nodiscard]] double areaSquareMeters(const GeoBBox& bbox) noexcept;
 
+// 纯函数：纬度 lat 处每度经度、每度纬度对应的椭球面长度（米）。
+// 由按 0.1° 纬度带缓存的表线性插值得到，只需一次查表，可用于逐节点的热路径
+[[nodiscard]] double metersPerDegreeLon(double lat) noexcept;
+[[nodiscard]] double metersPerDegreeLat(double lat) noexcept;
+
+// 纯函数：包围盒东西向宽度（取最靠近赤道、即最长的纬线）与南北向高度（子午线弧长），米
+[[nodiscard]] double widthMeters(const GeoBBox& bbox) noexcept;
+[[nodiscard]] double heightMeters(const GeoBBox& bbox) noexcept;
+
 // 计算多个地理点的边界框
 GeoBBox computeBounds(const std::vector<GeoPoint>& points);
 
@@ -0,0 +1,200 @@
+#include "GeoidGrid.hpp"
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace lod::geo {
+
+namespace {
+    constexpr std::size_t kHeaderSize = 40;
+    
+    // GTX 的无数据标记
+    constexpr float kNoData = -88.8888f;
+    
+    template<typename T>
+    T readBigEndian(const std::byte* bytes) noexcept {
+        using Bits = std::conditional_t<sizeof(T) == 8, std::uint64_t, std::uint32_t>;
+        Bits bits;
+        std::memcpy(&bits, bytes, sizeof(bits));
+        if constexpr (std::endian::native == std::endian::little) {
+            bits = std::byteswap(bits);
+        }
+        return std::bit_cast<T>(bits);
+    }
+    
+    struct MappedFile {
+        std::shared_ptr<const std::byte> data;
+        std::size_t size{0};
+    };
+    
+    // 只读映射整个文件；映射建立后文件句柄即可关闭，映射随最后一个 shared_ptr 释放
+    std::expected<MappedFile, GeoidError> mapFile(const std::filesystem::path& path) {
+#ifdef _WIN32
+        const HANDLE file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                                        FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE) {
+            return std::unexpected(GeoidError::FileNotFound);
+        }
+        LARGE_INTEGER fileSize{};
+        GetFileSizeEx(file, &fileSize);
+        const HANDLE mapping = fileSize.QuadPart > 0
+            ? CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr) : nullptr;
+        CloseHandle(file);
+        if (!mapping) {
+            return std::unexpected(GeoidError::MapFailed);
+        }
+        const void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+        CloseHandle(mapping);
+        if (!view) {
+            return std::unexpected(GeoidError::MapFailed);
+        }
+        return MappedFile{
+            std::shared_ptr<const std::byte>(static_cast<const std::byte*>(view),
+                                             [](const std::byte* p) { UnmapViewOfFile(p); }),
+            static_cast<std::size_t>(fileSize.QuadPart)};
+#else
+        const int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) {
+            return std::unexpected(GeoidError::FileNotFound);
+        }
+        struct stat info {};
+        if (::fstat(fd, &info) != 0 || info.st_size <= 0) {
+            ::close(fd);
+            return std::unexpected(GeoidError::MapFailed);
+        }
+        const auto size = static_cast<std::size_t>(info.st_size);
+        void* data = ::mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+        ::close(fd);
+        if (data == MAP_FAILED) {
+            return std::unexpected(GeoidError::MapFailed);
+        }
+        return MappedFile{
+            std::shared_ptr<const std::byte>(static_cast<const std::byte*>(data),
+                                             [size](const std::byte* p) { ::munmap(const_cast<std::byte*>(p), size); }),
+            size};
+#endif
+    }
+} // namespace
+
+std::expected<std::shared_ptr<const GeoidGrid>, GeoidError> GeoidGrid::open(const std::filesystem::path& path) {
+    static std::mutex mutex;
+    static std::unordered_map<std::string, std::shared_ptr<const GeoidGrid>> cache;
+    
+    std::error_code error;
+    const auto canonical = std::filesystem::weakly_canonical(path, error);
+    const std::string key = (error ? path : canonical).string();
+    
+    // 映射只在首次打开时进行，数据页由操作系统在各线程访问时按需载入
+    std::lock_guard lock(mutex);
+    if (const auto it = cache.find(key); it != cache.end()) {
+        return it->second;
+    }
+    
+    auto file = mapFile(path);
+    if (!file) {
+        return std::unexpected(file.error());
+    }
+    if (file->size < kHeaderSize) {
+        return std::unexpected(GeoidError::InvalidFormat);
+    }
+    
+    std::shared_ptr<GeoidGrid> grid(new GeoidGrid());
+    const std::byte* header = file->data.get();
+    grid->south_ = readBigEndian<double>(header);
+    grid->west_ = readBigEndian<double>(header + 8);
+    grid->latStep_ = readBigEndian<double>(header + 16);
+    grid->lonStep_ = readBigEndian<double>(header + 24);
+    const auto rows = readBigEndian<std::int32_t>(header + 32);
+    const auto columns = readBigEndian<std::int32_t>(header + 36);
+    if (rows < 2 || columns < 2 || !(grid->latStep_ > 0.0) || !(grid->lonStep_ > 0.0) ||
+        file->size < kHeaderSize + std::size_t{4} * static_cast<std::size_t>(rows) * static_cast<std::size_t>(columns)) {
+        return std::unexpected(GeoidError::InvalidFormat);
+    }
+    
+    grid->path_ = path;
+    grid->rows_ = static_cast<std::size_t>(rows);
+    grid->columns_ = static_cast<std::size_t>(columns);
+    grid->values_ = header + kHeaderSize;
+    grid->mapping_ = std::move(file->data);
+    
+    // 一周恰好整数列时按全球格网处理，经度可环绕
+    const double turn = 360.0 / grid->lonStep_;
+    if (std::abs(turn - std::round(turn)) < 1e-6 && static_cast<double>(grid->columns_) >= std::round(turn)) {
+        grid->columnsPerTurn_ = static_cast<std::size_t>(std::round(turn));
+    }
+    
+    cache.emplace(key, grid);
+    return grid;
+}
+
+float GeoidGrid::value(std::size_t row, std::size_t col) const noexcept {
+    return readBigEndian<float>(values_ + 4 * (row * columns_ + col));
+}
+
+std::optional<double> GeoidGrid::undulation(double lon, double lat) const noexcept {
+    const double v = (lat - south_) / latStep_;
+    double u = (lon - west_) / lonStep_;
+    const double lastColumn = static_cast<double>(columns_ - 1);
+    if (columnsPerTurn_ > 0) {
+        u = std::fmod(u, static_cast<double>(columnsPerTurn_));
+        u += u < 0.0 ? static_cast<double>(columnsPerTurn_) : 0.0;
+    }
+    if (!(v >= 0.0 && v <= static_cast<double>(rows_ - 1)) || !(u >= 0.0 && (columnsPerTurn_ > 0 || u <= lastColumn))) {
+        return std::nullopt;
+    }
+    
+    const auto row = std::min(static_cast<std::size_t>(v), rows_ - 2);
+    auto col = static_cast<std::size_t>(u);
+    double fu = u - static_cast<double>(col);
+    if (columnsPerTurn_ == 0) {
+        col = std::min(col, columns_ - 2);
+        fu = u - static_cast<double>(col);
+    } else {
+        // 紧挨首列以西的经度环绕后可能舍入为恰好一周，此时即首列
+        col %= columnsPerTurn_;
+    }
+    auto nextCol = col + 1;
+    if (nextCol >= columns_) {
+        // 全球格网末列之后环绕回首列
+        nextCol -= columnsPerTurn_;
+    }
+    const double fv = v - static_cast<double>(row);
+    
+    const float v00 = value(row, col);
+    const float v01 = value(row, nextCol);
+    const float v10 = value(row + 1, col);
+    const float v11 = value(row + 1, nextCol);
+    for (const float sample : {v00, v01, v10, v11}) {
+        if (std::abs(sample - kNoData) < 1e-3f || !std::isfinite(sample)) {
+            return std::nullopt;
+        }
+    }
+    
+    return (1.0 - fv) * ((1.0 - fu) * v00 + fu * v01) + fv * ((1.0 - fu) * v10 + fu * v11);
+}
+
+GeoBBox GeoidGrid::coverage() const noexcept {
+    return {west_, south_,
+            west_ + lonStep_ * static_cast<double>(columns_ - 1),
+            south_ + latStep_ * static_cast<double>(rows_ - 1)};
+}
+
+} // namespace lod::geo
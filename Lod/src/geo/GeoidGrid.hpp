@@ -0,0 +1,55 @@
+#pragma once
+
+#include "GeoBBox.hpp"
+#include <cstddef>
+#include <expected>
+#include <filesystem>
+#include <memory>
+#include <optional>
+
+namespace lod::geo {
+
+// 大地水准面格网错误类型
+enum class GeoidError {
+    FileNotFound,
+    InvalidFormat,
+    MapFailed
+};
+
+// 大地水准面起伏格网（GTX 格式：40 字节大端文件头 + 自南向北逐行、行内自西向东的大端 float32 起伏值，米），
+// 如 PROJ 发布的 egm96_15.gtx、egm08_25.gtx。文件只读内存映射、按需分页载入，
+// 同一文件在进程内只映射一次，所有线程共享同一份只读数据
+class GeoidGrid {
+public:
+    // 打开格网文件；已打开过的文件直接返回缓存的实例
+    [[nodiscard]] static std::expected<std::shared_ptr<const GeoidGrid>, GeoidError>
+    open(const std::filesystem::path& path);
+    
+    // (lon, lat) 处双线性插值的起伏 N（米），椭球高 h 与正高 H 满足 h = H + N；
+    // 超出格网范围或邻近格点无数据时返回 nullopt
+    [[nodiscard]] std::optional<double> undulation(double lon, double lat) const noexcept;
+    
+    // 格网覆盖的经纬度范围
+    [[nodiscard]] GeoBBox coverage() const noexcept;
+    
+    [[nodiscard]] const std::filesystem::path& path() const noexcept { return path_; }
+
+private:
+    GeoidGrid() = default;
+    
+    // 第 row 行第 col 列的格点值（已转为本机字节序）
+    float value(std::size_t row, std::size_t col) const noexcept;
+    
+    std::filesystem::path path_;
+    std::shared_ptr<const std::byte> mapping_;  // 映射首地址，删除器负责解除映射
+    const std::byte* values_{nullptr};
+    double south_{0.0};
+    double west_{0.0};
+    double latStep_{0.0};
+    double lonStep_{0.0};
+    std::size_t rows_{0};
+    std::size_t columns_{0};
+    std::size_t columnsPerTurn_{0};  // 格网环绕全球时一周的列数，否则为 0
+};
+
+} // namespace lod::geo
@@ -0,0 +1,83 @@
+#include "geo/LocalFrame.hpp"
+#include <algorithm>
+#include <cmath>
+#include <numbers>
+
+namespace lod::geo {
+
+namespace {
+    constexpr double toRadians(double degrees) {
+        return degrees * std::numbers::pi / 180.0;
+    }
+    
+    constexpr double dot(const Vec3d& a, const Vec3d& b) noexcept {
+        return a[0] * b[0] + a[1] * b[1] + a[2] * b[2];
+    }
+} // namespace
+
+LocalFrame LocalFrame::enuAt(const GeoPoint& origin) noexcept {
+    const double lon = toRadians(origin.longitude);
+    const double lat = toRadians(origin.latitude);
+    const double sinLon = std::sin(lon);
+    const double cosLon = std::cos(lon);
+    const double sinLat = std::sin(lat);
+    const double cosLat = std::cos(lat);
+    
+    LocalFrame frame;
+    frame.origin_ = origin;
+    frame.originEcef_ = geodeticToEcef(origin);
+    frame.east_ = {-sinLon, cosLon, 0.0};
+    frame.north_ = {-sinLat * cosLon, -sinLat * sinLon, cosLat};
+    frame.up_ = {cosLat * cosLon, cosLat * sinLon, sinLat};
+    return frame;
+}
+
+LocalFrame LocalFrame::enuAt(const GeoBBox& region) noexcept {
+    return enuAt(GeoPoint{region.centerLon(), region.centerLat(), 0.0});
+}
+
+Vec3d LocalFrame::toEcef(const Vec3d& local) const noexcept {
+    const auto offset = directionToEcef(local);
+    return {originEcef_[0] + offset[0], originEcef_[1] + offset[1], originEcef_[2] + offset[2]};
+}
+
+Vec3d LocalFrame::toLocal(const Vec3d& ecef) const noexcept {
+    return directionToLocal({ecef[0] - originEcef_[0], ecef[1] - originEcef_[1], ecef[2] - originEcef_[2]});
+}
+
+Vec3d LocalFrame::directionToEcef(const Vec3d& local) const noexcept {
+    return {east_[0] * local[0] + north_[0] * local[1] + up_[0] * local[2],
+            east_[1] * local[0] + north_[1] * local[1] + up_[1] * local[2],
+            east_[2] * local[0] + north_[2] * local[1] + up_[2] * local[2]};
+}
+
+Vec3d LocalFrame::directionToLocal(const Vec3d& ecef) const noexcept {
+    return {dot(east_, ecef), dot(north_, ecef), dot(up_, ecef)};
+}
+
+std::array<double, 16> LocalFrame::toEcefMatrix() const noexcept {
+    return {east_[0], east_[1], east_[2], 0.0,
+            north_[0], north_[1], north_[2], 0.0,
+            up_[0], up_[1], up_[2], 0.0,
+            originEcef_[0], originEcef_[1], originEcef_[2], 1.0};
+}
+
+void LocalFrame::toLocal(std::span<const double> x, std::span<const double> y, std::span<const double> z,
+                         std::span<std::array<float, 3>> local) const noexcept {
+    const size_t count = std::min({x.size(), y.size(), z.size(), local.size()});
+    const auto [ox, oy, oz] = originEcef_;
+    const auto [ex, ey, ez] = east_;
+    const auto [nx, ny, nz] = north_;
+    const auto [ux, uy, uz] = up_;
+    
+    for (size_t i = 0; i < count; ++i) {
+        const double dx = x[i] - ox;
+        const double dy = y[i] - oy;
+        const double dz = z[i] - oz;
+        local[i] = {static_cast<float>(ex * dx + ey * dy + ez * dz),
+                    static_cast<float>(nx * dx + ny * dy + nz * dz),
+                    static_cast<float>(ux * dx + uy * dy + uz * dz)};
+    }
+}
+
+} // namespace lod::geo
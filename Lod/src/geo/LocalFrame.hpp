@@ -0,0 +1,49 @@
+#pragma once
+
+#include "Ellipsoid.hpp"
+#include <array>
+#include <span>
+
+namespace lod::geo {
+
+// 以某个大地坐标点为原点的东-北-天（ENU）局部坐标系。
+// 原点与旋转均为双精度，局部偏移可安全地降为 float：距原点 100 km 内 float 精度优于 1 cm，
+// 而直接以 float 存放地心坐标（量级 6.4e6 m）时精度只有约 0.5 m
+class LocalFrame {
+public:
+    LocalFrame() = default;
+    
+    // 以 origin 为原点的 ENU 坐标系
+    [[nodiscard]] static LocalFrame enuAt(const GeoPoint& origin) noexcept;
+    
+    // 以区域中心（椭球面上）为原点的 ENU 坐标系；相同区域总是得到相同的坐标系
+    [[nodiscard]] static LocalFrame enuAt(const GeoBBox& region) noexcept;
+    
+    [[nodiscard]] const GeoPoint& origin() const noexcept { return origin_; }
+    [[nodiscard]] const Vec3d& originEcef() const noexcept { return originEcef_; }
+    
+    // 点的坐标变换（含平移）
+    [[nodiscard]] Vec3d toEcef(const Vec3d& local) const noexcept;
+    [[nodiscard]] Vec3d toLocal(const Vec3d& ecef) const noexcept;
+    
+    // 方向的坐标变换（仅旋转），用于法线
+    [[nodiscard]] Vec3d directionToEcef(const Vec3d& local) const noexcept;
+    [[nodiscard]] Vec3d directionToLocal(const Vec3d& ecef) const noexcept;
+    
+    // 局部到地心的 4x4 变换矩阵（列主序），即 3D Tiles 瓦片的 transform
+    [[nodiscard]] std::array<double, 16> toEcefMatrix() const noexcept;
+    
+    // 批量把 SoA 地心坐标转换为 float 局部偏移：减原点与旋转在双精度下完成，最后一步才降为 float。
+    // 循环体无分支、无跨迭代依赖，编译器可自动向量化
+    void toLocal(std::span<const double> x, std::span<const double> y, std::span<const double> z,
+                 std::span<std::array<float, 3>> local) const noexcept;
+
+private:
+    GeoPoint origin_;
+    Vec3d originEcef_{0.0, 0.0, 0.0};
+    Vec3d east_{1.0, 0.0, 0.0};
+    Vec3d north_{0.0, 1.0, 0.0};
+    Vec3d up_{0.0, 0.0, 1.0};
+};
+
+} // namespace lod::geo
@@ -0,0 +1,103 @@
+#define _USE_MATH_DEFINES
+#include "geo/TilingScheme.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace lod::geo {
+
+namespace {
+    // Web 墨卡托的纬度上限：使投影后的世界为正方形
+    constexpr double kMaxMercatorLat = 85.051128779806604;
+    
+    // 比较瓦片边界时的容差（度）
+    constexpr double kBoundsTolerance = 1e-9;
+    
+    // [0, 1) 上的归一化坐标映射到 [0, count) 上的整数格号
+    std::uint32_t toFixed(double normalized, std::uint64_t count) noexcept {
+        const double scaled = std::floor(normalized * static_cast<double>(count));
+        return static_cast<std::uint32_t>(std::clamp(scaled, 0.0, static_cast<double>(count - 1)));
+    }
+    
+    // Web 墨卡托：归一化行坐标（0 为北边界）对应的纬度
+    double mercatorLatitude(double normalizedY) noexcept {
+        return std::atan(std::sinh(M_PI * (1.0 - 2.0 * normalizedY))) * 180.0 / M_PI;
+    }
+}
+
+GeoBBox TilingScheme::extent() const noexcept {
+    return type_ == TilingSchemeType::Geodetic ? GeoBBox{-180.0, -90.0, 180.0, 90.0}
+                                               : GeoBBox{-180.0, -kMaxMercatorLat, 180.0, kMaxMercatorLat};
+}
+
+TileCoord TilingScheme::coordAt(double lon, double lat) const noexcept {
+    const std::uint64_t columns = tilesX(kMaxLevel);
+    const std::uint64_t rows = tilesY(kMaxLevel);
+    const double u = (lon + 180.0) / 360.0;
+    if (type_ == TilingSchemeType::Geodetic) {
+        return {toFixed(u, columns), toFixed((lat + 90.0) / 180.0, rows)};
+    }
+    
+    const double s = std::sin(std::clamp(lat, -kMaxMercatorLat, kMaxMercatorLat) * M_PI / 180.0);
+    const double v = 0.5 - std::log((1.0 + s) / (1.0 - s)) / (4.0 * M_PI);
+    return {toFixed(u, columns), toFixed(v, rows)};
+}
+
+GeoBBox TilingScheme::bounds(const TileKey& key) const noexcept {
+    const double columns = tilesX(key.z);
+    const double rows = tilesY(key.z);
+    const double minLon = -180.0 + 360.0 * key.x / columns;
+    const double maxLon = -180.0 + 360.0 * (key.x + 1) / columns;
+    if (type_ == TilingSchemeType::Geodetic) {
+        return {minLon, -90.0 + 180.0 * key.y / rows, maxLon, -90.0 + 180.0 * (key.y + 1) / rows};
+    }
+    return {minLon, mercatorLatitude((key.y + 1) / rows), maxLon, mercatorLatitude(key.y / rows)};
+}
+
+std::optional<TileKey> TilingScheme::enclosingTile(const GeoBBox& bbox) const noexcept {
+    const auto a = coordAt(bbox.minLon, bbox.minLat);
+    const auto b = coordAt(bbox.maxLon, bbox.maxLat);
+    for (auto z = kMaxLevel + 1; z-- > 0;) {
+        const auto keyA = keyAt(a, z);
+        const auto keyB = keyAt(b, z);
+        if (keyA == keyB) {
+            return keyA;
+        }
+    }
+    return std::nullopt;
+}
+
+std::vector<TileKey> TilingScheme::tilesAt(const GeoBBox& bbox, std::uint32_t z) const {
+    std::vector<TileKey> keys;
+    if (!bbox.intersects(extent())) {
+        return keys;
+    }
+    const auto a = keyAt(bbox.minLon, bbox.minLat, z);
+    const auto b = keyAt(bbox.maxLon, bbox.maxLat, z);
+    for (auto y = std::min(a.y, b.y); y <= std::max(a.y, b.y); ++y) {
+        for (auto x = a.x; x <= b.x; ++x) {
+            keys.push_back({z, x, y});
+        }
+    }
+    return keys;
+}
+
+std::optional<TileKey> TilingScheme::keyOf(const GeoBBox& region) const noexcept {
+    if (region.width() <= 0.0) {
+        return std::nullopt;
+    }
+    const double level = std::log2(360.0 / region.width()) - (type_ == TilingSchemeType::Geodetic ? 1.0 : 0.0);
+    const double z = std::round(level);
+    if (z < 0.0 || z > kMaxLevel || std::abs(level - z) > 1e-6) {
+        return std::nullopt;
+    }
+    
+    const auto key = keyAt(region.centerLon(), region.centerLat(), static_cast<std::uint32_t>(z));
+    const auto tile = bounds(key);
+    const bool matches = std::abs(tile.minLon - region.minLon) <= kBoundsTolerance &&
+                         std::abs(tile.maxLon - region.maxLon) <= kBoundsTolerance &&
+                         std::abs(tile.minLat - region.minLat) <= kBoundsTolerance &&
+                         std::abs(tile.maxLat - region.maxLat) <= kBoundsTolerance;
+    return matches ? std::optional{key} : std::nullopt;
+}
+
+} // namespace lod::geo
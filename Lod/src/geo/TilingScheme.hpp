@@ -0,0 +1,89 @@
+#pragma once
+
+#include "GeoBBox.hpp"
+#include <array>
+#include <compare>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+namespace lod::geo {
+
+// 全球瓦片方案类型
+enum class TilingSchemeType {
+    Geodetic,     // TMS 全球大地（EPSG:4326）：0 级为东西两块 180°×180° 瓦片，行号自南向北
+    WebMercator   // Web 墨卡托 z/x/y（EPSG:3857）：0 级为一块瓦片，行号自北向南，纬度限于 ±85.05°
+};
+
+// 瓦片键：层级 z、列号 x（自西向东）、行号 y（方向由方案决定）
+struct TileKey {
+    std::uint32_t z{0};
+    std::uint32_t x{0};
+    std::uint32_t y{0};
+    
+    constexpr auto operator<=>(const TileKey&) const = default;
+    
+    constexpr TileKey parent() const noexcept { return {z - 1, x >> 1, y >> 1}; }
+    
+    // 下一级的四个子瓦片，按 (y, x) 顺序
+    constexpr std::array<TileKey, 4> children() const noexcept {
+        return {{
+            {z + 1, 2 * x, 2 * y},
+            {z + 1, 2 * x + 1, 2 * y},
+            {z + 1, 2 * x, 2 * y + 1},
+            {z + 1, 2 * x + 1, 2 * y + 1}
+        }};
+    }
+};
+
+// 最深层级的定点瓦片坐标：任意层级 z 的键由右移 (kMaxLevel - z) 位得到，只需整数运算
+struct TileCoord {
+    std::uint32_t x{0};
+    std::uint32_t y{0};
+};
+
+// 与数据无关的全球瓦片方案：同一位置在任何数据集、任何运行中都落在相同的瓦片里
+class TilingScheme {
+public:
+    static constexpr std::uint32_t kMaxLevel = 30;
+    
+    constexpr explicit TilingScheme(TilingSchemeType type = TilingSchemeType::Geodetic) noexcept : type_(type) {}
+    
+    [[nodiscard]] constexpr TilingSchemeType type() const noexcept { return type_; }
+    
+    // 第 z 级的列数与行数
+    [[nodiscard]] constexpr std::uint32_t tilesX(std::uint32_t z) const noexcept {
+        return type_ == TilingSchemeType::Geodetic ? std::uint32_t{2} << z : std::uint32_t{1} << z;
+    }
+    [[nodiscard]] constexpr std::uint32_t tilesY(std::uint32_t z) const noexcept { return std::uint32_t{1} << z; }
+    
+    // 方案覆盖的经纬度范围
+    [[nodiscard]] GeoBBox extent() const noexcept;
+    
+    // 点所在的最深层级定点坐标（越界时夹取到方案范围内）
+    [[nodiscard]] TileCoord coordAt(double lon, double lat) const noexcept;
+    
+    [[nodiscard]] static constexpr TileKey keyAt(TileCoord coord, std::uint32_t z) noexcept {
+        return {z, coord.x >> (kMaxLevel - z), coord.y >> (kMaxLevel - z)};
+    }
+    [[nodiscard]] TileKey keyAt(double lon, double lat, std::uint32_t z) const noexcept {
+        return keyAt(coordAt(lon, lat), z);
+    }
+    
+    // 瓦片的经纬度范围（高度范围为 0）
+    [[nodiscard]] GeoBBox bounds(const TileKey& key) const noexcept;
+    
+    // 完整包含 bbox 的最深一级瓦片；跨越 0 级瓦片边界时返回 nullopt
+    [[nodiscard]] std::optional<TileKey> enclosingTile(const GeoBBox& bbox) const noexcept;
+    
+    // 第 z 级与 bbox 相交的全部瓦片，按 (y, x) 顺序
+    [[nodiscard]] std::vector<TileKey> tilesAt(const GeoBBox& bbox, std::uint32_t z) const;
+    
+    // 经纬度范围恰为方案中某个瓦片时返回其键（忽略高度范围）
+    [[nodiscard]] std::optional<TileKey> keyOf(const GeoBBox& region) const noexcept;
+
+private:
+    TilingSchemeType type_;
+};
+
+} // namespace lod::geo
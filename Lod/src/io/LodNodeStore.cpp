@@ -0,0 +1,161 @@
+#include "LodNodeStore.hpp"
+#include <algorithm>
+#include <fstream>
+#include <random>
+#include <type_traits>
+
+namespace lod::io {
+
+namespace {
+    constexpr std::array<char, 4> kMagic{'L', 'O', 'D', 'N'};
+    constexpr std::uint32_t kVersion = 1;
+    
+    template<typename T>
+    void writePod(std::ostream& out, const T& value) {
+        static_assert(std::is_trivially_copyable_v<T>);
+        out.write(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+    
+    template<typename T>
+    bool readPod(std::istream& in, T& value) {
+        static_assert(std::is_trivially_copyable_v<T>);
+        return static_cast<bool>(in.read(reinterpret_cast<char*>(&value), sizeof(T)));
+    }
+    
+    template<typename T>
+    void writeBuffer(std::ostream& out, const std::vector<T>& buffer) {
+        static_assert(std::is_trivially_copyable_v<T>);
+        writePod(out, static_cast<std::uint64_t>(buffer.size()));
+        out.write(reinterpret_cast<const char*>(buffer.data()), static_cast<std::streamsize>(buffer.size() * sizeof(T)));
+    }
+    
+    // 长度超出剩余文件大小的缓冲视为损坏，避免按错误长度分配内存
+    template<typename T>
+    bool readBuffer(std::istream& in, std::uintmax_t fileSize, std::vector<T>& buffer) {
+        static_assert(std::is_trivially_copyable_v<T>);
+        std::uint64_t size = 0;
+        if (!readPod(in, size) || size > fileSize / sizeof(T)) {
+            return false;
+        }
+        buffer.resize(size);
+        return static_cast<bool>(in.read(reinterpret_cast<char*>(buffer.data()),
+                                         static_cast<std::streamsize>(size * sizeof(T))));
+    }
+    
+    std::string toHex(std::uint64_t value) {
+        std::string digits(16, '0');
+        for (auto it = digits.rbegin(); it != digits.rend(); ++it, value >>= 4) {
+            *it = "0123456789abcdef"[value & 0xF];
+        }
+        return digits;
+    }
+    
+    // 可选属性流为空或与位置数一致
+    bool validMesh(const core::Mesh::Vertices& vertices, const core::Mesh::Indices& indices) {
+        const auto count = vertices.positions.size();
+        const auto optional = [count](size_t size) { return size == 0 || size == count; };
+        return optional(vertices.normals.size()) && optional(vertices.texCoords.size()) &&
+               optional(vertices.colors.size()) && optional(vertices.geoCoords.size()) && indices.size() % 3 == 0 &&
+               std::all_of(indices.begin(), indices.end(), [count](core::Index i) { return i < count; });
+    }
+} // namespace
+
+std::filesystem::path LodNodeStore::nodePath(core::OctreeKey key) const {
+    return directory_ / (toHex(key) + ".lnd");
+}
+
+std::shared_ptr<core::GeometricLodNode> LodNodeStore::load(core::OctreeKey key) const {
+    const auto path = nodePath(key);
+    std::error_code ec;
+    const auto fileSize = std::filesystem::file_size(path, ec);
+    std::ifstream in(path, std::ios::binary);
+    if (ec || !in) {
+        return nullptr;
+    }
+    
+    auto node = std::make_shared<core::GeometricLodNode>();
+    std::array<char, 4> magic{};
+    std::uint32_t version = 0;
+    std::int32_t lodLevel = 0;
+    std::vector<core::OctreeKey> childKeys;
+    core::Mesh::Vertices vertices;
+    core::Mesh::Indices indices;
+    const bool ok = in.read(magic.data(), magic.size()) && magic == kMagic &&
+                    readPod(in, version) && version == kVersion &&
+                    readPod(in, lodLevel) && readPod(in, node->geometricError) &&
+                    readPod(in, node->bounds.min) && readPod(in, node->bounds.max) &&
+                    readBuffer(in, fileSize, childKeys) &&
+                    readBuffer(in, fileSize, vertices.positions) && readBuffer(in, fileSize, vertices.normals) &&
+                    readBuffer(in, fileSize, vertices.texCoords) && readBuffer(in, fileSize, vertices.colors) &&
+                    readBuffer(in, fileSize, vertices.geoCoords) && readBuffer(in, fileSize, indices) &&
+                    validMesh(vertices, indices);
+    if (!ok) {
+        return nullptr;
+    }
+    node->lodLevel = lodLevel;
+    node->mesh = core::Mesh(std::move(vertices), std::move(indices));
+    
+    for (const auto childKey : childKeys) {
+        auto child = load(childKey);
+        if (!child) {
+            return nullptr;
+        }
+        node->children.push_back(std::move(child));
+    }
+    return node;
+}
+
+void LodNodeStore::store(core::OctreeKey key, const core::GeometricLodNode& node,
+                         std::span<const core::OctreeKey> childKeys) const {
+    const auto path = nodePath(key);
+    std::error_code ec;
+    std::filesystem::create_directories(directory_, ec);
+    std::filesystem::remove(path, ec);
+    
+    // 同目录下的唯一临时文件，写完后原子重命名
+    thread_local std::mt19937_64 random{std::random_device{}()};
+    auto temporary = path;
+    temporary += "." + toHex(random()) + ".tmp";
+    {
+        std::ofstream out(temporary, std::ios::binary);
+        if (!out) {
+            return;
+        }
+        const auto& vertices = node.mesh.vertices();
+        out.write(kMagic.data(), kMagic.size());
+        writePod(out, kVersion);
+        writePod(out, static_cast<std::int32_t>(node.lodLevel));
+        writePod(out, node.geometricError);
+        writePod(out, node.bounds.min);
+        writePod(out, node.bounds.max);
+        writeBuffer(out, std::vector<core::OctreeKey>(childKeys.begin(), childKeys.end()));
+        writeBuffer(out, vertices.positions);
+        writeBuffer(out, vertices.normals);
+        writeBuffer(out, vertices.texCoords);
+        writeBuffer(out, vertices.colors);
+        writeBuffer(out, vertices.geoCoords);
+        writeBuffer(out, node.mesh.indices());
+        if (!out.flush()) {
+            out.close();
+            std::filesystem::remove(temporary, ec);
+            return;
+        }
+    }
+    
+    std::filesystem::rename(temporary, path, ec);
+    if (ec) {
+        std::filesystem::remove(temporary, ec);
+    }
+}
+
+void LodNodeStore::erase(core::OctreeKey key) const {
+    std::error_code ec;
+    std::filesystem::remove(nodePath(key), ec);
+}
+
+void LodNodeStore::clear() const {
+    std::error_code ec;
+    std::filesystem::remove_all(directory_, ec);
+}
+
+} // namespace lod::io
@@ -0,0 +1,35 @@
+#pragma once
+
+#include "../core/LodAlgorithm.hpp"
+#include <filesystem>
+
+namespace lod::io {
+
+// 自底向上增量构建的节点结果目录：每个重新构建的节点一个文件 <directory>/<键>.lnd，
+// 保存添加裙边之前的网格、误差与子节点键。结果只在 LOD 参数不变时可沿用，修改参数后应删除目录或重建索引。
+// 写入前先删除旧文件，再写临时文件并原子重命名：任何失败都表现为文件缺失，对应子树下次重新构建
+class LodNodeStore : public core::ILodNodeStore {
+public:
+    explicit LodNodeStore(std::filesystem::path directory) : directory_(std::move(directory)) {}
+    
+    // 递归取回子树；任一节点缺失、损坏或版本不符时返回空指针
+    std::shared_ptr<core::GeometricLodNode> load(core::OctreeKey key) const override;
+    
+    // 写入失败不影响本次构建，只是下次不能沿用该节点
+    void store(core::OctreeKey key, const core::GeometricLodNode& node,
+               std::span<const core::OctreeKey> childKeys) const override;
+    
+    void erase(core::OctreeKey key) const override;
+    
+    // 删除全部节点结果（索引重建时调用）
+    void clear() const;
+    
+    [[nodiscard]] const std::filesystem::path& directory() const noexcept { return directory_; }
+
+private:
+    [[nodiscard]] std::filesystem::path nodePath(core::OctreeKey key) const;
+    
+    std::filesystem::path directory_;
+};
+
+} // namespace lod::io
@@ -0,0 +1,211 @@
+#include "OctreeIndexIO.hpp"
+#include <algorithm>
+#include <array>
+#include <fstream>
+#include <type_traits>
+
+namespace lod::io {
+
+namespace {
+    constexpr std::array<char, 4> kMagic{'L', 'O', 'D', 'X'};
+    constexpr std::uint32_t kVersion = 1;
+
+    template<typename T>
+    void writePod(std::ostream& out, const T& value) {
+        static_assert(std::is_trivially_copyable_v<T>);
+        out.write(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+
+    template<typename T>
+    bool readPod(std::istream& in, T& value) {
+        static_assert(std::is_trivially_copyable_v<T>);
+        return static_cast<bool>(in.read(reinterpret_cast<char*>(&value), sizeof(T)));
+    }
+
+    void writeBounds(std::ostream& out, const core::BoundingBox& bounds) {
+        writePod(out, bounds.min);
+        writePod(out, bounds.max);
+    }
+
+    bool readBounds(std::istream& in, core::BoundingBox& bounds) {
+        return readPod(in, bounds.min) && readPod(in, bounds.max);
+    }
+
+    void writeString(std::ostream& out, const std::string& value) {
+        writePod(out, static_cast<std::uint32_t>(value.size()));
+        out.write(value.data(), static_cast<std::streamsize>(value.size()));
+    }
+
+    bool readString(std::istream& in, std::string& value) {
+        std::uint32_t size = 0;
+        if (!readPod(in, size)) {
+            return false;
+        }
+        value.resize(size);
+        return static_cast<bool>(in.read(value.data(), size));
+    }
+} // namespace
+
+std::expected<OctreeSourceRecord, OctreeIndexError>
+makeOctreeSourceRecord(const std::filesystem::path& filePath) {
+    std::error_code ec;
+    const auto size = std::filesystem::file_size(filePath, ec);
+    if (ec) {
+        return std::unexpected(OctreeIndexError::FileNotFound);
+    }
+    const auto time = std::filesystem::last_write_time(filePath, ec);
+    if (ec) {
+        return std::unexpected(OctreeIndexError::ReadError);
+    }
+
+    return OctreeSourceRecord{
+        filePath,
+        static_cast<std::uint64_t>(size),
+        static_cast<std::int64_t>(time.time_since_epoch().count())
+    };
+}
+
+std::expected<void, OctreeIndexError>
+saveOctreeIndex(const PersistedOctreeIndex& persisted, const std::filesystem::path& outputPath) {
+    std::ofstream out(outputPath, std::ios::binary);
+    if (!out) {
+        return std::unexpected(OctreeIndexError::WriteError);
+    }
+
+    out.write(kMagic.data(), kMagic.size());
+    writePod(out, kVersion);
+
+    // 影响增量插入行为的配置
+    const auto& config = persisted.index.config();
+    writePod(out, static_cast<std::uint64_t>(config.maxTrianglesPerNode));
+    writePod(out, static_cast<std::int32_t>(config.maxDepth));
+    writePod(out, static_cast<std::uint8_t>(config.looseOctree));
+    writePod(out, config.looseness);
+
+    writePod(out, static_cast<std::uint32_t>(persisted.sources.size()));
+    for (const auto& source : persisted.sources) {
+        writeString(out, source.path.generic_string());
+        writePod(out, source.fileSize);
+        writePod(out, source.lastWriteTime);
+    }
+
+    const auto& nodes = persisted.index.nodes();
+    writePod(out, static_cast<std::uint64_t>(nodes.size()));
+    for (const auto& [key, node] : nodes) {
+        writePod(out, key);
+        writeBounds(out, node.bounds);
+        writeBounds(out, node.tightBounds);
+        writePod(out, static_cast<std::uint8_t>(node.dirty));
+        writePod(out, static_cast<std::uint32_t>(node.sources.size()));
+        for (const auto& source : node.sources) {
+            writePod(out, source.sourceId);
+            writePod(out, static_cast<std::uint32_t>(source.ranges.size()));
+            out.write(reinterpret_cast<const char*>(source.ranges.data()),
+                      static_cast<std::streamsize>(source.ranges.size() * sizeof(core::TriangleRange)));
+        }
+    }
+
+    if (!out) {
+        return std::unexpected(OctreeIndexError::WriteError);
+    }
+    return {};
+}
+
+std::expected<PersistedOctreeIndex, OctreeIndexError>
+loadOctreeIndex(const std::filesystem::path& inputPath) {
+    if (!std::filesystem::exists(inputPath)) {
+        return std::unexpected(OctreeIndexError::FileNotFound);
+    }
+
+    std::ifstream in(inputPath, std::ios::binary);
+    if (!in) {
+        return std::unexpected(OctreeIndexError::ReadError);
+    }
+
+    std::array<char, 4> magic{};
+    std::uint32_t version = 0;
+    if (!in.read(magic.data(), magic.size()) || magic != kMagic || !readPod(in, version) || version != kVersion) {
+        return std::unexpected(OctreeIndexError::InvalidFormat);
+    }
+
+    core::OctreeConfig config;
+    std::uint64_t maxTriangles = 0;
+    std::int32_t maxDepth = 0;
+    std::uint8_t loose = 0;
+    if (!readPod(in, maxTriangles) || !readPod(in, maxDepth) || !readPod(in, loose) || !readPod(in, config.looseness)) {
+        return std::unexpected(OctreeIndexError::ReadError);
+    }
+    config.maxTrianglesPerNode = static_cast<size_t>(maxTriangles);
+    config.maxDepth = maxDepth;
+    config.looseOctree = loose != 0;
+
+    PersistedOctreeIndex persisted;
+
+    std::uint32_t sourceCount = 0;
+    if (!readPod(in, sourceCount)) {
+        return std::unexpected(OctreeIndexError::ReadError);
+    }
+    persisted.sources.resize(sourceCount);
+    for (auto& source : persisted.sources) {
+        std::string path;
+        if (!readString(in, path) || !readPod(in, source.fileSize) || !readPod(in, source.lastWriteTime)) {
+            return std::unexpected(OctreeIndexError::ReadError);
+        }
+        source.path = path;
+    }
+
+    std::uint64_t nodeCount = 0;
+    if (!readPod(in, nodeCount)) {
+        return std::unexpected(OctreeIndexError::ReadError);
+    }
+
+    std::vector<core::OctreeIndexNode> nodes(static_cast<size_t>(nodeCount));
+    for (auto& node : nodes) {
+        std::uint8_t dirty = 0;
+        std::uint32_t nodeSourceCount = 0;
+        if (!readPod(in, node.key) || !readBounds(in, node.bounds) || !readBounds(in, node.tightBounds) ||
+            !readPod(in, dirty) || !readPod(in, nodeSourceCount)) {
+            return std::unexpected(OctreeIndexError::ReadError);
+        }
+        node.dirty = dirty != 0;
+
+        node.sources.resize(nodeSourceCount);
+        for (auto& source : node.sources) {
+            std::uint32_t rangeCount = 0;
+            if (!readPod(in, source.sourceId) || !readPod(in, rangeCount)) {
+                return std::unexpected(OctreeIndexError::ReadError);
+            }
+            source.ranges.resize(rangeCount);
+            if (!in.read(reinterpret_cast<char*>(source.ranges.data()),
+                         static_cast<std::streamsize>(rangeCount * sizeof(core::TriangleRange)))) {
+                return std::unexpected(OctreeIndexError::ReadError);
+            }
+        }
+    }
+
+    persisted.index = core::OctreeIndex::fromNodes(config, std::move(nodes));
+    return persisted;
+}
+
+std::vector<core::SourceId>
+findChangedSources(const std::vector<OctreeSourceRecord>& recorded,
+                   const std::vector<std::filesystem::path>& currentFiles) {
+    std::vector<core::SourceId> changed;
+    const auto count = std::max(recorded.size(), currentFiles.size());
+
+    for (size_t i = 0; i < count; ++i) {
+        if (i >= recorded.size() || i >= currentFiles.size()) {
+            changed.push_back(static_cast<core::SourceId>(i));
+            continue;
+        }
+
+        auto current = makeOctreeSourceRecord(currentFiles[i]);
+        if (!current || *current != recorded[i]) {
+            changed.push_back(static_cast<core::SourceId>(i));
+        }
+    }
+
+    return changed;
+}
+
+} // namespace lod::io
@@ -0,0 +1,50 @@
+#pragma once
+
+#include "../core/OctreeIndex.hpp"
+#include <cstdint>
+#include <expected>
+#include <filesystem>
+#include <vector>
+
+namespace lod::io {
+
+// 八叉树索引读写错误类型
+enum class OctreeIndexError {
+    FileNotFound,
+    InvalidFormat,
+    ReadError,
+    WriteError
+};
+
+// 源文件记录：编号即在列表中的下标，大小与修改时间用于检测变更
+struct OctreeSourceRecord {
+    std::filesystem::path path;
+    std::uint64_t fileSize{0};
+    std::int64_t lastWriteTime{0};
+
+    bool operator==(const OctreeSourceRecord&) const = default;
+};
+
+// 持久化内容：索引本身 + 构建时的源文件快照
+struct PersistedOctreeIndex {
+    core::OctreeIndex index;
+    std::vector<OctreeSourceRecord> sources;
+};
+
+// 读取源文件当前的大小与修改时间
+[[nodiscard]] std::expected<OctreeSourceRecord, OctreeIndexError>
+makeOctreeSourceRecord(const std::filesystem::path& filePath);
+
+// 二进制保存/加载（节点键、包围盒、每个源文件的三角形区间）
+[[nodiscard]] std::expected<void, OctreeIndexError>
+saveOctreeIndex(const PersistedOctreeIndex& persisted, const std::filesystem::path& outputPath);
+
+[[nodiscard]] std::expected<PersistedOctreeIndex, OctreeIndexError>
+loadOctreeIndex(const std::filesystem::path& inputPath);
+
+// 与当前文件列表比较，返回需要替换（变更、缺失或新增）的源文件编号
+[[nodiscard]] std::vector<core::SourceId>
+findChangedSources(const std::vector<OctreeSourceRecord>& recorded,
+                   const std::vector<std::filesystem::path>& currentFiles);
+
+} // namespace lod::io
@@ -10,10 +10,15 @@ namespace lod::io {
 
 // StandardOsgExporter 实现
 std::expected<void, OsgError> StandardOsgExporter::exportNode(const core::LodNode& node, const std::filesystem::path& outputPath) const {
+    return exportSubtree(core::flattenLodTree(node), 0, outputPath);
+}
+
+std::expected<void, OsgError> StandardOsgExporter::exportSubtree(const core::LodTable& table, core::LodNodeIndex index,
+                                                                 const std::filesystem::path& outputPath) const {
     try {
-        auto osgNode = std::visit([this](const auto& lodNode) -> osg::ref_ptr<osg::Node> {
-            return createLodNode(lodNode);
-        }, node);
+        auto osgNode = std::visit([&](const auto& nodes) -> osg::ref_ptr<osg::Node> {
+            return createLodNode(nodes, index);
+        }, table);
         
         if (config_.optimizeGeometry) {
             optimizeNode(osgNode);
@@ -35,29 +40,30 @@ std::expected<void, OsgError> StandardOsgExporter::exportHierarchy(const core::L
         std::filesystem::create_directories(outputDir);
     }
     
-    // 递归导出每个节点
-    auto exportRecursive = [&](const auto& node, const std::filesystem::path& basePath, int level) -> std::expected<void, OsgError> {
-        auto nodePath = basePath / (std::string("level_") + std::to_string(level) + ".osgb");
-        auto result = exportNode(node, nodePath);
-        if (!result) {
-            return result;
+    const auto table = core::flattenLodTree(root);
+    
+    // 按 BFS 顺序导出每个节点；子节点目录嵌套在父节点层级目录下
+    return std::visit([&](const auto& nodes) -> std::expected<void, OsgError> {
+        std::vector<std::filesystem::path> basePaths(nodes.size());
+        if (!nodes.empty()) {
+            basePaths[0] = outputDir;
         }
         
-        // 导出子节点
-        return std::visit([&](const auto& lodNode) -> std::expected<void, OsgError> {
-            for (const auto& child : lodNode.children) {
-                if (child) {
-                    auto childResult = exportRecursive(*child, basePath / ("level_" + std::to_string(level)), level + 1);
-                    if (!childResult) {
-                        return childResult;
-                    }
-                }
+        for (const auto node : nodes) {
+            const auto& basePath = basePaths[node.index()];
+            auto nodePath = basePath / (std::string("level_") + std::to_string(node.level()) + ".osgb");
+            auto result = exportSubtree(table, node.index(), nodePath);
+            if (!result) {
+                return result;
             }
-            return {};
-        }, node);
-    };
-    
-    return exportRecursive(root, outputDir, 0);
+            
+            for (const auto child : node.children()) {
+                basePaths[child] = basePath / ("level_" + std::to_string(node.level()));
+            }
+        }
+        
+        return {};
+    }, table);
 }
 
 std::expected<void, OsgError> StandardOsgExporter::exportSingleFile(const core::LodNode& root, const std::filesystem::path& outputFile) const {
@@ -122,33 +128,29 @@ osg::ref_ptr<osg::Geometry> StandardOsgExporter::meshToGeometry(const core::Mesh
     return geometry;
 }
 
-osg::ref_ptr<osg::LOD> StandardOsgExporter::createLodNode(const core::LodNode& lodNode) const {
-    auto lodGroup = new osg::LOD;
+template<typename Table>
+osg::ref_ptr<osg::LOD> StandardOsgExporter::createLodNode(const Table& table, core::LodNodeIndex index) const {
+    osg::ref_ptr<osg::LOD> lodGroup = new osg::LOD;
     
-    return std::visit([&](const auto& node) -> osg::ref_ptr<osg::LOD> {
-        // 创建当前级别的几何体
-        if (!node.mesh.empty()) {
-            auto geometry = meshToGeometry(node.mesh);
-            auto geode = new osg::Geode;
-            geode->addDrawable(geometry);
-            
-            // 设置 LOD 距离
-            float minRange = static_cast<float>(node.geometricError);
-            float maxRange = minRange * 2.0f;
-            
-            lodGroup->addChild(geode, minRange, maxRange);
-        }
+    // 创建当前级别的几何体
+    if (table.hasMesh(index) && !table.mesh(index).empty()) {
+        auto geometry = meshToGeometry(table.mesh(index));
+        auto geode = new osg::Geode;
+        geode->addDrawable(geometry);
         
-        // 添加子节点
-        for (const auto& child : node.children) {
-            if (child) {
-                auto childLod = createLodNode(*child);
-                lodGroup->addChild(childLod);
-            }
-        }
+        // 设置 LOD 距离
+        float minRange = static_cast<float>(table.geometricError(index));
+        float maxRange = minRange * 2.0f;
         
-        return lodGroup;
-    }, lodNode);
+        lodGroup->addChild(geode, minRange, maxRange);
+    }
+    
+    // 添加子节点（表中连续存放）
+    for (const auto child : table.children(index)) {
+        lodGroup->addChild(createLodNode(table, child));
+    }
+    
+    return lodGroup;
 }
 
 void StandardOsgExporter::optimizeNode(osg::Node* node) const {
@@ -180,28 +182,28 @@ std::expected<void, OsgError> HierarchicalOsgExporter::exportNode(const core::Lo
 }
 
 std::expected<void, OsgError> HierarchicalOsgExporter::exportHierarchy(const core::LodNode& root, const std::filesystem::path& outputDir) const {
-    createDirectoryStructure(outputDir, root);
-    
-    // 收集所有层级的节点
-    std::map<int, std::vector<std::reference_wrapper<const core::LodNode>>> levelNodes;
+    const auto table = core::flattenLodTree(root);
     
-    std::function<void(const core::LodNode&)> collectNodes = [&](const core::LodNode& node) {
-        std::visit([&](const auto& lodNode) {
-            levelNodes[lodNode.lodLevel].emplace_back(node);
-            
-            for (const auto& child : lodNode.children) {
-                if (child) {
-                    collectNodes(*child);
-                }
+    // 按层级收集节点（一次线性扫描层级列）
+    std::vector<std::vector<core::LodNodeIndex>> levelNodes;
+    std::visit([&](const auto& nodes) {
+        const auto levels = nodes.levelColumn();
+        for (core::LodNodeIndex i = 0; i < levels.size(); ++i) {
+            if (static_cast<int>(levelNodes.size()) <= levels[i]) {
+                levelNodes.resize(static_cast<size_t>(levels[i]) + 1);
             }
-        }, node);
-    };
+            levelNodes[levels[i]].push_back(i);
+        }
+    }, table);
     
-    collectNodes(root);
+    createDirectoryStructure(outputDir, static_cast<int>(levelNodes.size()) - 1);
     
     // 分层级导出
-    for (const auto& [level, nodes] : levelNodes) {
-        auto result = exportLevel(nodes, level, outputDir);
+    for (size_t level = 0; level < levelNodes.size(); ++level) {
+        if (levelNodes[level].empty()) {
+            continue;
+        }
+        auto result = exportLevel(table, levelNodes[level], static_cast<int>(level), outputDir);
         if (!result) {
             return result;
         }
@@ -214,40 +216,26 @@ std::expected<void, OsgError> HierarchicalOsgExporter::exportSingleFile(const co
     return standardExporter_.exportSingleFile(root, outputFile);
 }
 
-void HierarchicalOsgExporter::createDirectoryStructure(const std::filesystem::path& baseDir, const core::LodNode& root) const {
+void HierarchicalOsgExporter::createDirectoryStructure(const std::filesystem::path& baseDir, int maxLevel) const {
     std::filesystem::create_directories(baseDir);
     
-    std::visit([&](const auto& node) {
-        int maxLevel = node.lodLevel;
-        
-        std::function<void(const auto&)> findMaxLevel = [&](const auto& lodNode) {
-            maxLevel = std::max(maxLevel, lodNode.lodLevel);
-            for (const auto& child : lodNode.children) {
-                if (child) {
-                    findMaxLevel(*child);
-                }
-            }
-        };
-        
-        findMaxLevel(node);
-        
-        // 为每个级别创建目录
-        for (int i = 0; i <= maxLevel; ++i) {
-            std::filesystem::create_directories(baseDir / ("level_" + std::to_string(i)));
-        }
-    }, root);
+    // 为每个级别创建目录
+    for (int i = 0; i <= maxLevel; ++i) {
+        std::filesystem::create_directories(baseDir / ("level_" + std::to_string(i)));
+    }
 }
 
-std::expected<void, OsgError> HierarchicalOsgExporter::exportLevel(const std::vector<std::reference_wrapper<const core::LodNode>>& nodes,
+std::expected<void, OsgError> HierarchicalOsgExporter::exportLevel(const core::LodTable& table,
+                                                                  const std::vector<core::LodNodeIndex>& nodes,
                                                                   int level, const std::filesystem::path& outputDir) const {
     auto levelDir = outputDir / ("level_" + std::to_string(level));
     
     int nodeIndex = 0;
-    for (const auto& nodeRef : nodes) {
+    for (const auto node : nodes) {
         auto fileName = "node_" + std::to_string(nodeIndex++) + ".osgb";
         auto filePath = levelDir / fileName;
         
-        auto result = standardExporter_.exportNode(nodeRef.get(), filePath);
+        auto result = standardExporter_.exportSubtree(table, node, filePath);
         if (!result) {
             return result;
         }
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "../core/LodAlgorithm.hpp"
+#include "../core/LodTable.hpp"
 #include <string>
 #include <filesystem>
 #include <expected>
@@ -57,6 +58,11 @@ public:
     
     std::expected<void, OsgError>
     exportSingleFile(const core::LodNode& root, const std::filesystem::path& outputFile) const override;
+    
+    // 导出节点表中以 index 为根的子树
+    std::expected<void, OsgError>
+    exportSubtree(const core::LodTable& table, core::LodNodeIndex index,
+                  const std::filesystem::path& outputPath) const;
 
 private:
     OsgExportConfig config_;
@@ -64,8 +70,9 @@ private:
     // 转换网格到 OSG 几何体
     osg::ref_ptr<osg::Geometry> meshToGeometry(const core::Mesh& mesh) const;
     
-    // 创建 LOD 节点
-    osg::ref_ptr<osg::LOD> createLodNode(const core::LodNode& lodNode) const;
+    // 创建 LOD 节点（子树）
+    template<typename Table>
+    osg::ref_ptr<osg::LOD> createLodNode(const Table& table, core::LodNodeIndex index) const;
     
     // 应用优化
     void optimizeNode(osg::Node* node) const;
@@ -94,11 +101,11 @@ private:
     StandardOsgExporter standardExporter_;
     
     // 创建目录结构
-    void createDirectoryStructure(const std::filesystem::path& baseDir, const core::LodNode& root) const;
+    void createDirectoryStructure(const std::filesystem::path& baseDir, int maxLevel) const;
     
     // 导出级别
     std::expected<void, OsgError>
-    exportLevel(const std::vector<std::reference_wrapper<const core::LodNode>>& nodes,
+    exportLevel(const core::LodTable& table, const std::vector<core::LodNodeIndex>& nodes,
                 int level, const std::filesystem::path& outputDir) const;
 };
 
@@ -1,13 +1,145 @@
 #include "PlyReader.hpp"
+#include "../core/LodAlgorithm.hpp"
 #include <fstream>
 #include <sstream>
 #include <string>
 #include <algorithm>
+#include <atomic>
 #include <execution>
 #include <cctype>
+#include <tbb/parallel_for.h>
 
 namespace lod::io {
 
+namespace {
+    // 一个文件的双精度地心坐标（SoA）与其局部坐标系
+    struct GeoreferencedFile {
+        std::vector<double> x;
+        std::vector<double> y;
+        std::vector<double> z;
+        geo::LocalFrame frame;
+    };
+    
+    // 把文件的局部顶点换算为双精度地心坐标：
+    // 地理 CRS 下原点为经纬度，顶点为以原点为中心的东-北-天局部米制偏移；
+    // 投影 CRS 下原点为投影坐标，顶点偏移与原点相加后整体交给 PROJ 批量转换。
+    // 高程为正高时，在同一遍顶点循环中按大地水准面格网改正为椭球高
+    std::expected<GeoreferencedFile, PlyError>
+    georeference(const core::VertexAttributes& vertices, const PlyFileInfo& fileInfo) {
+        const auto& positions = vertices.positions;
+        const auto& origin = fileInfo.origin;
+        const geo::CRS crs{fileInfo.crsCode.value_or(geo::crs::WGS84().code())};
+        if (!crs.isValid()) {
+            return std::unexpected(PlyError::TransformError);
+        }
+        
+        geo::HeightDatum heights;
+        if (fileInfo.geoidGrid) {
+            auto grid = geo::GeoidGrid::open(*fileInfo.geoidGrid);
+            if (!grid) {
+                return std::unexpected(grid.error() == geo::GeoidError::FileNotFound ? PlyError::FileNotFound
+                                                                                    : PlyError::InvalidFormat);
+            }
+            heights = std::move(*grid);
+        }
+        
+        GeoreferencedFile file;
+        file.x.resize(positions.size());
+        file.y.resize(positions.size());
+        file.z.resize(positions.size());
+        
+        if (crs.isGeographic()) {
+            file.frame = geo::LocalFrame::enuAt(origin);
+            std::atomic<bool> outsideGrid{false};
+            tbb::parallel_for(size_t{0}, positions.size(), [&](size_t v) {
+                const auto& p = positions[v];
+                auto ecef = file.frame.toEcef({p[0], p[1], p[2]});
+                if (heights) {
+                    auto point = geo::ecefToGeodetic(ecef);
+                    const auto undulation = heights->undulation(point.longitude, point.latitude);
+                    if (!undulation) {
+                        outsideGrid = true;
+                        return;
+                    }
+                    point.altitude += *undulation;
+                    ecef = geo::geodeticToEcef(point);
+                }
+                file.x[v] = ecef[0];
+                file.y[v] = ecef[1];
+                file.z[v] = ecef[2];
+            });
+            if (outsideGrid) {
+                return std::unexpected(PlyError::TransformError);
+            }
+            return file;
+        }
+        
+        // 文件坐标系取原点处的 ENU（忽略投影的子午线收敛角），仅用于旋转法线
+        const auto geographicOrigin = geo::CoordinateTransformer{crs, geo::crs::WGS84()}.transform(origin);
+        if (!geographicOrigin) {
+            return std::unexpected(PlyError::TransformError);
+        }
+        file.frame = geo::LocalFrame::enuAt(*geographicOrigin);
+        
+        tbb::parallel_for(size_t{0}, positions.size(), [&](size_t v) {
+            file.x[v] = origin.longitude + positions[v][0];
+            file.y[v] = origin.latitude + positions[v][1];
+            file.z[v] = origin.altitude + positions[v][2];
+        });
+        if (!geo::CoordinateTransformer{crs, geo::crs::ECEF(), heights}.transformInPlace(file.x, file.y, file.z)) {
+            return std::unexpected(PlyError::TransformError);
+        }
+        return file;
+    }
+    
+    // 由地心坐标计算大地坐标缓存
+    std::vector<core::GeoCoord> computeGeoCoords(const GeoreferencedFile& file) {
+        std::vector<double> lon(file.x.size());
+        std::vector<double> lat(file.x.size());
+        std::vector<double> height(file.x.size());
+        geo::ecefToGeodetic(file.x, file.y, file.z, lon, lat, height);
+        
+        std::vector<core::GeoCoord> geoCoords(lon.size());
+        for (size_t v = 0; v < lon.size(); ++v) {
+            geoCoords[v] = {lon[v], lat[v], height[v]};
+        }
+        return geoCoords;
+    }
+    
+    // 由缓存的大地坐标恢复双精度地心坐标（原地批量转换），只在放入数据集坐标系时临时持有
+    void restoreEcef(GeoreferencedFile& file, std::span<const core::GeoCoord> geoCoords) {
+        file.x.resize(geoCoords.size());
+        file.y.resize(geoCoords.size());
+        file.z.resize(geoCoords.size());
+        for (size_t v = 0; v < geoCoords.size(); ++v) {
+            file.x[v] = geoCoords[v][0];
+            file.y[v] = geoCoords[v][1];
+            file.z[v] = geoCoords[v][2];
+        }
+        geo::geodeticToEcef(file.x, file.y, file.z, file.x, file.y, file.z);
+    }
+    
+    // 把文件顶点放入数据集的公共 ENU 坐标系：位置一次性由双精度地心坐标降为 float 偏移，法线随之旋转
+    void toDatasetFrame(core::VertexAttributes& vertices, const GeoreferencedFile& file, const geo::LocalFrame& frame) {
+        constexpr size_t kBlockSize = size_t{1} << 14;
+        const size_t count = vertices.positions.size();
+        tbb::parallel_for(size_t{0}, (count + kBlockSize - 1) / kBlockSize, [&](size_t block) {
+            const size_t begin = block * kBlockSize;
+            const size_t n = std::min(kBlockSize, count - begin);
+            frame.toLocal(std::span(file.x).subspan(begin, n), std::span(file.y).subspan(begin, n),
+                          std::span(file.z).subspan(begin, n), std::span(vertices.positions).subspan(begin, n));
+        });
+        
+        if (vertices.normals.size() == count) {
+            tbb::parallel_for(size_t{0}, count, [&](size_t v) {
+                auto& normal = vertices.normals[v];
+                const auto rotated = frame.directionToLocal(file.frame.directionToEcef({normal[0], normal[1], normal[2]}));
+                normal = {static_cast<float>(rotated[0]), static_cast<float>(rotated[1]), static_cast<float>(rotated[2])};
+            });
+        }
+    }
+} // namespace
+
 // StandardPlyReader 实现
 std::expected<core::Mesh, PlyError> StandardPlyReader::readPly(const std::filesystem::path& filePath) const {
     std::ifstream file(filePath, std::ios::binary);
@@ -246,8 +378,15 @@ std::expected<std::vector<core::Mesh>, PlyError> GeoPlyReader::readMultiple(cons
 
 std::expected<std::pair<core::Mesh, geo::GeoBBox>, PlyError> GeoPlyReader::readAllWithGeoBounds() const {
     std::vector<core::Mesh> meshes;
-    geo::GeoBBox totalBounds;
-    bool firstBounds = true;
+    std::vector<geo::LocalFrame> fileFrames;
+    std::optional<geo::GeoBBox> totalBounds;
+    
+    // 先并行解析全部文件用到的 CRS，逐文件处理时只做注册表查找
+    std::vector<std::string> crsCodes;
+    for (const auto& fileInfo : fileInfos_) {
+        crsCodes.push_back(fileInfo.crsCode.value_or(geo::crs::WGS84().code()));
+    }
+    geo::CRSRegistry::instance().preload(crsCodes);
     
     for (const auto& fileInfo : fileInfos_) {
         auto meshResult = standardReader_.readPly(fileInfo.filePath);
@@ -255,28 +394,44 @@ std::expected<std::pair<core::Mesh, geo::GeoBBox>, PlyError> GeoPlyReader::readA
             return std::unexpected(meshResult.error());
         }
         
-        meshes.push_back(std::move(meshResult.value()));
+        auto file = georeference(meshResult->vertices(), fileInfo);
+        if (!file) {
+            return std::unexpected(file.error());
+        }
         
-        // 更新总边界框（简化实现）
-        // 这里应该根据文件的地理信息计算边界框
-        geo::GeoBBox fileBounds{
-            fileInfo.origin.longitude - 0.001,
-            fileInfo.origin.latitude - 0.001,
-            fileInfo.origin.longitude + 0.001,
-            fileInfo.origin.latitude + 0.001
-        };
+        // 每个文件只换算一次，后续切分与简化直接复用缓存的大地坐标；
+        // 文件范围由全部顶点并行归约得到（非线性 CRS 下角点变换不能保证包住整个文件）
+        auto vertices = meshResult->vertices();
+        vertices.geoCoords = computeGeoCoords(*file);
+        meshes.push_back(meshResult->withVertices(std::move(vertices)));
         
-        if (firstBounds) {
-            totalBounds = fileBounds;
-            firstBounds = false;
-        } else {
-            totalBounds = totalBounds.unite(fileBounds);
+        const auto fileBounds = core::computeGeoBounds(meshes.back());
+        if (fileBounds) {
+            totalBounds = totalBounds ? totalBounds->unite(*fileBounds) : *fileBounds;
         }
+        
+        // 双精度地心坐标（每顶点 24 字节）不跨文件保留，只留下文件坐标系用于旋转法线
+        fileFrames.push_back(file->frame);
+    }
+    
+    if (!totalBounds) {
+        return std::unexpected(PlyError::EmptyMesh);
+    }
+    
+    // 所有文件统一到以总区域中心为原点的 ENU 坐标系（由区域唯一确定，导出时据此恢复地心坐标）；
+    // 逐文件由大地坐标恢复地心坐标、转换后立即释放，峰值只多出一个文件的双精度坐标
+    const auto frame = geo::LocalFrame::enuAt(*totalBounds);
+    for (size_t i = 0; i < meshes.size(); ++i) {
+        auto vertices = meshes[i].vertices();
+        GeoreferencedFile file{.frame = fileFrames[i]};
+        restoreEcef(file, vertices.geoCoords);
+        toDatasetFrame(vertices, file, frame);
+        meshes[i] = meshes[i].withVertices(std::move(vertices));
     }
     
     // 合并所有网格
     auto mergedMesh = core::Mesh::merge(meshes);
-    return std::make_pair(std::move(mergedMesh), totalBounds);
+    return std::make_pair(std::move(mergedMesh), *totalBounds);
 }
 
 std::optional<PlyFileInfo> GeoPlyReader::findFileInfo(const std::filesystem::path& path) const {
@@ -455,13 +610,15 @@ std::expected<std::vector<PlyFileInfo>, PlyError> loadPlyFileList(const std::fil
         std::string filePath;
         double lon, lat, alt = 0.0;
         std::string crs = "EPSG:4326";
+        std::string geoidGrid;
         
-        iss >> filePath >> lon >> lat >> alt >> crs;
+        iss >> filePath >> lon >> lat >> alt >> crs >> geoidGrid;
         
         fileInfos.push_back({
             std::filesystem::path(filePath),
             geo::GeoPoint{lon, lat, alt},
-            crs
+            crs,
+            geoidGrid.empty() ? std::nullopt : std::optional<std::filesystem::path>(geoidGrid)
         });
     }
     
@@ -3,6 +3,8 @@
 #include "../core/Mesh.hpp"
 #include "../core/Geometry.hpp"
 #include "../geo/GeoBBox.hpp"
+#include "../geo/CRS.hpp"
+#include "../geo/LocalFrame.hpp"
 #include <string>
 #include <vector>
 #include <expected>
@@ -17,7 +19,8 @@ enum class PlyError {
     InvalidFormat,
     UnsupportedFormat,
     ReadError,
-    EmptyMesh
+    EmptyMesh,
+    TransformError
 };
 
 // PLY 文件元数据
@@ -81,6 +84,7 @@ struct PlyFileInfo {
     std::filesystem::path filePath;
     geo::GeoPoint origin;  // 文件的地理原点
     std::optional<std::string> crsCode;  // 坐标系代码，如 "EPSG:4326"
+    std::optional<std::filesystem::path> geoidGrid;  // 高程为相对该大地水准面格网（GTX）的正高；为空时为椭球高
 };
 
 // 简单 PLY 文件信息（纯几何）
@@ -112,7 +116,9 @@ public:
     std::expected<std::vector<core::Mesh>, PlyError>
     readMultiple(const std::vector<std::filesystem::path>& filePaths) const override;
     
-    // 读取所有文件并合并到统一坐标系
+    // 读取所有文件并合并；每个文件的顶点按其原点与 CRS 在双精度下一次性换算为地心坐标，
+    // 经纬度缓存在 geoCoords 属性流中，总边界框由这些经纬度计算；
+    // 位置统一为 geo::LocalFrame::enuAt(总边界框) 下的 float 偏移
     std::expected<std::pair<core::Mesh, geo::GeoBBox>, PlyError>
     readAllWithGeoBounds() const;
 
@@ -0,0 +1,281 @@
+#include "SimplifyCache.hpp"
+#include <meshoptimizer.h>
+#include <xxhash.h>
+#include <algorithm>
+#include <fstream>
+#include <random>
+#include <type_traits>
+
+namespace lod::io {
+
+namespace {
+    constexpr std::array<char, 4> kMagic{'L', 'O', 'D', 'S'};
+    constexpr std::uint32_t kVersion = 1;
+    constexpr std::string_view kExtension = ".lsc";
+    
+    template<typename T>
+    void writePod(std::ostream& out, const T& value) {
+        static_assert(std::is_trivially_copyable_v<T>);
+        out.write(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+    
+    template<typename T>
+    bool readPod(std::istream& in, T& value) {
+        static_assert(std::is_trivially_copyable_v<T>);
+        return static_cast<bool>(in.read(reinterpret_cast<char*>(&value), sizeof(T)));
+    }
+    
+    std::string toHex(std::uint64_t value) {
+        std::string digits(16, '0');
+        for (auto it = digits.rbegin(); it != digits.rend(); ++it, value >>= 4) {
+            *it = "0123456789abcdef"[value & 0xF];
+        }
+        return digits;
+    }
+    
+    // 流式 xxHash3：逐字段喂入，避免结构体填充字节影响结果
+    class Hasher {
+    public:
+        Hasher() : state_(XXH3_createState(), &XXH3_freeState) {
+            XXH3_128bits_reset(state_.get());
+        }
+        
+        template<typename T>
+        void add(const T& value) {
+            static_assert(std::is_trivially_copyable_v<T>);
+            XXH3_128bits_update(state_.get(), &value, sizeof(T));
+        }
+        
+        template<typename T>
+        void addBuffer(const std::vector<T>& buffer) {
+            add(static_cast<std::uint64_t>(buffer.size()));
+            XXH3_128bits_update(state_.get(), buffer.data(), buffer.size() * sizeof(T));
+        }
+        
+        void addString(std::string_view value) {
+            add(static_cast<std::uint64_t>(value.size()));
+            XXH3_128bits_update(state_.get(), value.data(), value.size());
+        }
+        
+        SimplifyCacheKey digest() const {
+            const auto hash = XXH3_128bits_digest(state_.get());
+            return {hash.high64, hash.low64};
+        }
+    
+    private:
+        std::unique_ptr<XXH3_state_t, decltype(&XXH3_freeState)> state_;
+    };
+} // namespace
+
+SimplifyCacheKey computeSimplifyCacheKey(const core::Mesh& mesh, const core::SimplifyOptions& options,
+                                         std::string_view backend) {
+    Hasher hasher;
+    hasher.add(kVersion);
+    hasher.add(static_cast<std::uint32_t>(MESHOPTIMIZER_VERSION));  // 升级 meshoptimizer 后结果可能不同
+    hasher.addString(backend);
+    
+    const auto& vertices = mesh.vertices();
+    hasher.addBuffer(mesh.indices());
+    hasher.addBuffer(vertices.positions);
+    
+    // 属性流只在参与误差度量时影响结果；接缝锁定还依赖全部属性流是否相同
+    const auto& weights = options.attributeWeights;
+    const bool attributesMatter = weights.any() || options.lockSeams;
+    hasher.add(attributesMatter);
+    if (attributesMatter) {
+        hasher.addBuffer(vertices.normals);
+        hasher.addBuffer(vertices.texCoords);
+        hasher.addBuffer(vertices.colors);
+    }
+    
+    hasher.add(static_cast<std::uint64_t>(options.targetTriangleCount));
+    hasher.add(options.targetError);
+    hasher.add(weights.normal);
+    hasher.add(weights.texCoord);
+    hasher.add(weights.color);
+    hasher.add(options.lockSeams);
+    hasher.add(options.lockBorder);
+    hasher.add(options.lockCellFaces.has_value());
+    if (options.lockCellFaces) {
+        hasher.add(options.lockCellFaces->min);
+        hasher.add(options.lockCellFaces->max);
+    }
+    hasher.add(options.fallbackFactor);
+    return hasher.digest();
+}
+
+std::filesystem::path SimplifyCache::entryPath(const SimplifyCacheKey& key) const {
+    const auto name = toHex(key[0]) + toHex(key[1]);
+    return directory_ / name.substr(0, 2) / (name + std::string(kExtension));
+}
+
+std::optional<CachedSimplification> SimplifyCache::load(const SimplifyCacheKey& key) const {
+    const auto path = entryPath(key);
+    std::ifstream in(path, std::ios::binary);
+    if (!in) {
+        ++misses_;
+        return std::nullopt;
+    }
+    
+    std::array<char, 4> magic{};
+    std::uint32_t version = 0;
+    CachedSimplification entry;
+    std::uint8_t usedFallback = 0;
+    std::uint64_t indexCount = 0;
+    const bool headerOk = in.read(magic.data(), magic.size()) && magic == kMagic &&
+                          readPod(in, version) && version == kVersion &&
+                          readPod(in, entry.error) && readPod(in, entry.topologyTriangleCount) &&
+                          readPod(in, usedFallback) && readPod(in, indexCount) && indexCount % 3 == 0;
+    if (!headerOk) {
+        ++misses_;
+        return std::nullopt;
+    }
+    
+    entry.usedFallback = usedFallback != 0;
+    entry.indices.resize(indexCount);
+    if (!in.read(reinterpret_cast<char*>(entry.indices.data()),
+                 static_cast<std::streamsize>(indexCount * sizeof(core::Index)))) {
+        ++misses_;
+        return std::nullopt;
+    }
+    
+    // 刷新修改时间作为最近使用时间；失败（如条目刚被淘汰）不影响本次命中
+    std::error_code ec;
+    std::filesystem::last_write_time(path, std::filesystem::file_time_type::clock::now(), ec);
+    ++hits_;
+    return entry;
+}
+
+std::expected<void, SimplifyCacheError> SimplifyCache::store(const SimplifyCacheKey& key,
+                                                             const CachedSimplification& entry) const {
+    const auto path = entryPath(key);
+    std::error_code ec;
+    std::filesystem::create_directories(path.parent_path(), ec);
+    if (ec) {
+        return std::unexpected(SimplifyCacheError::DirectoryError);
+    }
+    
+    // 同目录下的唯一临时文件，写完后原子重命名；并发写入同一键的内容相同，后写者覆盖即可
+    thread_local std::mt19937_64 random{std::random_device{}()};
+    auto temporary = path;
+    temporary += "." + toHex(random()) + ".tmp";
+    {
+        std::ofstream out(temporary, std::ios::binary);
+        if (!out) {
+            return std::unexpected(SimplifyCacheError::WriteError);
+        }
+        out.write(kMagic.data(), kMagic.size());
+        writePod(out, kVersion);
+        writePod(out, entry.error);
+        writePod(out, entry.topologyTriangleCount);
+        writePod(out, static_cast<std::uint8_t>(entry.usedFallback));
+        writePod(out, static_cast<std::uint64_t>(entry.indices.size()));
+        out.write(reinterpret_cast<const char*>(entry.indices.data()),
+                  static_cast<std::streamsize>(entry.indices.size() * sizeof(core::Index)));
+        if (!out.flush()) {
+            out.close();
+            std::filesystem::remove(temporary, ec);
+            return std::unexpected(SimplifyCacheError::WriteError);
+        }
+    }
+    
+    std::filesystem::rename(temporary, path, ec);
+    if (ec) {
+        std::filesystem::remove(temporary, ec);
+        return std::unexpected(SimplifyCacheError::WriteError);
+    }
+    ++stores_;
+    
+    // 只有把计数清零的那个线程执行 trim
+    const auto threshold = maxBytes_ / 16;
+    const auto written = std::filesystem::file_size(path, ec);
+    if (!ec && (bytesSinceTrim_ += written) >= threshold && bytesSinceTrim_.exchange(0) >= threshold) {
+        trim();
+    }
+    return {};
+}
+
+size_t SimplifyCache::trim() const {
+    struct Entry {
+        std::filesystem::path path;
+        std::uintmax_t size;
+        std::filesystem::file_time_type lastUse;
+    };
+    
+    std::vector<Entry> entries;
+    std::uintmax_t totalBytes = 0;
+    std::error_code ec;
+    for (auto it = std::filesystem::recursive_directory_iterator(directory_, ec);
+         !ec && it != std::filesystem::recursive_directory_iterator(); it.increment(ec)) {
+        std::error_code entryError;
+        if (!it->is_regular_file(entryError) || it->path().extension() != kExtension) {
+            continue;
+        }
+        const auto size = it->file_size(entryError);
+        const auto lastUse = it->last_write_time(entryError);
+        if (!entryError) {
+            entries.push_back({it->path(), size, lastUse});
+            totalBytes += size;
+        }
+    }
+    if (totalBytes <= maxBytes_) {
+        return 0;
+    }
+    
+    std::sort(entries.begin(), entries.end(), [](const Entry& a, const Entry& b) { return a.lastUse < b.lastUse; });
+    size_t removed = 0;
+    for (const auto& entry : entries) {
+        if (totalBytes <= maxBytes_) {
+            break;
+        }
+        // 其他进程可能已删除同一条目，忽略错误
+        std::error_code removeError;
+        if (std::filesystem::remove(entry.path, removeError)) {
+            ++removed;
+        }
+        totalBytes -= entry.size;
+    }
+    evictions_ += removed;
+    return removed;
+}
+
+SimplifyCacheStats SimplifyCache::stats() const noexcept {
+    return {hits_.load(), misses_.load(), stores_.load(), evictions_.load()};
+}
+
+core::SimplifyResult CachingSimplifier::simplify(const core::Mesh& mesh, const core::SimplifyOptions& options) const {
+    if (mesh.empty() || mesh.triangleCount() <= options.targetTriangleCount) {
+        return inner_->simplify(mesh, options);
+    }
+    
+    // 缓存的索引缓冲总是引用未压缩的输入顶点缓冲，压缩在取出后按选项执行
+    const auto finish = [&](core::Mesh simplified) {
+        return options.compactVertices ? core::compactMesh(simplified) : simplified;
+    };
+    
+    const auto key = computeSimplifyCacheKey(mesh, options, inner_->name());
+    if (auto cached = cache_->load(key)) {
+        const auto vertexCount = mesh.vertexCount();
+        const bool valid = std::all_of(cached->indices.begin(), cached->indices.end(),
+                                       [vertexCount](core::Index i) { return i < vertexCount; });
+        if (valid) {
+            return {finish(mesh.withIndices(std::move(cached->indices))), cached->error,
+                    static_cast<size_t>(cached->topologyTriangleCount), cached->usedFallback};
+        }
+    }
+    
+    auto uncompacted = options;
+    uncompacted.compactVertices = false;
+    auto result = inner_->simplify(mesh, uncompacted);
+    
+    // 只缓存仍引用输入顶点缓冲且确实减少了三角形的结果（简化失败时内部后端原样返回输入）；
+    // 写入失败不影响本次简化
+    if (result.mesh.vertexCount() == mesh.vertexCount() && result.mesh.triangleCount() < mesh.triangleCount()) {
+        (void)cache_->store(key, {result.mesh.indices(), result.error,
+                                  static_cast<std::uint64_t>(result.topologyTriangleCount), result.usedFallback});
+    }
+    result.mesh = finish(std::move(result.mesh));
+    return result;
+}
+
+} // namespace lod::io
@@ -0,0 +1,94 @@
+#pragma once
+
+#include "../core/LodAlgorithm.hpp"
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <expected>
+#include <filesystem>
+#include <memory>
+#include <optional>
+#include <string_view>
+#include <vector>
+
+namespace lod::io {
+
+// 简化缓存错误类型
+enum class SimplifyCacheError {
+    DirectoryError,
+    WriteError
+};
+
+// 缓存键：128 位 xxHash3
+using SimplifyCacheKey = std::array<std::uint64_t, 2>;
+
+// 缓存条目：相对输入顶点缓冲（未压缩）的简化索引缓冲与简化器报告的误差
+struct CachedSimplification {
+    std::vector<core::Index> indices;
+    double error{0.0};
+    std::uint64_t topologyTriangleCount{0};
+    bool usedFallback{false};
+};
+
+struct SimplifyCacheStats {
+    std::uint64_t hits{0};
+    std::uint64_t misses{0};
+    std::uint64_t stores{0};
+    std::uint64_t evictions{0};
+};
+
+// 纯函数：缓存键，覆盖索引缓冲、位置缓冲、参与误差度量的属性流、全部简化选项、后端名称与 meshoptimizer 版本
+[[nodiscard]] SimplifyCacheKey computeSimplifyCacheKey(const core::Mesh& mesh, const core::SimplifyOptions& options,
+                                                       std::string_view backend);
+
+// 内容寻址的磁盘存储：条目位于 <directory>/<键前两位十六进制>/<键>.lsc。
+// 先写临时文件再原子重命名，多线程/多进程并发写入安全；命中时刷新修改时间，
+// 超过容量上限时按修改时间淘汰最久未使用的条目（LRU）
+class SimplifyCache {
+public:
+    explicit SimplifyCache(std::filesystem::path directory, std::uintmax_t maxBytes = std::uintmax_t{1} << 30)
+        : directory_(std::move(directory)), maxBytes_(maxBytes) {}
+    
+    // 缺失、损坏或版本不符均视为未命中
+    [[nodiscard]] std::optional<CachedSimplification> load(const SimplifyCacheKey& key) const;
+    
+    // 写入新条目；累计写入量超过上限的 1/16 时顺带执行一次 trim
+    [[nodiscard]] std::expected<void, SimplifyCacheError> store(const SimplifyCacheKey& key,
+                                                                const CachedSimplification& entry) const;
+    
+    // 淘汰最久未使用的条目直至总大小不超过上限，返回删除的条目数
+    size_t trim() const;
+    
+    [[nodiscard]] SimplifyCacheStats stats() const noexcept;
+    [[nodiscard]] const std::filesystem::path& directory() const noexcept { return directory_; }
+    [[nodiscard]] std::uintmax_t maxBytes() const noexcept { return maxBytes_; }
+
+private:
+    [[nodiscard]] std::filesystem::path entryPath(const SimplifyCacheKey& key) const;
+    
+    std::filesystem::path directory_;
+    std::uintmax_t maxBytes_;
+    
+    mutable std::atomic<std::uint64_t> hits_{0};
+    mutable std::atomic<std::uint64_t> misses_{0};
+    mutable std::atomic<std::uint64_t> stores_{0};
+    mutable std::atomic<std::uint64_t> evictions_{0};
+    mutable std::atomic<std::uintmax_t> bytesSinceTrim_{0};
+};
+
+// 带缓存的简化后端装饰器：命中时跳过内部简化器，只重放索引缓冲（按需压缩顶点）。
+// 内部简化器未能减少三角形（含失败时原样返回输入）的结果不写入缓存
+class CachingSimplifier : public core::ISimplifier {
+public:
+    CachingSimplifier(std::shared_ptr<const core::ISimplifier> inner, std::shared_ptr<const SimplifyCache> cache)
+        : inner_(std::move(inner)), cache_(std::move(cache)) {}
+    
+    core::SimplifyResult simplify(const core::Mesh& mesh, const core::SimplifyOptions& options) const override;
+    std::string_view name() const noexcept override { return inner_->name(); }
+
+private:
+    std::shared_ptr<const core::ISimplifier> inner_;
+    std::shared_ptr<const SimplifyCache> cache_;
+};
+
+} // namespace lod::io
@@ -3,74 +3,122 @@
 #include <iomanip>
 #include <sstream>
 #include <cmath>
+#include <limits>
 
 namespace lod::io {
 
+namespace {
+    // 包住 region 的 OBB：在上下两个高度面上按 3 x 3 采样经纬度，中心与边中点计入椭球面的拱高，
+    // 平坦数据（高差为 0）的 region 也因此有非零体积
+    std::optional<core::OrientedBox> regionEnclosingBox(const geo::GeoBBox& region) {
+        const auto frame = geo::LocalFrame::enuAt(region);
+        std::vector<std::array<double, 3>> points;
+        points.reserve(18);
+        for (const double height : {region.minHeight, region.maxHeight}) {
+            for (int i = 0; i <= 2; ++i) {
+                for (int j = 0; j <= 2; ++j) {
+                    const double lon = region.minLon + (region.maxLon - region.minLon) * 0.5 * i;
+                    const double lat = region.minLat + (region.maxLat - region.minLat) * 0.5 * j;
+                    points.push_back(frame.toLocal(geo::geodeticToEcef({lon, lat, height})));
+                }
+            }
+        }
+        return core::computeOrientedBox(std::span<const std::array<double, 3>>(points));
+    }
+} // namespace
+
 // TilesetBuilder 实现
 nlohmann::json TilesetBuilder::buildTileset(const core::LodNode& root) const {
+    return std::visit([this](const auto& table) {
+        return buildTileset(table);
+    }, core::flattenLodTree(root));
+}
+
+nlohmann::json TilesetBuilder::buildTileset(const core::GeoLodTable& table) const {
     nlohmann::json tileset;
-    
-    // Asset 信息
     tileset["asset"] = buildAsset();
-    
-    // 几何误差
-    tileset["geometricError"] = std::visit([this](const auto& node) -> double {
-        return calculateGeometricError(node);
-    }, root);
-    
-    // 根瓦片
-    tileset["root"] = buildTile(root);
-    
+    tileset["geometricError"] = table.empty() ? calculateGeometricError(0.0)
+                                              : calculateGeometricError(table.geometricError(0));
+    tileset["root"] = buildTiles(table);
+    if (!table.empty()) {
+        // region 包围体不受 transform 影响；瓦片内容与 box 包围体位于局部 ENU，经 transform 变换到地心坐标
+        tileset["root"]["transform"] = geo::LocalFrame::enuAt(config_.dataBounds.value_or(table.bounds(0))).toEcefMatrix();
+    }
+    return tileset;
+}
+
+nlohmann::json TilesetBuilder::buildTileset(const core::GeometricLodTable& table) const {
+    nlohmann::json tileset;
+    tileset["asset"] = buildAsset();
+    tileset["geometricError"] = table.empty() ? calculateGeometricError(0.0)
+                                              : calculateGeometricError(table.geometricError(0));
+    tileset["root"] = buildTiles(table);
     return tileset;
 }
 
 nlohmann::json TilesetBuilder::buildTile(const core::LodNode& node, const std::string& contentUri) const {
-    nlohmann::json tile;
+    return std::visit([&](const auto& table) {
+        return buildTiles(table, contentUri);
+    }, core::flattenLodTree(node));
+}
+
+template<typename Table>
+nlohmann::json TilesetBuilder::buildTiles(const Table& table, const std::string& rootContentUri) const {
+    if (table.empty()) {
+        return nlohmann::json::object();
+    }
     
-    return std::visit([&](const auto& lodNode) -> nlohmann::json {
+    // 子节点编号总大于父节点，逆序处理时子瓦片已就绪，直接移入父瓦片
+    std::vector<nlohmann::json> tiles(table.size());
+    
+    // 各节点的紧致 OBB 覆盖自身网格顶点与子节点 OBB 的角点，因而包含整棵子树的内容
+    std::vector<std::optional<core::OrientedBox>> boxes(table.size());
+    std::vector<std::array<double, 3>> points;
+    
+    table.forEachBottomUp([&](const auto& node) {
+        nlohmann::json& tile = tiles[node.index()];
+        
         // 几何误差
-        tile["geometricError"] = lodNode.geometricError;
+        tile["geometricError"] = node.geometricError();
         
         // 包围体
-        if constexpr (std::is_same_v<std::decay_t<decltype(lodNode)>, core::GeoLodNode>) {
-            tile["boundingVolume"] = buildBoundingVolume(lodNode.region);
-        } else {
-            // 几何模式：转换为地理包围盒（简化）
-            geo::GeoBBox region{
-                static_cast<double>(lodNode.bounds.min[0]),
-                static_cast<double>(lodNode.bounds.min[1]),
-                static_cast<double>(lodNode.bounds.max[0]),
-                static_cast<double>(lodNode.bounds.max[1])
-            };
-            tile["boundingVolume"] = buildBoundingVolume(region);
+        points.clear();
+        if (node.hasMesh()) {
+            for (const auto& p : node.mesh().vertices().positions) {
+                points.push_back({p[0], p[1], p[2]});
+            }
         }
+        for (const auto child : node.children()) {
+            if (boxes[child]) {
+                const auto corners = boxes[child]->corners();
+                points.insert(points.end(), corners.begin(), corners.end());
+            }
+        }
+        boxes[node.index()] = core::computeOrientedBox(std::span<const std::array<double, 3>>(points));
+        tile["boundingVolume"] = buildBoundingVolume(node.bounds(), boxes[node.index()]);
         
         // 细分条件
         tile["refine"] = "REPLACE";
         
         // 内容（如果有网格数据）
-        if (!lodNode.mesh.empty()) {
-            std::string uri = contentUri.empty() ? generateContentUri(lodNode) : contentUri;
+        if (node.hasMesh() && !node.mesh().empty()) {
+            const bool isRoot = node.index() == 0;
+            std::string uri = isRoot && !rootContentUri.empty() ? rootContentUri
+                                                                : contentUri(node.bounds(), node.level(), node.index());
             tile["content"] = nlohmann::json{{"uri", uri}};
         }
         
         // 子瓦片
-        if (!lodNode.children.empty()) {
+        if (!node.isLeaf()) {
             nlohmann::json children = nlohmann::json::array();
-            
-            for (const auto& child : lodNode.children) {
-                if (child) {
-                    children.push_back(buildTile(*child));
-                }
-            }
-            
-            if (!children.empty()) {
-                tile["children"] = children;
+            for (const auto child : node.children()) {
+                children.push_back(std::move(tiles[child]));
             }
+            tile["children"] = std::move(children);
         }
-        
-        return tile;
-    }, node);
+    });
+    
+    return std::move(tiles.front());
 }
 
 nlohmann::json TilesetBuilder::buildAsset() const {
@@ -94,121 +142,140 @@ nlohmann::json TilesetBuilder::buildBoundingVolume(const geo::GeoBBox& region) c
         region.minLat * M_PI / 180.0,  // 南边界（弧度）
         region.maxLon * M_PI / 180.0,  // 东边界（弧度）
         region.maxLat * M_PI / 180.0,  // 北边界（弧度）
-        0.0,    // 最小高度
-        1000.0  // 最大高度（暂定）
+        region.minHeight,              // 最小椭球高（米）
+        region.maxHeight               // 最大椭球高（米）
     });
     
     return boundingVolume;
 }
 
-void TilesetBuilder::buildChildTiles(nlohmann::json& parentTile, const core::LodNode& node) const {
-    std::visit([&](const auto& lodNode) {
-        if (!lodNode.children.empty()) {
-            nlohmann::json children = nlohmann::json::array();
-            
-            for (const auto& child : lodNode.children) {
-                if (child) {
-                    children.push_back(buildTile(*child));
-                }
-            }
-            
-            parentTile["children"] = children;
-        }
-    }, node);
+nlohmann::json TilesetBuilder::buildBoundingVolume(const core::BoundingBox& bounds) const {
+    // 几何模式：局部坐标下的轴对齐 box
+    return buildBoundingVolume(core::OrientedBox::fromBounds(bounds));
 }
 
-double TilesetBuilder::calculateGeometricError(const core::LodNode& node) const {
-    return std::visit([](const auto& lodNode) -> double {
-        return lodNode.geometricError > 0.0 ? lodNode.geometricError : 100.0;
-    }, node);
+nlohmann::json TilesetBuilder::buildBoundingVolume(const core::OrientedBox& box) const {
+    const auto values = box.toTilesBox();
+    return nlohmann::json{{"box", values}};
 }
 
-std::string TilesetBuilder::generateContentUri(const core::LodNode& node) const {
-    return std::visit([](const auto& lodNode) -> std::string {
-        return "tiles/level_" + std::to_string(lodNode.lodLevel) + 
-               "_" + std::to_string(reinterpret_cast<uintptr_t>(&lodNode)) + ".b3dm";
-    }, node);
+nlohmann::json TilesetBuilder::buildBoundingVolume(const geo::GeoBBox& region,
+                                                   const std::optional<core::OrientedBox>& box) const {
+    // region 按包住它的 OBB（含拱高）计体积，与同为局部 ENU（米）下的 box 直接比较
+    if (!box) {
+        return buildBoundingVolume(region);
+    }
+    const auto regionBox = regionEnclosingBox(region);
+    return !regionBox || box->volume() < regionBox->volume() ? buildBoundingVolume(*box) : buildBoundingVolume(region);
+}
+
+nlohmann::json TilesetBuilder::buildBoundingVolume(const core::BoundingBox& bounds,
+                                                   const std::optional<core::OrientedBox>& box) const {
+    return box ? buildBoundingVolume(*box) : buildBoundingVolume(bounds);
+}
+
+double TilesetBuilder::calculateGeometricError(double geometricError) const {
+    return geometricError > 0.0 ? geometricError : 100.0;
+}
+
+std::string TilesetBuilder::contentUri(int lodLevel, core::LodNodeIndex index) {
+    return "tiles/level_" + std::to_string(lodLevel) + "_" + std::to_string(index) + ".b3dm";
+}
+
+std::string TilesetBuilder::contentUri(const geo::GeoBBox& region, int lodLevel, core::LodNodeIndex index) const {
+    if (config_.tilingScheme) {
+        if (const auto key = config_.tilingScheme->keyOf(region)) {
+            return "tiles/" + std::to_string(key->z) + "/" + std::to_string(key->x) + "/" +
+                   std::to_string(key->y) + ".b3dm";
+        }
+    }
+    return contentUri(lodLevel, index);
+}
+
+std::string TilesetBuilder::contentUri(const core::BoundingBox&, int lodLevel, core::LodNodeIndex index) const {
+    return contentUri(lodLevel, index);
 }
 
 // B3dmExporter 实现
 std::expected<void, TilesError> B3dmExporter::exportTileset(const core::LodNode& root, const std::filesystem::path& outputDir) const {
     // 创建输出目录结构
-    createDirectoryStructure(outputDir, root);
-    
-    // 导出 tileset.json
-    auto tilesetResult = generateTilesetJson(root, outputDir / "tileset.json");
-    if (!tilesetResult) {
-        return tilesetResult;
-    }
+    createDirectoryStructure(outputDir);
     
-    // 递归导出所有瓦片内容
-    std::function<std::expected<void, TilesError>(const core::LodNode&, const std::filesystem::path&)> exportRecursive;
+    // 展平一次，tileset.json 与瓦片文件共用同一张节点表
+    const auto table = core::flattenLodTree(root);
     
-    exportRecursive = [&](const core::LodNode& node, const std::filesystem::path& basePath) -> std::expected<void, TilesError> {
-        return std::visit([&](const auto& lodNode) -> std::expected<void, TilesError> {
-            // 导出当前节点的内容
-            if (!lodNode.mesh.empty()) {
-                std::string filename = "level_" + std::to_string(lodNode.lodLevel) + 
-                                     "_" + std::to_string(reinterpret_cast<uintptr_t>(&lodNode)) + ".b3dm";
-                auto filePath = basePath / "tiles" / filename;
-                
-                auto result = exportTileContent(node, filePath);
-                if (!result) {
-                    return result;
-                }
+    return std::visit([&](const auto& nodes) -> std::expected<void, TilesError> {
+        auto tilesetResult = writeTilesetJson(tilesetBuilder_.buildTileset(nodes), outputDir / "tileset.json");
+        if (!tilesetResult) {
+            return tilesetResult;
+        }
+        
+        // 按 BFS 顺序导出所有瓦片内容
+        for (const auto node : nodes) {
+            if (!node.hasMesh() || node.mesh().empty()) {
+                continue;
             }
             
-            // 递归导出子节点
-            for (const auto& child : lodNode.children) {
-                if (child) {
-                    auto childResult = exportRecursive(*child, basePath);
-                    if (!childResult) {
-                        return childResult;
-                    }
-                }
+            auto result = writeTileContent(node.mesh(),
+                                           outputDir / tilesetBuilder_.contentUri(node.bounds(), node.level(), node.index()));
+            if (!result) {
+                return result;
             }
-            
-            return {};
-        }, node);
-    };
-    
-    return exportRecursive(root, outputDir);
-}
-
-std::expected<void, TilesError> B3dmExporter::exportTileContent(const core::LodNode& node, const std::filesystem::path& outputFile) const {
-    return std::visit([&](const auto& lodNode) -> std::expected<void, TilesError> {
-        // 创建 GLB 内容
-        auto glbResult = createGlbContent(lodNode.mesh);
-        if (!glbResult) {
-            return std::unexpected(glbResult.error());
-        }
-        
-        // 创建 B3DM 文件
-        auto b3dmResult = createB3dmFile(glbResult.value());
-        if (!b3dmResult) {
-            return std::unexpected(b3dmResult.error());
-        }
-        
-        // 写入文件
-        std::ofstream file(outputFile, std::ios::binary);
-        if (!file.is_open()) {
-            return std::unexpected(TilesError::WriteError);
-        }
-        
-        const auto& data = b3dmResult.value();
-        file.write(reinterpret_cast<const char*>(data.data()), data.size());
-        
-        if (!file.good()) {
-            return std::unexpected(TilesError::WriteError);
         }
         
         return {};
+    }, table);
+}
+
+std::expected<void, TilesError> B3dmExporter::exportTileContent(const core::LodNode& node, const std::filesystem::path& outputFile) const {
+    return std::visit([&](const auto& lodNode) {
+        return writeTileContent(lodNode.mesh, outputFile);
     }, node);
 }
 
-std::expected<void, TilesError> B3dmExporter::generateTilesetJson(const core::LodNode& root, const std::filesystem::path& outputFile) const {
-    auto tileset = tilesetBuilder_.buildTileset(root);
+std::expected<void, TilesError> B3dmExporter::writeTileContent(const core::Mesh& mesh, const std::filesystem::path& outputFile) const {
+    // 按瓦片键组织的路径带有层级子目录
+    std::error_code ec;
+    std::filesystem::create_directories(outputFile.parent_path(), ec);
+    if (ec) {
+        return std::unexpected(TilesError::InvalidPath);
+    }
+    
+    const auto rtcCenter = computeRtcCenter(mesh);
+    
+    // 创建 GLB 内容
+    auto glbResult = createGlbContent(mesh, rtcCenter);
+    if (!glbResult) {
+        return std::unexpected(glbResult.error());
+    }
+    
+    // 创建 B3DM 文件
+    auto b3dmResult = createB3dmFile(glbResult.value(), rtcCenter);
+    if (!b3dmResult) {
+        return std::unexpected(b3dmResult.error());
+    }
+    
+    // 写入文件
+    std::ofstream file(outputFile, std::ios::binary);
+    if (!file.is_open()) {
+        return std::unexpected(TilesError::WriteError);
+    }
+    
+    const auto& data = b3dmResult.value();
+    file.write(reinterpret_cast<const char*>(data.data()), data.size());
+    
+    if (!file.good()) {
+        return std::unexpected(TilesError::WriteError);
+    }
     
+    return {};
+}
+
+std::expected<void, TilesError> B3dmExporter::generateTilesetJson(const core::LodNode& root, const std::filesystem::path& outputFile) const {
+    return writeTilesetJson(tilesetBuilder_.buildTileset(root), outputFile);
+}
+
+std::expected<void, TilesError> B3dmExporter::writeTilesetJson(const nlohmann::json& tileset, const std::filesystem::path& outputFile) const {
     std::ofstream file(outputFile);
     if (!file.is_open()) {
         return std::unexpected(TilesError::WriteError);
@@ -223,30 +290,102 @@ std::expected<void, TilesError> B3dmExporter::generateTilesetJson(const core::Lo
     return {};
 }
 
-std::expected<std::vector<uint8_t>, TilesError> B3dmExporter::createGlbContent(const core::Mesh& mesh) const {
-    // 简化的 GLB 创建（实际实现需要使用 tinygltf 库）
-    std::vector<uint8_t> glbData;
-    
+std::expected<std::vector<uint8_t>, TilesError> B3dmExporter::createGlbContent(const core::Mesh& mesh,
+                                                                             const geo::Vec3d& rtcCenter) const {
+    // 最小 glTF 2.0 二进制：POSITION（相对 rtcCenter 的 float 偏移）、可选 NORMAL 与 uint32 索引。
+    // glTF 为 Y 轴向上，运行时再转回 Z 轴向上并加上 RTC_CENTER，因此局部 (x, y, z) 写为 (x, z, -y)
     try {
-        // 这里应该使用 tinygltf 库来创建 GLB 文件
-        // 当前是占位符实现
+        const auto& vertices = mesh.vertices();
+        const auto& indices = mesh.indices();
+        const size_t vertexCount = vertices.positions.size();
+        const bool hasNormals = vertices.normals.size() == vertexCount;
+        
+        std::vector<uint8_t> binary;
+        const auto appendFloats = [&](float a, float b, float c) {
+            const float values[3] = {a, b, c};
+            const auto* bytes = reinterpret_cast<const uint8_t*>(values);
+            binary.insert(binary.end(), bytes, bytes + sizeof(values));
+        };
+        
+        std::array<float, 3> minPosition{std::numeric_limits<float>::max(), std::numeric_limits<float>::max(),
+                                         std::numeric_limits<float>::max()};
+        std::array<float, 3> maxPosition{std::numeric_limits<float>::lowest(), std::numeric_limits<float>::lowest(),
+                                         std::numeric_limits<float>::lowest()};
+        for (const auto& p : vertices.positions) {
+            const std::array<float, 3> offset{static_cast<float>(p[0] - rtcCenter[0]),
+                                              static_cast<float>(p[2] - rtcCenter[2]),
+                                              static_cast<float>(-(p[1] - rtcCenter[1]))};
+            for (int axis = 0; axis < 3; ++axis) {
+                minPosition[axis] = std::min(minPosition[axis], offset[axis]);
+                maxPosition[axis] = std::max(maxPosition[axis], offset[axis]);
+            }
+            appendFloats(offset[0], offset[1], offset[2]);
+        }
+        const size_t positionBytes = binary.size();
+        
+        if (hasNormals) {
+            for (const auto& n : vertices.normals) {
+                appendFloats(n[0], n[2], -n[1]);
+            }
+        }
+        const size_t normalBytes = binary.size() - positionBytes;
+        
+        const auto* indexBytes = reinterpret_cast<const uint8_t*>(indices.data());
+        binary.insert(binary.end(), indexBytes, indexBytes + indices.size() * sizeof(core::Index));
+        const size_t indexOffset = positionBytes + normalBytes;
+        binary.resize((binary.size() + 3) / 4 * 4, 0);
         
-        // GLB 头部（12字节）
-        glbData.resize(12);
+        nlohmann::json bufferViews = nlohmann::json::array();
+        nlohmann::json accessors = nlohmann::json::array();
+        nlohmann::json attributes;
         
-        // Magic number "glTF"
-        glbData[0] = 'g'; glbData[1] = 'l'; glbData[2] = 'T'; glbData[3] = 'F';
+        bufferViews.push_back({{"buffer", 0}, {"byteOffset", 0}, {"byteLength", positionBytes}, {"target", 34962}});
+        accessors.push_back({{"bufferView", 0}, {"componentType", 5126}, {"count", vertexCount}, {"type", "VEC3"},
+                             {"min", minPosition}, {"max", maxPosition}});
+        attributes["POSITION"] = 0;
+        if (hasNormals) {
+            bufferViews.push_back({{"buffer", 0}, {"byteOffset", positionBytes}, {"byteLength", normalBytes},
+                                   {"target", 34962}});
+            accessors.push_back({{"bufferView", 1}, {"componentType", 5126}, {"count", vertexCount}, {"type", "VEC3"}});
+            attributes["NORMAL"] = 1;
+        }
+        const size_t indexView = bufferViews.size();
+        bufferViews.push_back({{"buffer", 0}, {"byteOffset", indexOffset},
+                               {"byteLength", indices.size() * sizeof(core::Index)}, {"target", 34963}});
+        accessors.push_back({{"bufferView", indexView}, {"componentType", 5125}, {"count", indices.size()},
+                             {"type", "SCALAR"}});
         
-        // Version (2)
-        uint32_t version = 2;
-        std::memcpy(&glbData[4], &version, 4);
+        const nlohmann::json gltf{
+            {"asset", {{"version", "2.0"}, {"generator", "LOD Generator"}}},
+            {"scene", 0},
+            {"scenes", {{{"nodes", {0}}}}},
+            {"nodes", {{{"mesh", 0}}}},
+            {"meshes", {{{"primitives", {{{"attributes", attributes}, {"indices", accessors.size() - 1}, {"mode", 4}}}}}}},
+            {"accessors", accessors},
+            {"bufferViews", bufferViews},
+            {"buffers", {{{"byteLength", binary.size()}}}}
+        };
+        std::string json = gltf.dump();
+        json.append((4 - json.size() % 4) % 4, ' ');
         
-        // Total length (will be updated)
-        uint32_t totalLength = 12;
-        std::memcpy(&glbData[8], &totalLength, 4);
+        // 头部 12 字节，JSON 与 BIN 两个块各带 8 字节块头
+        const auto totalLength = static_cast<uint32_t>(12 + 8 + json.size() + 8 + binary.size());
+        std::vector<uint8_t> glbData;
+        glbData.reserve(totalLength);
+        const auto appendUint32 = [&](uint32_t value) {
+            const auto* bytes = reinterpret_cast<const uint8_t*>(&value);
+            glbData.insert(glbData.end(), bytes, bytes + 4);
+        };
         
-        // 这里应该添加实际的网格数据转换
-        // 当前返回最小的有效 GLB
+        appendUint32(0x46546C67);  // "glTF"
+        appendUint32(2);
+        appendUint32(totalLength);
+        appendUint32(static_cast<uint32_t>(json.size()));
+        appendUint32(0x4E4F534A);  // "JSON"
+        glbData.insert(glbData.end(), json.begin(), json.end());
+        appendUint32(static_cast<uint32_t>(binary.size()));
+        appendUint32(0x004E4942);  // "BIN"
+        glbData.insert(glbData.end(), binary.begin(), binary.end());
         
         return glbData;
     } catch (const std::exception&) {
@@ -254,13 +393,18 @@ std::expected<std::vector<uint8_t>, TilesError> B3dmExporter::createGlbContent(c
     }
 }
 
-std::expected<std::vector<uint8_t>, TilesError> B3dmExporter::createB3dmFile(const std::vector<uint8_t>& glbContent) const {
+std::expected<std::vector<uint8_t>, TilesError> B3dmExporter::createB3dmFile(const std::vector<uint8_t>& glbContent,
+                                                                           const geo::Vec3d& rtcCenter) const {
     try {
         std::vector<uint8_t> b3dmData;
         
-        // B3DM 头部
+        // 要素表 JSON：RTC_CENTER 以双精度保存瓦片原点，空格填充到 8 字节边界
         const uint32_t headerLength = 28;
-        const uint32_t featureTableJsonLength = 0;
+        std::string featureTableJson = nlohmann::json{{"BATCH_LENGTH", 0}, {"RTC_CENTER", rtcCenter}}.dump();
+        featureTableJson.append((8 - (headerLength + featureTableJson.size()) % 8) % 8, ' ');
+        
+        // B3DM 头部
+        const uint32_t featureTableJsonLength = static_cast<uint32_t>(featureTableJson.size());
         const uint32_t featureTableBinaryLength = 0;
         const uint32_t batchTableJsonLength = 0;
         const uint32_t batchTableBinaryLength = 0;
@@ -297,6 +441,10 @@ std::expected<std::vector<uint8_t>, TilesError> B3dmExporter::createB3dmFile(con
         // Batch table binary byte length
         std::memcpy(&b3dmData[offset], &batchTableBinaryLength, 4); offset += 4;
         
+        // Feature table JSON
+        std::memcpy(&b3dmData[offset], featureTableJson.data(), featureTableJson.size());
+        offset += featureTableJson.size();
+        
         // GLB content
         std::memcpy(&b3dmData[offset], glbContent.data(), glbContent.size());
         
@@ -316,7 +464,7 @@ std::expected<std::vector<uint8_t>, TilesError> B3dmExporter::applyDracoCompress
     return glbContent;
 }
 
-void B3dmExporter::createDirectoryStructure(const std::filesystem::path& baseDir, const core::LodNode& root) const {
+void B3dmExporter::createDirectoryStructure(const std::filesystem::path& baseDir) const {
     std::filesystem::create_directories(baseDir);
     std::filesystem::create_directories(baseDir / "tiles");
 }
@@ -380,21 +528,26 @@ std::expected<std::vector<uint8_t>, TilesError> glbToB3dm(const std::vector<uint
     return b3dmData;
 }
 
-std::array<double, 3> wgs84ToCartesian(double longitude, double latitude, double altitude) noexcept {
-    const double a = 6378137.0; // WGS84 semi-major axis
-    const double f = 1.0 / 298.257223563; // WGS84 flattening
-    const double e2 = 2 * f - f * f; // First eccentricity squared
-    
-    const double lon_rad = longitude * M_PI / 180.0;
-    const double lat_rad = latitude * M_PI / 180.0;
-    
-    const double N = a / std::sqrt(1 - e2 * std::sin(lat_rad) * std::sin(lat_rad));
-    
-    const double x = (N + altitude) * std::cos(lat_rad) * std::cos(lon_rad);
-    const double y = (N + altitude) * std::cos(lat_rad) * std::sin(lon_rad);
-    const double z = (N * (1 - e2) + altitude) * std::sin(lat_rad);
+geo::Vec3d computeRtcCenter(const core::Mesh& mesh) noexcept {
+    const auto& positions = mesh.vertices().positions;
+    if (positions.empty()) {
+        return {0.0, 0.0, 0.0};
+    }
     
-    return {x, y, z};
+    geo::Vec3d minCorner{positions[0][0], positions[0][1], positions[0][2]};
+    geo::Vec3d maxCorner = minCorner;
+    for (const auto& p : positions) {
+        for (int axis = 0; axis < 3; ++axis) {
+            minCorner[axis] = std::min(minCorner[axis], static_cast<double>(p[axis]));
+            maxCorner[axis] = std::max(maxCorner[axis], static_cast<double>(p[axis]));
+        }
+    }
+    return {(minCorner[0] + maxCorner[0]) * 0.5, (minCorner[1] + maxCorner[1]) * 0.5,
+            (minCorner[2] + maxCorner[2]) * 0.5};
+}
+
+std::array<double, 3> wgs84ToCartesian(double longitude, double latitude, double altitude) noexcept {
+    return geo::geodeticToEcef({longitude, latitude, altitude});
 }
 
 } // namespace lod::io 
\ No newline at end of file
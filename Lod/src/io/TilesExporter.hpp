@@ -1,6 +1,9 @@
 #pragma once
 
 #include "../core/LodAlgorithm.hpp"
+#include "../core/LodTable.hpp"
+#include "../core/OrientedBox.hpp"
+#include "../geo/LocalFrame.hpp"
 #include <string>
 #include <filesystem>
 #include <expected>
@@ -35,6 +38,8 @@ struct TilesExportConfig {
     bool optimizeForCesium{true};
     std::string asset_version{"1.1"};
     std::optional<std::string> copyright;
+    std::optional<geo::TilingScheme> tilingScheme;  // 与 LodConfig::tilingScheme 相同，瓦片路径由瓦片键决定
+    std::optional<geo::GeoBBox> dataBounds;  // 地理模式：读取器的数据范围，顶点位于 enuAt(dataBounds) 下；为空时取根区域
 };
 
 // Tileset.json 生成器
@@ -46,27 +51,48 @@ public:
     // 从 LOD 层次结构构建 tileset
     [[nodiscard]] nlohmann::json buildTileset(const core::LodNode& root) const;
     
-    // 构建单个 tile 对象
+    // 从扁平化节点表构建 tileset（逆 BFS 顺序自底向上组装，线性时间）。
+    // 地理模式的顶点位于 geo::LocalFrame::enuAt(dataBounds) 下，根瓦片带有该坐标系到地心坐标的 transform；
+    // 按瓦片方案细分时根区域是方案中的瓦片而非数据范围，须在配置中给出 dataBounds
+    [[nodiscard]] nlohmann::json buildTileset(const core::GeoLodTable& table) const;
+    [[nodiscard]] nlohmann::json buildTileset(const core::GeometricLodTable& table) const;
+    
+    // 构建单个 tile 对象（含子瓦片）
     [[nodiscard]] nlohmann::json buildTile(const core::LodNode& node, 
                                           const std::string& contentUri = "") const;
     
     // 构建 asset 信息
     [[nodiscard]] nlohmann::json buildAsset() const;
     
-    // 构建 bounding volume
+    // 构建 bounding volume：region（真实高度范围）或 box
     [[nodiscard]] nlohmann::json buildBoundingVolume(const geo::GeoBBox& region) const;
+    [[nodiscard]] nlohmann::json buildBoundingVolume(const core::BoundingBox& bounds) const;
+    [[nodiscard]] nlohmann::json buildBoundingVolume(const core::OrientedBox& box) const;
+    
+    // 按节点内容选择包围体：地理模式取 region 与紧致 box 中体积较小者，几何模式使用紧致 box；
+    // 没有内容的节点退回节点边界
+    [[nodiscard]] nlohmann::json buildBoundingVolume(const geo::GeoBBox& region,
+                                                     const std::optional<core::OrientedBox>& box) const;
+    [[nodiscard]] nlohmann::json buildBoundingVolume(const core::BoundingBox& bounds,
+                                                     const std::optional<core::OrientedBox>& box) const;
+    
+    // 节点内容 URI（由层级与表中编号决定，tileset 与瓦片文件保持一致）
+    [[nodiscard]] static std::string contentUri(int lodLevel, core::LodNodeIndex index);
+    
+    // 配置了瓦片方案且节点区域恰为方案中的瓦片时为 tiles/{z}/{x}/{y}.b3dm，多次运行之间保持不变；
+    // 其余节点同上
+    [[nodiscard]] std::string contentUri(const geo::GeoBBox& region, int lodLevel, core::LodNodeIndex index) const;
+    [[nodiscard]] std::string contentUri(const core::BoundingBox& bounds, int lodLevel, core::LodNodeIndex index) const;
 
 private:
     TilesExportConfig config_;
     
-    // 递归构建子瓦片
-    void buildChildTiles(nlohmann::json& parentTile, const core::LodNode& node) const;
+    // 自底向上构建所有瓦片，返回根瓦片
+    template<typename Table>
+    nlohmann::json buildTiles(const Table& table, const std::string& rootContentUri = "") const;
     
     // 计算几何误差
-    double calculateGeometricError(const core::LodNode& node) const;
-    
-    // 生成内容 URI
-    std::string generateContentUri(const core::LodNode& node) const;
+    double calculateGeometricError(double geometricError) const;
 };
 
 // 3D Tiles 导出器接口
@@ -91,7 +117,7 @@ public:
 class B3dmExporter : public ITilesExporter {
 public:
     explicit B3dmExporter(TilesExportConfig config = {})
-        : config_(std::move(config)), tilesetBuilder_(config) {}
+        : config_(std::move(config)), tilesetBuilder_(config_) {}
     
     std::expected<void, TilesError>
     exportTileset(const core::LodNode& root, const std::filesystem::path& outputDir) const override;
@@ -106,20 +132,28 @@ private:
     TilesExportConfig config_;
     TilesetBuilder tilesetBuilder_;
     
-    // 创建 GLB 内容
+    // 创建 GLB 内容（顶点写为相对 rtcCenter 的 float 偏移）
     std::expected<std::vector<uint8_t>, TilesError>
-    createGlbContent(const core::Mesh& mesh) const;
+    createGlbContent(const core::Mesh& mesh, const geo::Vec3d& rtcCenter) const;
     
-    // 创建 B3DM 文件
+    // 创建 B3DM 文件（要素表带 RTC_CENTER）
     std::expected<std::vector<uint8_t>, TilesError>
-    createB3dmFile(const std::vector<uint8_t>& glbContent) const;
+    createB3dmFile(const std::vector<uint8_t>& glbContent, const geo::Vec3d& rtcCenter) const;
     
     // 应用 Draco 压缩
     std::expected<std::vector<uint8_t>, TilesError>
     applyDracoCompression(const std::vector<uint8_t>& glbContent) const;
     
+    // 写出 tileset.json
+    std::expected<void, TilesError>
+    writeTilesetJson(const nlohmann::json& tileset, const std::filesystem::path& outputFile) const;
+    
+    // 写出单个网格的瓦片文件：以网格包围盒中心（双精度）作为瓦片的 RTC 中心
+    std::expected<void, TilesError>
+    writeTileContent(const core::Mesh& mesh, const std::filesystem::path& outputFile) const;
+    
     // 创建目录结构
-    void createDirectoryStructure(const std::filesystem::path& baseDir, const core::LodNode& root) const;
+    void createDirectoryStructure(const std::filesystem::path& baseDir) const;
 };
 
 // 工厂函数
@@ -140,6 +174,9 @@ meshToGlb(const core::Mesh& mesh, bool enableDraco = false);
 [[nodiscard]] std::expected<std::vector<uint8_t>, TilesError>
 glbToB3dm(const std::vector<uint8_t>& glbData);
 
+// 辅助函数：瓦片的 RTC 中心（网格位置包围盒中心，双精度）
+[[nodiscard]] geo::Vec3d computeRtcCenter(const core::Mesh& mesh) noexcept;
+
 // 辅助函数：坐标转换（WGS84 -> Cartesian）
 [[nodiscard]] std::array<double, 3> 
 wgs84ToCartesian(double longitude, double latitude, double altitude = 0.0) noexcept;
@@ -2,6 +2,10 @@
 #include <chrono>
 #include <spdlog/spdlog.h>
 #include <execution>
+#include <map>
+#include <mutex>
+#include <numeric>
+#include <tbb/task_arena.h>
 
 namespace lod::pipeline {
 
@@ -78,6 +82,145 @@ buildLodHierarchy(const core::Mesh& mesh,
     }
 }
 
+std::expected<core::LodNode, PipelineError>
+buildLodHierarchy(const core::Mesh& mesh,
+                  const core::OctreeNode& octree,
+                  const core::LodConfig& config,
+                  const ProgressCallback& progress) {
+    try {
+        if (progress) {
+            progress(0.6, "开始构建LOD层次结构...");
+        }
+        
+        auto root = core::buildGeometricLodHierarchy(mesh, octree, config);
+        if (!root) {
+            return std::unexpected(PipelineError::ProcessingError);
+        }
+        
+        if (progress) {
+            progress(0.8, "LOD层次结构构建完成");
+        }
+        
+        return core::LodNode{std::move(*root)};
+    } catch (const std::exception&) {
+        return std::unexpected(PipelineError::ProcessingError);
+    }
+}
+
+std::expected<core::LodNode, PipelineError>
+buildLodHierarchy(const core::OctreeIndex& index,
+                  const core::SourceMeshResolver& resolver,
+                  const core::ILodNodeStore* store,
+                  const core::LodConfig& config,
+                  const ProgressCallback& progress) {
+    try {
+        if (progress) {
+            progress(0.6, "开始构建LOD层次结构...");
+        }
+        
+        auto root = core::buildBottomUpLodHierarchy(index, resolver, store, config);
+        if (!root) {
+            return std::unexpected(PipelineError::ProcessingError);
+        }
+        
+        if (progress) {
+            progress(0.8, "LOD层次结构构建完成");
+        }
+        
+        return core::LodNode{std::move(*root)};
+    } catch (const std::exception&) {
+        return std::unexpected(PipelineError::ProcessingError);
+    }
+}
+
+std::expected<OctreeIndexUpdate, PipelineError>
+updateOctreeIndex(const std::filesystem::path& indexPath,
+                  const std::vector<std::filesystem::path>& files,
+                  const core::SourceMeshResolver& resolver,
+                  const core::OctreeConfig& octreeConfig) {
+    OctreeIndexUpdate update;
+    update.sources.reserve(files.size());
+    for (const auto& file : files) {
+        auto record = io::makeOctreeSourceRecord(file);
+        if (!record) {
+            return std::unexpected(PipelineError::InputError);
+        }
+        update.sources.push_back(std::move(*record));
+    }
+    
+    const auto resolve = [&](core::SourceId id) -> const core::Mesh* {
+        return id < files.size() ? resolver(id) : nullptr;
+    };
+    
+    // 持久化的配置与当前一致时才能增量更新
+    auto persisted = io::loadOctreeIndex(indexPath);
+    const auto sameConfig = [&](const core::OctreeConfig& stored) {
+        return stored.maxTrianglesPerNode == octreeConfig.maxTrianglesPerNode &&
+               stored.maxDepth == octreeConfig.maxDepth &&
+               stored.looseOctree == octreeConfig.looseOctree &&
+               stored.looseness == octreeConfig.looseness;
+    };
+    
+    if (persisted && !persisted->index.empty() && sameConfig(persisted->index.config())) {
+        update.index = std::move(persisted->index);
+        update.changedSources = io::findChangedSources(persisted->sources, files);
+        
+        for (const auto sourceId : update.changedSources) {
+            const core::Mesh* mesh = resolve(sourceId);
+            if (mesh) {
+                update.index.replaceSource(sourceId, *mesh);
+            } else if (sourceId < files.size()) {
+                return std::unexpected(PipelineError::InputError);
+            } else {
+                update.index.removeSource(sourceId);
+            }
+        }
+        update.index.refitDirtyBounds(resolve);
+        
+        // 增量插入不会重新细分：过满的叶节点超过八分之一时全量重建
+        size_t leafCount = 0;
+        for (const auto& [key, node] : update.index.nodes()) {
+            leafCount += update.index.isLeaf(key) ? 1 : 0;
+        }
+        update.rebuilt = update.index.empty() || update.index.overfullLeafCount() * 8 > leafCount;
+    } else {
+        update.rebuilt = true;
+    }
+    
+    if (update.rebuilt) {
+        std::vector<core::Mesh> meshes;
+        meshes.reserve(files.size());
+        for (core::SourceId id = 0; id < files.size(); ++id) {
+            const core::Mesh* mesh = resolve(id);
+            if (!mesh) {
+                return std::unexpected(PipelineError::InputError);
+            }
+            meshes.push_back(*mesh);
+        }
+        update.index = core::OctreeIndex::build(meshes, octreeConfig);
+        update.index.markAllDirty();
+        update.changedSources.resize(files.size());
+        std::iota(update.changedSources.begin(), update.changedSources.end(), core::SourceId{0});
+    }
+    update.dirtyNodeCount = update.index.dirtyKeys().size();
+    
+    // 脏标记随索引写回：构建失败时下次运行仍会重新构建这些节点
+    if (!io::saveOctreeIndex({update.index, update.sources}, indexPath)) {
+        return std::unexpected(PipelineError::OutputError);
+    }
+    
+    return update;
+}
+
+std::expected<void, PipelineError>
+commitOctreeIndex(const std::filesystem::path& indexPath, OctreeIndexUpdate& update) {
+    update.index.clearDirty();
+    if (!io::saveOctreeIndex({update.index, update.sources}, indexPath)) {
+        return std::unexpected(PipelineError::OutputError);
+    }
+    return {};
+}
+
 std::expected<std::vector<std::filesystem::path>, PipelineError>
 exportResults(const core::LodNode& lodRoot,
               const std::vector<std::string>& formats,
@@ -127,6 +270,43 @@ exportResults(const core::LodNode& lodRoot,
 
 } // namespace components
 
+namespace {
+    // 日志中的节点范围
+    std::string describeBounds(const std::variant<geo::GeoBBox, core::BoundingBox>& bounds) {
+        return std::visit([](const auto& b) -> std::string {
+            using T = std::decay_t<decltype(b)>;
+            if constexpr (std::is_same_v<T, geo::GeoBBox>) {
+                return "[" + std::to_string(b.minLon) + ", " + std::to_string(b.minLat) + " - " +
+                       std::to_string(b.maxLon) + ", " + std::to_string(b.maxLat) + "]";
+            } else {
+                return "[" + std::to_string(b.min[0]) + ", " + std::to_string(b.min[1]) + ", " + std::to_string(b.min[2]) +
+                       " - " + std::to_string(b.max[0]) + ", " + std::to_string(b.max[1]) + ", " +
+                       std::to_string(b.max[2]) + "]";
+            }
+        }, bounds);
+    }
+    
+    // 几何模式输入的文件列表；地理模式输入返回空
+    std::optional<std::vector<io::SimplePlyFileInfo>> geometricFileInfos(const io::InputConfig& inputConfig) {
+        return std::visit([](const auto& input) -> std::optional<std::vector<io::SimplePlyFileInfo>> {
+            using T = std::decay_t<decltype(input)>;
+            if constexpr (std::is_same_v<T, std::filesystem::path>) {
+                return std::vector<io::SimplePlyFileInfo>{{input, std::nullopt}};
+            } else if constexpr (std::is_same_v<T, std::vector<std::filesystem::path>>) {
+                std::vector<io::SimplePlyFileInfo> infos;
+                for (const auto& path : input) {
+                    infos.push_back({path, std::nullopt});
+                }
+                return infos;
+            } else if constexpr (std::is_same_v<T, std::vector<io::SimplePlyFileInfo>>) {
+                return input;
+            } else {
+                return std::nullopt;
+            }
+        }, inputConfig);
+    }
+} // namespace
+
 // LodPipeline 实现
 PipelineResult LodPipeline::execute() {
     return execute(nullptr, nullptr);
@@ -141,47 +321,65 @@ PipelineResult LodPipeline::execute(const ProgressCallback& progressCallback,
     try {
         log("info", "开始执行LOD生成管道", logCallback);
         
-        // 步骤1: 加载输入
-        updateProgress(0.1, "加载输入文件", progressCallback);
-        auto inputResult = loadInput();
-        if (!inputResult) {
-            result.errorMessage = "输入加载失败";
-            return result;
-        }
-        
-        auto [mesh, bounds] = inputResult.value();
-        result.lodMode = core::detectLodMode(bounds);
-        
-        // 步骤2: 预处理
-        updateProgress(0.3, "预处理网格", progressCallback);
-        auto preprocessResult = preprocessMesh(mesh, bounds);
-        if (!preprocessResult) {
-            result.errorMessage = "网格预处理失败";
-            return result;
+        // 几何模式的八叉树索引按源文件增量构建，加载与构建合为一步
+        const auto indexedFiles = config_.octreeIndexPath.empty() ? std::nullopt
+                                                                  : geometricFileInfos(config_.inputConfig);
+        if (!config_.octreeIndexPath.empty() && !indexedFiles) {
+            log("warn", "八叉树索引只适用于几何模式输入，按常规方式加载", logCallback);
         }
         
-        // 步骤3: 构建LOD
-        updateProgress(0.5, "构建LOD层次结构", progressCallback);
-        auto lodResult = buildLod(preprocessResult.value(), bounds);
-        if (!lodResult) {
-            result.errorMessage = "LOD构建失败";
-            return result;
+        std::variant<geo::GeoBBox, core::BoundingBox> bounds;
+        if (indexedFiles) {
+            updateProgress(0.1, "按八叉树索引增量构建LOD层次结构", progressCallback);
+            auto indexedResult = buildIndexedLod(*indexedFiles, logCallback);
+            if (!indexedResult) {
+                result.errorMessage = indexedResult.error() == PipelineError::InputError ? "输入加载失败"
+                                                                                        : "LOD构建失败";
+                return result;
+            }
+            result.lodHierarchy = std::move(indexedResult->first);
+            bounds = indexedResult->second;
+            result.lodMode = core::detectLodMode(bounds);
+        } else {
+            // 步骤1: 加载输入
+            updateProgress(0.1, "加载输入文件", progressCallback);
+            auto inputResult = loadInput();
+            if (!inputResult) {
+                result.errorMessage = "输入加载失败";
+                return result;
+            }
+            
+            auto [mesh, inputBounds] = inputResult.value();
+            bounds = inputBounds;
+            result.lodMode = core::detectLodMode(bounds);
+            
+            // 步骤2: 预处理
+            updateProgress(0.3, "预处理网格", progressCallback);
+            auto preprocessResult = preprocessMesh(mesh, bounds);
+            if (!preprocessResult) {
+                result.errorMessage = "网格预处理失败";
+                return result;
+            }
+            
+            // 步骤3: 构建LOD
+            updateProgress(0.5, "构建LOD层次结构", progressCallback);
+            auto lodResult = buildLod(preprocessResult.value(), bounds, logCallback);
+            if (!lodResult) {
+                result.errorMessage = "LOD构建失败";
+                return result;
+            }
+            
+            result.lodHierarchy = lodResult.value();
         }
         
-        result.lodHierarchy = lodResult.value();
-        
         // 计算统计信息
-        result.stats = std::visit([](const auto& node) -> core::LodStats {
-            if constexpr (std::is_same_v<std::decay_t<decltype(node)>, std::shared_ptr<core::GeoLodNode>>) {
-                return core::computeGeoLodStats(*node);
-            } else {
-                return core::computeGeometricLodStats(*node);
-            }
-        }, result.lodHierarchy);
+        result.stats = core::computeLodStats(result.lodHierarchy);
         
         // 步骤4: 导出结果
         updateProgress(0.8, "导出结果", progressCallback);
-        auto exportResult = exportResults(result.lodHierarchy);
+        const auto* dataBounds = std::get_if<geo::GeoBBox>(&bounds);
+        auto exportResult = exportResults(result.lodHierarchy,
+                                          dataBounds ? std::optional(*dataBounds) : std::nullopt);
         if (!exportResult) {
             result.errorMessage = "结果导出失败";
             return result;
@@ -212,20 +410,175 @@ LodPipeline::loadInput() {
     return components::loadInput(config_.inputConfig);
 }
 
+std::expected<std::pair<core::LodNode, core::BoundingBox>, PipelineError>
+LodPipeline::buildIndexedLod(const std::vector<io::SimplePlyFileInfo>& fileInfos, const LogCallback& logCallback) {
+    std::vector<std::filesystem::path> files;
+    files.reserve(fileInfos.size());
+    for (const auto& info : fileInfos) {
+        files.push_back(info.filePath);
+    }
+    
+    // 源文件按需逐个读取并保留到构建结束；索引更新与构建前的规划都是串行调用，无需加锁
+    const io::GeometricPlyReader reader{fileInfos};
+    std::map<core::SourceId, std::optional<core::Mesh>> loaded;
+    bool readFailed = false;
+    const core::SourceMeshResolver resolver = [&](core::SourceId id) -> const core::Mesh* {
+        if (id >= files.size()) {
+            return nullptr;
+        }
+        auto [it, inserted] = loaded.try_emplace(id);
+        if (inserted) {
+            if (auto mesh = reader.readPly(files[id])) {
+                it->second = std::move(*mesh);
+            } else {
+                readFailed = true;
+            }
+        }
+        return it->second ? &*it->second : nullptr;
+    };
+    
+    auto update = components::updateOctreeIndex(config_.octreeIndexPath, files, resolver,
+                                                 config_.lodConfig.octreeConfig);
+    if (!update) {
+        return std::unexpected(update.error());
+    }
+    log("info", update->rebuilt
+        ? "八叉树索引全量构建：" + std::to_string(files.size()) + " 个源文件，" +
+              std::to_string(update->index.nodes().size()) + " 个节点"
+        : "八叉树索引增量更新：" + std::to_string(update->changedSources.size()) + " 个源文件变更，" +
+              std::to_string(update->dirtyNodeCount) + " / " + std::to_string(update->index.nodes().size()) +
+              " 个节点需要重新构建", logCallback);
+    
+    const auto* indexRoot = update->index.find(core::kRootOctreeKey);
+    if (!indexRoot) {
+        return std::unexpected(PipelineError::InputError);
+    }
+    const core::BoundingBox bounds = indexRoot->tightBounds;
+    
+    std::expected<core::LodNode, PipelineError> lod;
+    if (config_.lodConfig.bottomUpConstruction) {
+        // 节点结果与索引放在一起；全量重建时节点键全部失效
+        auto storeDirectory = config_.octreeIndexPath;
+        storeDirectory += ".nodes";
+        const io::LodNodeStore store(std::move(storeDirectory));
+        if (update->rebuilt) {
+            store.clear();
+        }
+        
+        lod = runLodBuild([&](const core::LodConfig& buildConfig) {
+            return components::buildLodHierarchy(update->index, resolver, &store, buildConfig);
+        }, logCallback);
+        log("info", "增量构建读取 " + std::to_string(loaded.size()) + " / " + std::to_string(files.size()) +
+            " 个源文件", logCallback);
+    } else {
+        // 只有自底向上构建的节点结果可以逐子树沿用，其他方式读取全部源文件，在恢复的八叉树上重新构建
+        if (!update->rebuilt) {
+            log("info", "沿用未变化子树的结果需要自底向上构建，本次读取全部源文件", logCallback);
+        }
+        std::vector<core::Mesh> meshes;
+        std::vector<size_t> triangleCounts;
+        meshes.reserve(files.size());
+        triangleCounts.reserve(files.size());
+        for (core::SourceId id = 0; id < files.size(); ++id) {
+            if (!resolver(id)) {
+                return std::unexpected(PipelineError::InputError);
+            }
+            meshes.push_back(std::move(*loaded[id]));
+            triangleCounts.push_back(meshes.back().triangleCount());
+        }
+        
+        const auto octree = update->index.toOctree(triangleCounts);
+        if (!octree) {
+            return std::unexpected(PipelineError::InputError);
+        }
+        lod = buildLod(core::Mesh::merge(meshes), bounds, logCallback, octree.get());
+    }
+    
+    if (readFailed) {
+        return std::unexpected(PipelineError::InputError);
+    }
+    if (!lod) {
+        return std::unexpected(lod.error());
+    }
+    if (auto committed = components::commitOctreeIndex(config_.octreeIndexPath, *update); !committed) {
+        return std::unexpected(committed.error());
+    }
+    return std::make_pair(std::move(*lod), bounds);
+}
+
 std::expected<core::Mesh, PipelineError> 
 LodPipeline::preprocessMesh(const core::Mesh& mesh, const std::variant<geo::GeoBBox, core::BoundingBox>& bounds) {
     return components::preprocessMesh(mesh, bounds);
 }
 
 std::expected<core::LodNode, PipelineError> 
-LodPipeline::buildLod(const core::Mesh& mesh, const std::variant<geo::GeoBBox, core::BoundingBox>& bounds) {
-    return components::buildLodHierarchy(mesh, bounds, config_.lodConfig);
+LodPipeline::buildLod(const core::Mesh& mesh, const std::variant<geo::GeoBBox, core::BoundingBox>& bounds,
+                      const LogCallback& logCallback, const core::OctreeNode* octree) const {
+    return runLodBuild([&](const core::LodConfig& buildConfig) {
+        // 由八叉树索引恢复的八叉树保持上次的节点划分
+        if (octree && std::holds_alternative<core::BoundingBox>(bounds)) {
+            return components::buildLodHierarchy(mesh, *octree, buildConfig);
+        }
+        return components::buildLodHierarchy(mesh, bounds, buildConfig);
+    }, logCallback);
+}
+
+std::expected<core::LodNode, PipelineError>
+LodPipeline::runLodBuild(const LodBuildStep& build, const LogCallback& logCallback) const {
+    // 在受限的任务竞技场中构建，LOD 构建内部的全部 TBB 任务都受 maxThreads 约束
+    const int concurrency = !config_.enableParallelProcessing ? 1
+        : config_.maxThreads > 0 ? static_cast<int>(config_.maxThreads)
+        : tbb::task_arena::automatic;
+    
+    // 走了 sloppy 回退路径的节点逐个记录警告；回调来自并行任务，串行化后再转发
+    const auto& lodConfig = config_.lodConfig;
+    std::mutex logMutex;
+    auto onSimplifyFallback = [&](const core::SimplifyFallbackEvent& event) {
+        if (lodConfig.onSimplifyFallback) {
+            lodConfig.onSimplifyFallback(event);
+        }
+        std::lock_guard lock(logMutex);
+        log("warn", "LOD 第 " + std::to_string(event.lodLevel) + " 层节点 " + describeBounds(event.bounds) +
+            " 简化回退到 sloppy：目标 " + std::to_string(event.targetTriangleCount) +
+            "，保拓扑 " + std::to_string(event.topologyTriangleCount) +
+            "，回退后 " + std::to_string(event.resultTriangleCount) + " 个三角形", logCallback);
+    };
+    
+    // 单次构建使用配置的副本（策略与简化后端共享），流水线的配置保持不变，同一流水线可以并发构建
+    auto buildConfig = lodConfig;
+    buildConfig.onSimplifyFallback = onSimplifyFallback;
+    
+    // 按需在简化后端外包一层磁盘缓存（内容寻址，参数不变的节点直接取回结果）
+    std::shared_ptr<io::SimplifyCache> cache;
+    if (!config_.simplifyCacheDirectory.empty()) {
+        std::shared_ptr<const core::ISimplifier> inner = lodConfig.simplifier;
+        if (!inner) {
+            inner = core::createSimplifier(core::SimplifierBackend::Meshopt);
+        }
+        cache = std::make_shared<io::SimplifyCache>(config_.simplifyCacheDirectory, config_.simplifyCacheMaxBytes);
+        buildConfig.simplifier = std::make_shared<io::CachingSimplifier>(std::move(inner), cache);
+    }
+    
+    tbb::task_arena arena(concurrency);
+    auto result = arena.execute([&] { return build(buildConfig); });
+    
+    if (cache) {
+        cache->trim();
+        const auto stats = cache->stats();
+        log("info", "简化缓存：命中 " + std::to_string(stats.hits) + "，未命中 " + std::to_string(stats.misses) +
+            "，写入 " + std::to_string(stats.stores) + "，淘汰 " + std::to_string(stats.evictions), logCallback);
+    }
+    return result;
 }
 
 std::expected<std::vector<std::filesystem::path>, PipelineError> 
-LodPipeline::exportResults(const core::LodNode& lodRoot) {
+LodPipeline::exportResults(const core::LodNode& lodRoot, const std::optional<geo::GeoBBox>& dataBounds) {
+    auto tilesConfig = config_.tilesConfig;
+    if (dataBounds) {
+        tilesConfig.dataBounds = dataBounds;
+    }
     return components::exportResults(lodRoot, config_.outputFormats, config_.outputDirectory,
-                                   config_.osgConfig, config_.tilesConfig);
+                                   config_.osgConfig, tilesConfig);
 }
 
 void LodPipeline::updateProgress(double progress, const std::string& message, 
@@ -4,6 +4,9 @@
 #include "../io/PlyReader.hpp"
 #include "../io/OsgExporter.hpp"
 #include "../io/TilesExporter.hpp"
+#include "../io/SimplifyCache.hpp"
+#include "../io/OctreeIndexIO.hpp"
+#include "../io/LodNodeStore.hpp"
 #include <functional>
 #include <expected>
 #include <memory>
@@ -39,6 +42,15 @@ struct PipelineConfig {
     bool enableLogging{true};
     std::string logLevel{"info"};  // trace, debug, info, warn, error
     
+    // 简化结果缓存（目录为空时不启用）
+    std::filesystem::path simplifyCacheDirectory;
+    std::uintmax_t simplifyCacheMaxBytes{std::uintmax_t{1} << 30};
+    
+    // 几何模式的持久化八叉树索引（路径为空时不启用）：只重新划分变更的源文件，其余节点的划分保持不变。
+    // 自底向上构建时节点结果另存于 <octreeIndexPath>.nodes 目录，未变化的子树直接沿用，只读取重新构建的节点引用的源文件；
+    // 沿用的结果假定 LOD 参数与上次相同，修改参数后应删除该目录
+    std::filesystem::path octreeIndexPath;
+    
     // 模式配置
     bool forceGeometricMode{false};  // 强制使用几何模式
     bool enableOctreeSubdivision{true};  // 启用八叉树细分
@@ -73,6 +85,28 @@ preprocessMesh(const core::Mesh& inputMesh,
                const std::variant<geo::GeoBBox, core::BoundingBox>& bounds,
                const ProgressCallback& progress = nullptr);
 
+// 八叉树索引更新结果
+struct OctreeIndexUpdate {
+    core::OctreeIndex index;
+    std::vector<core::SourceId> changedSources;  // 本次替换或删除的源文件
+    std::vector<io::OctreeSourceRecord> sources; // files 当前的大小与修改时间，提交时写回
+    size_t dirtyNodeCount{0};                    // 需要重新构建的节点数（含上次构建失败未提交的节点）
+    bool rebuilt{false};                         // 索引缺失、配置变化或增量结果过度失衡时全量重建
+};
+
+// 索引阶段：加载 indexPath 处的索引，只替换 files 中发生变化的源文件后写回（保留脏标记）。
+// resolver 以 files 中的下标取网格：增量更新时只请求变化的源文件与脏节点引用的源文件（重新计算包围盒），
+// 全量重建时请求全部源文件
+[[nodiscard]] std::expected<OctreeIndexUpdate, PipelineError>
+updateOctreeIndex(const std::filesystem::path& indexPath,
+                  const std::vector<std::filesystem::path>& files,
+                  const core::SourceMeshResolver& resolver,
+                  const core::OctreeConfig& octreeConfig);
+
+// 索引阶段：构建成功后清除脏标记并写回，下次运行只重新构建此后变化的子树
+[[nodiscard]] std::expected<void, PipelineError>
+commitOctreeIndex(const std::filesystem::path& indexPath, OctreeIndexUpdate& update);
+
 // 核心处理阶段：构建 LOD 层次结构（通用）
 [[nodiscard]] std::expected<core::LodNode, PipelineError>
 buildLodHierarchy(const core::Mesh& mesh, 
@@ -80,6 +114,21 @@ buildLodHierarchy(const core::Mesh& mesh,
                   const core::LodConfig& config,
                   const ProgressCallback& progress = nullptr);
 
+// 核心处理阶段：在已有八叉树上构建几何 LOD 层次结构
+[[nodiscard]] std::expected<core::LodNode, PipelineError>
+buildLodHierarchy(const core::Mesh& mesh,
+                  const core::OctreeNode& octree,
+                  const core::LodConfig& config,
+                  const ProgressCallback& progress = nullptr);
+
+// 核心处理阶段：在八叉树索引上自底向上增量构建几何 LOD 层次结构
+[[nodiscard]] std::expected<core::LodNode, PipelineError>
+buildLodHierarchy(const core::OctreeIndex& index,
+                  const core::SourceMeshResolver& resolver,
+                  const core::ILodNodeStore* store,
+                  const core::LodConfig& config,
+                  const ProgressCallback& progress = nullptr);
+
 // 输出阶段：导出到各种格式（通用）
 [[nodiscard]] std::expected<std::vector<std::filesystem::path>, PipelineError>
 exportResults(const core::LodNode& lodRoot,
@@ -106,9 +155,17 @@ public:
     
     // 分步执行
     [[nodiscard]] std::expected<std::pair<core::Mesh, std::variant<geo::GeoBBox, core::BoundingBox>>, PipelineError> loadInput();
+    // 按八叉树索引增量构建（几何模式）：自底向上构建时只读取重新构建的节点引用的源文件，其余子树沿用上次的节点结果；
+    // 其他构建方式读取全部源文件，在索引恢复的八叉树上重新构建。构建成功后提交索引
+    [[nodiscard]] std::expected<std::pair<core::LodNode, core::BoundingBox>, PipelineError>
+    buildIndexedLod(const std::vector<io::SimplePlyFileInfo>& fileInfos, const LogCallback& logCallback = nullptr);
     [[nodiscard]] std::expected<core::Mesh, PipelineError> preprocessMesh(const core::Mesh& mesh, const std::variant<geo::GeoBBox, core::BoundingBox>& bounds);
-    [[nodiscard]] std::expected<core::LodNode, PipelineError> buildLod(const core::Mesh& mesh, const std::variant<geo::GeoBBox, core::BoundingBox>& bounds);
-    [[nodiscard]] std::expected<std::vector<std::filesystem::path>, PipelineError> exportResults(const core::LodNode& lodRoot);
+    [[nodiscard]] std::expected<core::LodNode, PipelineError> buildLod(const core::Mesh& mesh, const std::variant<geo::GeoBBox, core::BoundingBox>& bounds,
+                                                                       const LogCallback& logCallback = nullptr,
+                                                                       const core::OctreeNode* octree = nullptr) const;
+    // dataBounds 为地理输入的数据范围（顶点所在 ENU 坐标系的原点区域），覆盖 tilesConfig 中的同名字段
+    [[nodiscard]] std::expected<std::vector<std::filesystem::path>, PipelineError>
+    exportResults(const core::LodNode& lodRoot, const std::optional<geo::GeoBBox>& dataBounds = std::nullopt);
     
     // 配置访问
     const PipelineConfig& config() const noexcept { return config_; }
@@ -122,6 +179,9 @@ private:
     mutable double currentProgress_{0.0};
     
     // 辅助方法
+    using LodBuildStep = std::function<std::expected<core::LodNode, PipelineError>(const core::LodConfig&)>;
+    [[nodiscard]] std::expected<core::LodNode, PipelineError> runLodBuild(const LodBuildStep& build,
+                                                                          const LogCallback& logCallback) const;
     void updateProgress(double progress, const std::string& message, 
                        const ProgressCallback& callback) const;
     void log(const std::string& level, const std::string& message,
@@ -170,6 +230,7 @@ public:
     
     PipelineBuilder& withParallelProcessing(bool enable, size_t maxThreads = 0) {
         config_.enableParallelProcessing = enable;
+        config_.lodConfig.enableParallelProcessing = enable;
         config_.maxThreads = maxThreads;
         return *this;
     }
@@ -0,0 +1,43 @@
+#pragma once
+
+#include "../src/core/Mesh.hpp"
+#include <vector>
+
+namespace lod::test {
+
+// 规则网格的可选参数
+struct GridOptions {
+    float relief{0.0f};      // 非零时顶点带起伏（八叉树需要非退化包围盒）
+    float height{0.0f};      // 网格所在平面的高度
+    float offsetX{0.0f};     // 沿 x 方向平移
+    bool normals{false};     // 生成 +Z 法线
+    bool texCoords{false};   // 生成覆盖 [0,1]² 的纹理坐标
+};
+
+// n x n 个格子的网格，位于 [0,n]² 上，每个格子两个三角形
+inline core::Mesh makeGrid(int n, const GridOptions& options = {}) {
+    core::VertexAttributes vertices;
+    std::vector<core::Index> indices;
+    for (int y = 0; y <= n; ++y) {
+        for (int x = 0; x <= n; ++x) {
+            const float z = options.height + options.relief * static_cast<float>((x * 7 + y * 3) % 5);
+            vertices.positions.push_back({static_cast<float>(x) + options.offsetX, static_cast<float>(y), z});
+            if (options.normals) {
+                vertices.normals.push_back({0.0f, 0.0f, 1.0f});
+            }
+            if (options.texCoords) {
+                vertices.texCoords.push_back({static_cast<float>(x) / n, static_cast<float>(y) / n});
+            }
+        }
+    }
+    const auto at = [n](int x, int y) { return static_cast<core::Index>(y * (n + 1) + x); };
+    for (int y = 0; y < n; ++y) {
+        for (int x = 0; x < n; ++x) {
+            indices.insert(indices.end(), {at(x, y), at(x + 1, y), at(x + 1, y + 1)});
+            indices.insert(indices.end(), {at(x, y), at(x + 1, y + 1), at(x, y + 1)});
+        }
+    }
+    return core::Mesh{std::move(vertices), std::move(indices)};
+}
+
+} // namespace lod::test
@@ -0,0 +1,139 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+#include "../src/geo/CRS.hpp"
+#include <algorithm>
+#include <string>
+#include <vector>
+
+using namespace lod::geo;
+
+TEST_CASE("Coordinate transformer", "[crs]") {
+    SECTION("Identical CRS is a no-op") {
+        const CoordinateTransformer identity(crs::WGS84(), crs::WGS84());
+        const auto point = identity.transform(GeoPoint{116.4, 39.9, 50.0});
+        REQUIRE(point);
+        REQUIRE(point->longitude == 116.4);
+        REQUIRE(point->latitude == 39.9);
+    }
+    
+    SECTION("Geographic to geocentric") {
+        const CoordinateTransformer toEcef(crs::WGS84(), crs::ECEF());
+        
+        const auto equator = toEcef.transform(GeoPoint{0.0, 0.0, 0.0});
+        REQUIRE(equator);
+        REQUIRE(equator->longitude == Catch::Approx(6378137.0).margin(1e-6));
+        REQUIRE(equator->latitude == Catch::Approx(0.0).margin(1e-6));
+        REQUIRE(equator->altitude == Catch::Approx(0.0).margin(1e-6));
+        
+        const auto pole = toEcef.transform(GeoPoint{0.0, 90.0, 0.0});
+        REQUIRE(pole);
+        REQUIRE(pole->altitude == Catch::Approx(6356752.314245).margin(1e-4));
+    }
+    
+    SECTION("UTM central meridian maps to the zone longitude") {
+        const CoordinateTransformer fromUtm(crs::UTM_Zone_50N(), crs::WGS84());
+        const auto point = fromUtm.transform(GeoPoint{500000.0, 0.0, 0.0});
+        REQUIRE(point);
+        REQUIRE(point->longitude == Catch::Approx(117.0).margin(1e-9));
+        REQUIRE(point->latitude == Catch::Approx(0.0).margin(1e-9));
+    }
+    
+    SECTION("Batch transform matches single points and round-trips") {
+        std::vector<GeoPoint> points;
+        for (int i = 0; i < 50000; ++i) {
+            points.push_back({400000.0 + (i % 250) * 100.0, 4400000.0 + (i / 250) * 100.0, 10.0});
+        }
+        
+        const CoordinateTransformer fromUtm(crs::UTM_Zone_50N(), crs::WGS84());
+        auto geographic = points;
+        REQUIRE(fromUtm.transformInPlace(geographic));
+        
+        const auto single = fromUtm.transform(points[12345]);
+        REQUIRE(single);
+        REQUIRE(geographic[12345].longitude == Catch::Approx(single->longitude).epsilon(1e-12));
+        REQUIRE(geographic[12345].latitude == Catch::Approx(single->latitude).epsilon(1e-12));
+        
+        const CoordinateTransformer toUtm(crs::WGS84(), crs::UTM_Zone_50N());
+        REQUIRE(toUtm.transformInPlace(geographic));
+        for (size_t i = 0; i < points.size(); i += 997) {
+            REQUIRE(geographic[i].longitude == Catch::Approx(points[i].longitude).margin(1e-6));
+            REQUIRE(geographic[i].latitude == Catch::Approx(points[i].latitude).margin(1e-6));
+        }
+    }
+    
+    SECTION("Structure-of-arrays transform") {
+        std::vector<double> x{0.0, 90.0};
+        std::vector<double> y{0.0, 0.0};
+        std::vector<double> z{0.0, 100.0};
+        const CoordinateTransformer toEcef(crs::WGS84(), crs::ECEF());
+        REQUIRE(toEcef.transformInPlace(x, y, z));
+        REQUIRE(x[0] == Catch::Approx(6378137.0).margin(1e-6));
+        REQUIRE(y[1] == Catch::Approx(6378237.0).margin(1e-6));
+    }
+    
+    SECTION("Unknown CRS is reported") {
+        const CoordinateTransformer invalid(CRS{"EPSG:999999"}, crs::WGS84());
+        std::vector<GeoPoint> points{{0.0, 0.0, 0.0}};
+        const auto result = invalid.transformInPlace(points);
+        REQUIRE(!result);
+        REQUIRE(result.error() == TransformError::InvalidCRS);
+        REQUIRE(!invalid.transform(points.front()));
+    }
+}
+
+TEST_CASE("CRS registry", "[crs]") {
+    auto& registry = CRSRegistry::instance();
+    
+    SECTION("Spellings of one code share a single entry") {
+        const auto* upper = registry.resolve("EPSG:4326");
+        REQUIRE(upper);
+        REQUIRE(registry.resolve("epsg:4326") == upper);
+        REQUIRE(CRS{"epsg:4326"} == crs::WGS84());
+        REQUIRE(crs::WGS84().info() == upper);
+    }
+    
+    SECTION("Metadata comes from the database") {
+        const auto* wgs84 = registry.resolve("EPSG:4326");
+        REQUIRE(wgs84->isGeographic());
+        REQUIRE(wgs84->unit == "degree");
+        REQUIRE(wgs84->axisOrder == AxisOrder::NorthEast);
+        
+        const auto* utm = registry.resolve("EPSG:32650");
+        REQUIRE(utm);
+        REQUIRE(utm->type == CRSType::Projected);
+        REQUIRE(utm->unit == "metre");
+        REQUIRE(utm->axisOrder == AxisOrder::EastNorth);
+        REQUIRE(utm->areaOfUse);
+        REQUIRE(utm->areaOfUse->minLon == Catch::Approx(114.0));
+        REQUIRE(utm->areaOfUse->maxLon == Catch::Approx(120.0));
+        
+        REQUIRE(CRS{"EPSG:32650"}.isProjected());
+        REQUIRE(crs::ECEF().getUnit() == "metre");
+    }
+    
+    SECTION("Unknown codes are remembered as invalid") {
+        REQUIRE(!registry.resolve("EPSG:999999"));
+        REQUIRE(!isValidCRS("EPSG:999999"));
+        REQUIRE(!createCRS("not a crs"));
+        REQUIRE(!CRS{"EPSG:999999"}.isValid());
+    }
+    
+    SECTION("Concurrent preload resolves each code once") {
+        std::vector<std::string> codes;
+        for (int zone = 32601; zone <= 32660; ++zone) {
+            codes.push_back("EPSG:" + std::to_string(zone));
+            codes.push_back("epsg:" + std::to_string(zone));
+        }
+        registry.preload(codes);
+        for (int zone = 32601; zone <= 32660; ++zone) {
+            const auto* info = registry.resolve("EPSG:" + std::to_string(zone));
+            REQUIRE(info);
+            REQUIRE(registry.resolve("epsg:" + std::to_string(zone)) == info);
+        }
+    }
+    
+    SECTION("Supported codes are listed from the database") {
+        const auto codes = getSupportedCRS();
+        REQUIRE(std::find(codes.begin(), codes.end(), "EPSG:4326") != codes.end());
+    }
+}
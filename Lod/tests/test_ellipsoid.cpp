@@ -0,0 +1,110 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+#include "../src/geo/Ellipsoid.hpp"
+#include <chrono>
+#include <cmath>
+#include <random>
+
+using namespace lod::geo;
+
+namespace {
+
+// 覆盖全球、从海沟到近地轨道高度的随机点
+std::vector<GeoPoint> randomPoints(size_t count) {
+    std::mt19937_64 random{42};
+    std::uniform_real_distribution<double> lon(-180.0, 180.0);
+    std::uniform_real_distribution<double> lat(-90.0, 90.0);
+    std::uniform_real_distribution<double> height(-11000.0, 400000.0);
+    
+    std::vector<GeoPoint> points(count);
+    for (auto& point : points) {
+        point = {lon(random), lat(random), height(random)};
+    }
+    return points;
+}
+
+} // namespace
+
+TEST_CASE("Geodetic and ECEF reference values", "[ellipsoid]") {
+    SECTION("Equator, poles and axes") {
+        const auto origin = geodeticToEcef({0.0, 0.0, 0.0});
+        REQUIRE(origin[0] == Catch::Approx(wgs84::kSemiMajorAxis));
+        
+        const auto north = geodeticToEcef({0.0, 90.0, 0.0});
+        REQUIRE(north[2] == Catch::Approx(6356752.314245));
+        
+        const auto fromPole = ecefToGeodetic({0.0, 0.0, -wgs84::kSemiMinorAxis - 10.0});
+        REQUIRE(fromPole.latitude == Catch::Approx(-90.0));
+        REQUIRE(fromPole.altitude == Catch::Approx(10.0).margin(1e-6));
+        
+        const auto fromAxis = ecefToGeodetic({0.0, -wgs84::kSemiMajorAxis - 100.0, 0.0});
+        REQUIRE(fromAxis.longitude == Catch::Approx(-90.0));
+        REQUIRE(fromAxis.latitude == Catch::Approx(0.0).margin(1e-12));
+        REQUIRE(fromAxis.altitude == Catch::Approx(100.0).margin(1e-6));
+    }
+    
+    SECTION("Latitude 45 degrees matches the closed form") {
+        // φ = 45° 时 N = a / sqrt(1 - e²/2)，X = Z / (1 - e²) 在 h = 0 处成立
+        const auto ecef = geodeticToEcef({0.0, 45.0, 0.0});
+        const double n = wgs84::kSemiMajorAxis / std::sqrt(1.0 - wgs84::kEccentricitySquared / 2.0);
+        REQUIRE(ecef[0] == Catch::Approx(n * std::sqrt(0.5)).epsilon(1e-15));
+        REQUIRE(ecef[2] == Catch::Approx(n * (1.0 - wgs84::kEccentricitySquared) * std::sqrt(0.5)).epsilon(1e-15));
+    }
+}
+
+TEST_CASE("Geodetic and ECEF round trip", "[ellipsoid]") {
+    const auto points = randomPoints(20000);
+    std::vector<double> lon, lat, height;
+    for (const auto& point : points) {
+        lon.push_back(point.longitude);
+        lat.push_back(point.latitude);
+        height.push_back(point.altitude);
+    }
+    
+    std::vector<double> x(points.size()), y(points.size()), z(points.size());
+    geodeticToEcef(lon, lat, height, x, y, z);
+    
+    SECTION("Batch matches scalar") {
+        for (size_t i = 0; i < points.size(); i += 101) {
+            const auto ecef = geodeticToEcef(points[i]);
+            REQUIRE(x[i] == ecef[0]);
+            REQUIRE(y[i] == ecef[1]);
+            REQUIRE(z[i] == ecef[2]);
+        }
+    }
+    
+    SECTION("Inverse recovers the input in place") {
+        ecefToGeodetic(x, y, z, x, y, z);
+        for (size_t i = 0; i < points.size(); ++i) {
+            // 极点附近经度无定义，只比较纬度与高度
+            if (std::abs(lat[i]) < 89.999) {
+                REQUIRE(x[i] == Catch::Approx(lon[i]).margin(1e-9));
+            }
+            REQUIRE(y[i] == Catch::Approx(lat[i]).margin(1e-9));
+            REQUIRE(z[i] == Catch::Approx(height[i]).margin(1e-6));
+        }
+    }
+}
+
+TEST_CASE("Geodetic and ECEF throughput", "[.][benchmark][ellipsoid]") {
+    constexpr size_t kCount = size_t{1} << 22;
+    const auto points = randomPoints(kCount);
+    std::vector<double> lon(kCount), lat(kCount), height(kCount), x(kCount), y(kCount), z(kCount);
+    for (size_t i = 0; i < kCount; ++i) {
+        lon[i] = points[i].longitude;
+        lat[i] = points[i].latitude;
+        height[i] = points[i].altitude;
+    }
+    
+    const auto pointsPerSecond = [](auto&& run) {
+        const auto start = std::chrono::steady_clock::now();
+        run();
+        const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        return static_cast<double>(kCount) / elapsed.count();
+    };
+    
+    const double forward = pointsPerSecond([&] { geodeticToEcef(lon, lat, height, x, y, z); });
+    const double inverse = pointsPerSecond([&] { ecefToGeodetic(x, y, z, lon, lat, height); });
+    WARN("geodeticToEcef: " << forward / 1e6 << " M points/s, ecefToGeodetic: " << inverse / 1e6 << " M points/s");
+    REQUIRE(forward > 0.0);
+}
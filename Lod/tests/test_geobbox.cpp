@@ -142,6 +142,25 @@ TEST_CASE("GeoBBox utility functions", "[geobbox]") {
         REQUIRE(bounds->minLat == Catch::Approx(30.0));
         REQUIRE(bounds->maxLon == Catch::Approx(120.0));
         REQUIRE(bounds->maxLat == Catch::Approx(50.0));
+        REQUIRE(bounds->minHeight == Catch::Approx(0.0));
+        REQUIRE(bounds->maxHeight == Catch::Approx(200.0));
+    }
+    
+    SECTION("Height range follows unite, intersection and subdivision") {
+        const GeoBBox low(100.0, 30.0, 110.0, 40.0, -20.0, 80.0);
+        const GeoBBox high(105.0, 35.0, 115.0, 45.0, 50.0, 300.0);
+        
+        REQUIRE(low.unite(high).minHeight == -20.0);
+        REQUIRE(low.unite(high).maxHeight == 300.0);
+        REQUIRE(low.intersection(high).minHeight == 50.0);
+        REQUIRE(low.intersection(high).maxHeight == 80.0);
+        
+        for (const auto& child : low.subdivide()) {
+            REQUIRE(child.minHeight == -20.0);
+            REQUIRE(child.maxHeight == 80.0);
+        }
+        REQUIRE(low.withHeights(1.0, 2.0).maxHeight == 2.0);
+        REQUIRE(low.withHeights(1.0, 2.0).maxLon == 110.0);
     }
     
     SECTION("Empty points") {
@@ -154,15 +173,36 @@ TEST_CASE("GeoBBox utility functions", "[geobbox]") {
         GeoPoint p1(0.0, 0.0);
         GeoPoint p2(1.0, 0.0);
         
-        auto distance = distanceMeters(p1, p2);
-        REQUIRE(distance > 110000.0);  // 大约111公里
-        REQUIRE(distance < 112000.0);
+        // 赤道上 1° 经度弧长 = a · π / 180
+        REQUIRE(distanceMeters(p1, p2) == Catch::Approx(111319.490793).margin(1e-3));
+        
+        // 1° 子午线弧长在赤道附近约 110.574 km，在极点附近约 111.694 km
+        REQUIRE(distanceMeters({0.0, 0.0}, {0.0, 1.0}) == Catch::Approx(110574.3).margin(1.0));
+        REQUIRE(distanceMeters({0.0, 89.0}, {0.0, 90.0}) == Catch::Approx(111693.9).margin(1.0));
     }
     
     SECTION("Area calculation") {
         GeoBBox bbox(0.0, 0.0, 1.0, 1.0);  // 1度x1度
-        auto area = areaSquareMeters(bbox);
-        REQUIRE(area > 0.0);
-        REQUIRE(area < 20000000000.0);  // 合理的面积范围
+        REQUIRE(areaSquareMeters(bbox) == Catch::Approx(12308463894.0).epsilon(1e-9));
+        
+        // 整个椭球面积
+        REQUIRE(areaSquareMeters({-180.0, -90.0, 180.0, 90.0}) == Catch::Approx(510065621724088.0).epsilon(1e-9));
+        REQUIRE(areaSquareMeters({0.0, 0.0, 0.0, 1.0}) == 0.0);
     }
-} 
\ No newline at end of file
+    
+    SECTION("Metric extents") {
+        REQUIRE(metersPerDegreeLon(0.0) == Catch::Approx(111319.490793).epsilon(1e-9));
+        REQUIRE(metersPerDegreeLon(60.0) == Catch::Approx(55799.98).margin(0.1));
+        REQUIRE(metersPerDegreeLon(90.0) == 0.0);
+        REQUIRE(metersPerDegreeLat(0.0) == Catch::Approx(110574.27).margin(0.1));
+        
+        // 宽度取最长的纬线：跨赤道时为赤道，全在北半球时为南边界
+        REQUIRE(widthMeters({10.0, -1.0, 11.0, 1.0}) == Catch::Approx(111319.490793).epsilon(1e-9));
+        REQUIRE(widthMeters({10.0, 60.0, 11.0, 61.0}) == Catch::Approx(metersPerDegreeLon(60.0)));
+        
+        // 高度为子午线弧长，与测地线距离一致
+        const GeoBBox band{10.0, 30.0, 10.5, 47.3};
+        REQUIRE(heightMeters(band) == Catch::Approx(distanceMeters({10.0, 30.0}, {10.0, 47.3})).margin(0.05));
+        REQUIRE(heightMeters({0.0, -90.0, 1.0, 90.0}) == Catch::Approx(20003931.46).margin(0.01));
+    }
+}
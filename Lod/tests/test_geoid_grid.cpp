@@ -0,0 +1,156 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+#include "../src/geo/GeoidGrid.hpp"
+#include "../src/geo/CRS.hpp"
+#include <bit>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <vector>
+
+using namespace lod::geo;
+
+namespace {
+
+template<typename T>
+void writeBigEndian(std::ofstream& out, T value) {
+    using Bits = std::conditional_t<sizeof(T) == 8, std::uint64_t, std::uint32_t>;
+    auto bits = std::bit_cast<Bits>(value);
+    if constexpr (std::endian::native == std::endian::little) {
+        bits = std::byteswap(bits);
+    }
+    out.write(reinterpret_cast<const char*>(&bits), sizeof(bits));
+}
+
+// 写出 GTX 格网：value(row, col) 给出自南向北第 row 行、自西向东第 col 列的起伏
+std::filesystem::path writeGtx(const std::string& name, double south, double west, double step,
+                               std::int32_t rows, std::int32_t columns,
+                               const std::function<float(int, int)>& value) {
+    const auto path = std::filesystem::temp_directory_path() / name;
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    writeBigEndian(out, south);
+    writeBigEndian(out, west);
+    writeBigEndian(out, step);
+    writeBigEndian(out, step);
+    writeBigEndian(out, rows);
+    writeBigEndian(out, columns);
+    for (int row = 0; row < rows; ++row) {
+        for (int col = 0; col < columns; ++col) {
+            writeBigEndian(out, value(row, col));
+        }
+    }
+    return path;
+}
+
+} // namespace
+
+TEST_CASE("Geoid grid", "[geoid]") {
+    // 1° 格网，起伏随经纬度线性变化，双线性插值应精确复现；
+    // 每个 SECTION 都会重新执行测试体，文件只写一次，避免截断已映射的文件
+    static const auto path = writeGtx("lod_geoid_linear.gtx", 30.0, 110.0, 1.0, 11, 11,
+                               [](int row, int col) { return static_cast<float>(10.0 + row + 2.0 * col); });
+    
+    SECTION("Bilinear samples inside the grid") {
+        const auto grid = GeoidGrid::open(path);
+        REQUIRE(grid);
+        REQUIRE((*grid)->undulation(110.0, 30.0) == Catch::Approx(10.0));
+        REQUIRE((*grid)->undulation(112.5, 33.25) == Catch::Approx(10.0 + 3.25 + 5.0));
+        REQUIRE((*grid)->undulation(120.0, 40.0) == Catch::Approx(40.0));
+        
+        const auto coverage = (*grid)->coverage();
+        REQUIRE(coverage.minLon == 110.0);
+        REQUIRE(coverage.maxLat == 40.0);
+    }
+    
+    SECTION("Points outside the grid have no undulation") {
+        const auto grid = GeoidGrid::open(path);
+        REQUIRE(grid);
+        REQUIRE(!(*grid)->undulation(109.9, 35.0));
+        REQUIRE(!(*grid)->undulation(115.0, 40.1));
+    }
+    
+    SECTION("A file is mapped once and shared") {
+        const auto first = GeoidGrid::open(path);
+        const auto second = GeoidGrid::open(path.parent_path() / "." / path.filename());
+        REQUIRE(first);
+        REQUIRE(second);
+        REQUIRE(first->get() == second->get());
+    }
+    
+    SECTION("Missing and malformed files are reported") {
+        REQUIRE(GeoidGrid::open("/nonexistent/geoid.gtx").error() == GeoidError::FileNotFound);
+        
+        const auto truncated = std::filesystem::temp_directory_path() / "lod_geoid_truncated.gtx";
+        std::ofstream(truncated, std::ios::binary) << "not a grid";
+        REQUIRE(GeoidGrid::open(truncated).error() == GeoidError::InvalidFormat);
+    }
+}
+
+TEST_CASE("Global geoid grid wraps in longitude", "[geoid]") {
+    // 30° 全球格网，一周恰好 12 列（无重复的 180° 列），无数据标记只出现在南极行
+    const auto path = writeGtx("lod_geoid_global.gtx", -90.0, -180.0, 30.0, 7, 12, [](int row, int col) {
+        return row == 0 ? -88.8888f : static_cast<float>(col);
+    });
+    const auto grid = GeoidGrid::open(path);
+    REQUIRE(grid);
+    
+    REQUIRE((*grid)->undulation(-180.0, 0.0) == Catch::Approx(0.0));
+    REQUIRE((*grid)->undulation(180.0, 0.0) == Catch::Approx(0.0));
+    REQUIRE((*grid)->undulation(165.0, 0.0) == Catch::Approx(5.5));
+    REQUIRE(!(*grid)->undulation(0.0, -75.0));
+    
+    SECTION("Longitudes just west of the first column wrap onto it") {
+        // 环绕后的列坐标舍入为恰好 12 列，不得越过末列读取
+        for (const double offset : {1e-15, 1e-14, 1e-12, 1e-9}) {
+            const auto undulation = (*grid)->undulation(-180.0 - offset, 0.0);
+            REQUIRE(undulation);
+            REQUIRE(*undulation == Catch::Approx(0.0).margin(1e-6));
+        }
+    }
+}
+
+TEST_CASE("Height datum conversion in the transformer", "[geoid]") {
+    static const auto path = writeGtx("lod_geoid_constant.gtx", -90.0, -180.0, 1.0, 181, 361,
+                               [](int, int) { return 25.0f; });
+    const auto grid = GeoidGrid::open(path);
+    REQUIRE(grid);
+    
+    SECTION("Orthometric heights become ellipsoidal heights") {
+        const CoordinateTransformer orthometric(crs::WGS84(), crs::ECEF(), *grid);
+        const CoordinateTransformer ellipsoidal(crs::WGS84(), crs::ECEF());
+        
+        std::vector<GeoPoint> points{{116.39, 39.91, 50.0}, {-70.0, -33.0, 0.0}};
+        std::vector<GeoPoint> expected{{116.39, 39.91, 75.0}, {-70.0, -33.0, 25.0}};
+        REQUIRE(orthometric.transformInPlace(points));
+        REQUIRE(ellipsoidal.transformInPlace(expected));
+        for (size_t i = 0; i < points.size(); ++i) {
+            REQUIRE(points[i].longitude == Catch::Approx(expected[i].longitude).margin(1e-6));
+            REQUIRE(points[i].latitude == Catch::Approx(expected[i].latitude).margin(1e-6));
+            REQUIRE(points[i].altitude == Catch::Approx(expected[i].altitude).margin(1e-6));
+        }
+    }
+    
+    SECTION("Geographic heights round-trip between datums") {
+        const CoordinateTransformer toEllipsoid(crs::WGS84(), crs::WGS84(), *grid, nullptr);
+        const CoordinateTransformer toGeoid(crs::WGS84(), crs::WGS84(), nullptr, *grid);
+        auto point = toEllipsoid.transform(GeoPoint{10.0, 50.0, 100.0});
+        REQUIRE(point);
+        REQUIRE(point->altitude == Catch::Approx(125.0));
+        point = toGeoid.transform(*point);
+        REQUIRE(point);
+        REQUIRE(point->longitude == Catch::Approx(10.0));
+        REQUIRE(point->altitude == Catch::Approx(100.0));
+    }
+    
+    SECTION("Points outside the grid fail") {
+        const auto regional = GeoidGrid::open(writeGtx("lod_geoid_regional.gtx", 30.0, 110.0, 1.0, 11, 11,
+                                                       [](int, int) { return 0.0f; }));
+        REQUIRE(regional);
+        const CoordinateTransformer transformer(crs::WGS84(), crs::ECEF(), *regional);
+        std::vector<GeoPoint> points{{0.0, 0.0, 0.0}};
+        const auto result = transformer.transformInPlace(points);
+        REQUIRE(!result);
+        REQUIRE(result.error() == TransformError::TransformFailed);
+    }
+}
@@ -4,6 +4,42 @@
 
 using namespace lod::core;
 
+namespace {
+
+// 由互不相连的小三角形组成的网格，每个三角形放在给定位置
+Mesh makeTriangleSoup(const std::vector<std::array<float, 3>>& origins, float size = 0.01f) {
+    VertexAttributes vertices;
+    std::vector<Index> indices;
+    
+    for (const auto& o : origins) {
+        const auto base = static_cast<Index>(vertices.positions.size());
+        vertices.positions.push_back({o[0], o[1], o[2]});
+        vertices.positions.push_back({o[0] + size, o[1], o[2]});
+        vertices.positions.push_back({o[0], o[1] + size, o[2] + size});
+        indices.insert(indices.end(), {base, base + 1, base + 2});
+    }
+    
+    return Mesh{std::move(vertices), std::move(indices)};
+}
+
+// 密集核心（[0,1]^3 内 8000 个三角形）+ 稀疏外围（延伸到 100）
+Mesh makeClusteredMesh() {
+    std::vector<std::array<float, 3>> origins;
+    for (int x = 0; x < 20; ++x) {
+        for (int y = 0; y < 20; ++y) {
+            for (int z = 0; z < 20; ++z) {
+                origins.push_back({x * 0.05f, y * 0.05f, z * 0.05f});
+            }
+        }
+    }
+    for (int i = 1; i <= 8; ++i) {
+        origins.push_back({i * 12.5f, (i % 3) * 40.0f, (i % 2) * 100.0f});
+    }
+    return makeTriangleSoup(origins);
+}
+
+} // namespace
+
 TEST_CASE("BoundingBox basic operations", "[geometry]") {
     SECTION("Default constructor") {
         BoundingBox bbox;
@@ -208,4 +244,219 @@ TEST_CASE("GeometricLodNode operations", "[geometric_lod]") {
         REQUIRE(visitedLevels[0] == 0);
         REQUIRE(visitedLevels[1] == 1);
     }
-} 
\ No newline at end of file
+}
+
+TEST_CASE("BoundingBox adaptive subdivision", "[geometry]") {
+    BoundingBox bbox({0.0f, 0.0f, 0.0f}, {2.0f, 2.0f, 2.0f});
+    
+    SECTION("Subdivide at split point") {
+        auto subdivisions = bbox.subdivide({0.5f, 1.0f, 1.5f});
+        
+        float totalVolume = 0.0f;
+        for (const auto& sub : subdivisions) {
+            totalVolume += sub.volume();
+        }
+        REQUIRE(totalVolume == Catch::Approx(bbox.volume()));
+        
+        REQUIRE(subdivisions[0].max[0] == Catch::Approx(0.5f));
+        REQUIRE(subdivisions[0].max[1] == Catch::Approx(1.0f));
+        REQUIRE(subdivisions[0].max[2] == Catch::Approx(1.5f));
+        REQUIRE(subdivisions[7].min[0] == Catch::Approx(0.5f));
+    }
+    
+    SECTION("Split point is clamped to the box") {
+        auto subdivisions = bbox.subdivide({-1.0f, 5.0f, 1.0f});
+        REQUIRE(subdivisions[0].max[0] == Catch::Approx(0.0f));
+        REQUIRE(subdivisions[0].max[1] == Catch::Approx(2.0f));
+    }
+    
+    SECTION("KD split along longest axis") {
+        BoundingBox slab({0.0f, 0.0f, 0.0f}, {1.0f, 4.0f, 2.0f});
+        REQUIRE(slab.longestAxis() == 1);
+        
+        auto halves = slab.splitAlongAxis(slab.longestAxis(), 3.0f);
+        REQUIRE(halves[0].max[1] == Catch::Approx(3.0f));
+        REQUIRE(halves[1].min[1] == Catch::Approx(3.0f));
+        REQUIRE(halves[0].volume() + halves[1].volume() == Catch::Approx(slab.volume()));
+    }
+}
+
+TEST_CASE("Split point strategies", "[octree]") {
+    auto mesh = makeClusteredMesh();
+    std::vector<Index> triangles(mesh.triangleCount());
+    for (size_t i = 0; i < triangles.size(); ++i) {
+        triangles[i] = static_cast<Index>(i);
+    }
+    BoundingBox bounds({0.0f, 0.0f, 0.0f}, {100.01f, 100.01f, 100.01f});
+    
+    SECTION("Center ignores the triangle distribution") {
+        auto split = computeSplitPoint(mesh, triangles, bounds, SplitStrategy::Center);
+        REQUIRE(split[0] == Catch::Approx(50.005f));
+    }
+    
+    SECTION("Median and SAH follow the dense core") {
+        for (auto strategy : {SplitStrategy::Median, SplitStrategy::SurfaceAreaHeuristic}) {
+            auto split = computeSplitPoint(mesh, triangles, bounds, strategy);
+            for (int axis = 0; axis < 3; ++axis) {
+                REQUIRE(split[axis] < 10.0f);
+            }
+        }
+    }
+}
+
+TEST_CASE("Split strategy comparison", "[octree]") {
+    auto mesh = makeClusteredMesh();
+    
+    OctreeConfig config;
+    config.maxTrianglesPerNode = 500;
+    config.maxDepth = 8;
+    
+    auto comparison = compareSplitStrategies(mesh, config);
+    REQUIRE(comparison.size() == 4);
+    
+    const auto& center = comparison[0];
+    const auto& median = comparison[1];
+    REQUIRE(center.strategy == SplitStrategy::Center);
+    REQUIRE(median.strategy == SplitStrategy::Median);
+    REQUIRE(splitStrategyName(median.strategy) == "median");
+    
+    for (const auto& entry : comparison) {
+        REQUIRE(entry.stats.totalTriangles >= mesh.triangleCount());
+        REQUIRE(entry.stats.leafNodes > 0);
+        REQUIRE(entry.stats.maxLeafTriangles >= entry.stats.minLeafTriangles);
+    }
+    
+    // 中位数划分在密集核心处不会产生细长的深链，叶节点更均衡
+    REQUIRE(median.stats.maxDepth < center.stats.maxDepth);
+    REQUIRE(median.stats.leafTriangleVariance < center.stats.leafTriangleVariance);
+}
+
+TEST_CASE("Single-pass bucketed split", "[geometry]") {
+    auto mesh = makeClusteredMesh();
+    BoundingBox root({0.0f, 0.0f, 0.0f}, {1.0f, 1.0f, 1.0f});
+    
+    // 逐盒暴力扫描作为参照
+    auto bruteForce = [&](const BoundingBox& box) {
+        std::vector<Index> result;
+        const auto& positions = mesh.vertices().positions;
+        const auto& indices = mesh.indices();
+        for (size_t i = 0; i < mesh.triangleCount(); ++i) {
+            std::array<Vertex, 3> triangle = {
+                positions[indices[i * 3]], positions[indices[i * 3 + 1]], positions[indices[i * 3 + 2]]
+            };
+            if (triangleIntersectsBounds(triangle, box)) {
+                result.push_back(static_cast<Index>(i));
+            }
+        }
+        return result;
+    };
+    
+    SECTION("Few boxes (linear test)") {
+        auto octants = root.subdivide();
+        std::vector<BoundingBox> bounds(octants.begin(), octants.end());
+        
+        auto buckets = bucketTrianglesByBounds(mesh, bounds);
+        REQUIRE(buckets.size() == bounds.size());
+        for (size_t i = 0; i < bounds.size(); ++i) {
+            REQUIRE(buckets[i] == bruteForce(bounds[i]));
+        }
+    }
+    
+    SECTION("Many boxes (grid lookup)") {
+        std::vector<BoundingBox> bounds;
+        for (const auto& octant : root.subdivide()) {
+            for (const auto& child : octant.subdivide()) {
+                bounds.push_back(child);
+            }
+        }
+        REQUIRE(bounds.size() == 64);
+        
+        auto buckets = bucketTrianglesByBounds(mesh, bounds);
+        for (size_t i = 0; i < bounds.size(); ++i) {
+            REQUIRE(buckets[i] == bruteForce(bounds[i]));
+        }
+    }
+    
+    SECTION("Split returns only non-empty sub-meshes") {
+        std::vector<BoundingBox> bounds = {
+            BoundingBox({0.0f, 0.0f, 0.0f}, {0.5f, 0.5f, 0.5f}),
+            BoundingBox({200.0f, 200.0f, 200.0f}, {300.0f, 300.0f, 300.0f})
+        };
+        
+        auto parts = splitMeshByBounds(mesh, bounds);
+        REQUIRE(parts.size() == 1);
+        REQUIRE(parts[0].first.triangleCount() == bruteForce(bounds[0]).size());
+    }
+}
+
+TEST_CASE("Loose octree", "[octree]") {
+    // 密集小三角形 + 一个横跨整个场景的大三角形
+    auto soup = makeClusteredMesh();
+    VertexAttributes vertices = soup.vertices();
+    std::vector<Index> indices = soup.indices();
+    const auto base = static_cast<Index>(vertices.positions.size());
+    vertices.positions.push_back({0.0f, 0.0f, 0.0f});
+    vertices.positions.push_back({100.0f, 0.0f, 0.0f});
+    vertices.positions.push_back({0.0f, 100.0f, 100.0f});
+    indices.insert(indices.end(), {base, base + 1, base + 2});
+    const Index largeTriangle = static_cast<Index>(indices.size() / 3 - 1);
+    Mesh mesh{std::move(vertices), std::move(indices)};
+    
+    OctreeConfig config;
+    config.maxDepth = 6;
+    config.maxTrianglesPerNode = 64;
+    config.looseOctree = true;
+    
+    auto octree = buildOctree(mesh, config);
+    REQUIRE(octree != nullptr);
+    
+    SECTION("Each triangle is stored exactly once") {
+        std::vector<Index> all;
+        octree->traverse([&](const OctreeNode& node) {
+            all.insert(all.end(), node.triangleIndices.begin(), node.triangleIndices.end());
+        });
+        std::sort(all.begin(), all.end());
+        REQUIRE(all.size() == mesh.triangleCount());
+        REQUIRE(std::adjacent_find(all.begin(), all.end()) == all.end());
+    }
+    
+    SECTION("Large triangle stays at the root") {
+        const auto& rootTriangles = octree->triangleIndices;
+        REQUIRE(std::find(rootTriangles.begin(), rootTriangles.end(), largeTriangle) != rootTriangles.end());
+    }
+    
+    SECTION("Tight bounds lie within loose bounds") {
+        octree->traverse([&](const OctreeNode& node) {
+            REQUIRE(node.bounds.expanded(config.looseness).containsBox(node.tightBounds));
+        });
+        REQUIRE(octree->tightBounds.contains({0.0f, 0.0f, 0.0f}));
+        REQUIRE(octree->tightBounds.contains({100.0f, 100.0f, 100.0f}));
+    }
+    
+    SECTION("Geometric LOD uses tight bounds") {
+        auto lod = buildGeometricLod(mesh, config);
+        REQUIRE(lod != nullptr);
+        REQUIRE(lod->bounds.min == octree->tightBounds.min);
+        REQUIRE(lod->bounds.max == octree->tightBounds.max);
+        REQUIRE(lod->mesh.triangleCount() == mesh.triangleCount());
+    }
+    
+    SECTION("Geometric LOD children partition their parent's triangles") {
+        const auto lod = buildGeometricLod(mesh, *octree, false);
+        REQUIRE(lod != nullptr);
+        lod->traverse([](const GeometricLodNode& node) {
+            size_t childTriangles = 0;
+            for (const auto& child : node.children) {
+                childTriangles += child->mesh.triangleCount();
+            }
+            REQUIRE(childTriangles <= node.mesh.triangleCount());
+        });
+        
+        // 串行与并行构建结果一致
+        const auto parallel = buildGeometricLod(mesh, *octree, true);
+        REQUIRE(parallel->children.size() == lod->children.size());
+        for (size_t i = 0; i < lod->children.size(); ++i) {
+            REQUIRE(parallel->children[i]->mesh.indices() == lod->children[i]->mesh.indices());
+        }
+    }
+}
@@ -0,0 +1,91 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+#include "../src/geo/LocalFrame.hpp"
+#include <cmath>
+
+using namespace lod::geo;
+
+TEST_CASE("Geodetic to ECEF", "[local_frame]") {
+    const auto equator = geodeticToEcef({0.0, 0.0, 0.0});
+    REQUIRE(equator[0] == Catch::Approx(6378137.0));
+    REQUIRE(equator[1] == Catch::Approx(0.0).margin(1e-6));
+    REQUIRE(equator[2] == Catch::Approx(0.0).margin(1e-6));
+    
+    const auto pole = geodeticToEcef({0.0, 90.0, 100.0});
+    REQUIRE(pole[0] == Catch::Approx(0.0).margin(1e-6));
+    REQUIRE(pole[2] == Catch::Approx(6356752.314245 + 100.0));
+    
+    const auto east = geodeticToEcef({90.0, 0.0, 0.0});
+    REQUIRE(east[1] == Catch::Approx(6378137.0));
+}
+
+TEST_CASE("ENU local frame", "[local_frame]") {
+    SECTION("Axes at the equator and prime meridian") {
+        const auto frame = LocalFrame::enuAt(GeoPoint{0.0, 0.0, 0.0});
+        
+        // 东 = +Y，北 = +Z，天 = +X
+        const auto eastAxis = frame.directionToEcef({1.0, 0.0, 0.0});
+        const auto northAxis = frame.directionToEcef({0.0, 1.0, 0.0});
+        const auto upAxis = frame.directionToEcef({0.0, 0.0, 1.0});
+        REQUIRE(eastAxis[1] == Catch::Approx(1.0));
+        REQUIRE(northAxis[2] == Catch::Approx(1.0));
+        REQUIRE(upAxis[0] == Catch::Approx(1.0));
+        
+        const auto above = frame.toLocal(geodeticToEcef({0.0, 0.0, 250.0}));
+        REQUIRE(above[0] == Catch::Approx(0.0).margin(1e-6));
+        REQUIRE(above[1] == Catch::Approx(0.0).margin(1e-6));
+        REQUIRE(above[2] == Catch::Approx(250.0));
+    }
+    
+    SECTION("Round trip keeps sub-millimetre accuracy") {
+        const auto frame = LocalFrame::enuAt(GeoPoint{116.39, 39.91, 45.0});
+        const Vec3d local{12345.678, -8765.432, 12.5};
+        const auto back = frame.toLocal(frame.toEcef(local));
+        for (int axis = 0; axis < 3; ++axis) {
+            REQUIRE(back[axis] == Catch::Approx(local[axis]).margin(1e-6));
+        }
+    }
+    
+    SECTION("Region frame is determined by the region") {
+        const GeoBBox region{116.0, 39.0, 117.0, 40.0};
+        const auto a = LocalFrame::enuAt(region).toEcefMatrix();
+        const auto b = LocalFrame::enuAt(region).toEcefMatrix();
+        REQUIRE(a == b);
+        REQUIRE(LocalFrame::enuAt(region).origin().longitude == 116.5);
+        
+        // 平移位于矩阵最后一列
+        const auto origin = geodeticToEcef({116.5, 39.5, 0.0});
+        REQUIRE(a[12] == origin[0]);
+        REQUIRE(a[13] == origin[1]);
+        REQUIRE(a[14] == origin[2]);
+        REQUIRE(a[15] == 1.0);
+    }
+    
+    SECTION("Batch conversion to float offsets is centimetre accurate far from the origin") {
+        const auto frame = LocalFrame::enuAt(GeoPoint{8.54, 47.37, 400.0});
+        std::vector<Vec3d> locals;
+        for (int i = 0; i < 1000; ++i) {
+            locals.push_back({-20000.0 + i * 40.123, 15000.0 - i * 31.7, 0.25 * i});
+        }
+        
+        std::vector<double> x, y, z;
+        for (const auto& local : locals) {
+            const auto ecef = frame.toEcef(local);
+            x.push_back(ecef[0]);
+            y.push_back(ecef[1]);
+            z.push_back(ecef[2]);
+        }
+        
+        std::vector<std::array<float, 3>> offsets(locals.size());
+        frame.toLocal(x, y, z, offsets);
+        for (size_t i = 0; i < locals.size(); ++i) {
+            for (int axis = 0; axis < 3; ++axis) {
+                REQUIRE(std::abs(offsets[i][axis] - locals[i][axis]) < 0.01);
+            }
+        }
+        
+        // 直接以 float 存放地心坐标会丢失分米级精度
+        const auto ecef = frame.toEcef(locals[500]);
+        REQUIRE(std::abs(static_cast<double>(static_cast<float>(ecef[0])) - ecef[0]) > 1e-3);
+    }
+}
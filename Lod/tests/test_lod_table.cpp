@@ -0,0 +1,145 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+#include "../src/core/LodTable.hpp"
+
+using namespace lod::core;
+
+namespace {
+
+Mesh makeTriangles(size_t count) {
+    VertexAttributes vertices;
+    std::vector<Index> indices;
+    for (size_t i = 0; i < count; ++i) {
+        const auto base = static_cast<Index>(vertices.positions.size());
+        const float x = static_cast<float>(i);
+        vertices.positions.push_back({x, 0.0f, 0.0f});
+        vertices.positions.push_back({x + 1.0f, 0.0f, 0.0f});
+        vertices.positions.push_back({x, 1.0f, 0.0f});
+        indices.insert(indices.end(), {base, base + 1, base + 2});
+    }
+    return Mesh{std::move(vertices), std::move(indices)};
+}
+
+std::shared_ptr<GeometricLodNode> makeNode(int level, size_t triangles, double error) {
+    auto node = std::make_shared<GeometricLodNode>();
+    node->bounds = BoundingBox({0.0f, 0.0f, 0.0f}, {static_cast<float>(level + 1), 1.0f, 1.0f});
+    node->lodLevel = level;
+    node->geometricError = error;
+    if (triangles > 0) {
+        node->mesh = makeTriangles(triangles);
+    }
+    return node;
+}
+
+// 根 -> {a, b}，a -> {a0, a1}，b 为叶
+std::shared_ptr<GeometricLodNode> makeTree() {
+    auto root = makeNode(0, 4, 8.0);
+    auto a = makeNode(1, 3, 4.0);
+    auto b = makeNode(1, 0, 4.0);
+    a->children = {makeNode(2, 2, 1.0), makeNode(2, 1, 1.0)};
+    root->children = {a, b};
+    return root;
+}
+
+} // namespace
+
+TEST_CASE("Flattened LOD table layout", "[lod_table]") {
+    auto root = makeTree();
+    auto table = flattenLodTree(*root);
+    
+    REQUIRE(table.size() == 5);
+    
+    SECTION("Nodes are stored in BFS order with contiguous children") {
+        REQUIRE(table.level(0) == 0);
+        REQUIRE(table.level(1) == 1);
+        REQUIRE(table.level(2) == 1);
+        REQUIRE(table.level(3) == 2);
+        REQUIRE(table.level(4) == 2);
+        
+        REQUIRE(table.firstChild(0) == 1);
+        REQUIRE(table.childCount(0) == 2);
+        REQUIRE(table.firstChild(1) == 3);
+        REQUIRE(table.childCount(1) == 2);
+        REQUIRE(table.isLeaf(2));
+        REQUIRE(table.isLeaf(3));
+    }
+    
+    SECTION("Mesh handles reference the tree meshes") {
+        REQUIRE(table.hasMesh(0));
+        REQUIRE_FALSE(table.hasMesh(2));
+        REQUIRE(&table.mesh(0) == &root->mesh);
+        REQUIRE(table.mesh(3).triangleCount() == 2);
+    }
+    
+    SECTION("Iterator and bottom-up visitor") {
+        std::vector<LodNodeIndex> forward;
+        for (const auto node : table) {
+            forward.push_back(node.index());
+        }
+        REQUIRE(forward == std::vector<LodNodeIndex>{0, 1, 2, 3, 4});
+        
+        // 自底向上：访问父节点时其子节点均已访问
+        std::vector<bool> visited(table.size(), false);
+        table.forEachBottomUp([&](const auto& node) {
+            for (const auto child : node.children()) {
+                REQUIRE(visited[child]);
+            }
+            visited[node.index()] = true;
+        });
+    }
+    
+    SECTION("Statistics match the tree") {
+        auto stats = computeGeometricLodStats(table);
+        REQUIRE(stats.totalNodes == 5);
+        REQUIRE(stats.leafNodes == 3);
+        REQUIRE(stats.totalTriangles == 10);
+        REQUIRE(stats.maxDepth == 2);
+        REQUIRE(stats.trianglesPerLevel == std::vector<size_t>{4, 3, 3});
+        
+        auto treeStats = computeGeometricLodStats(*root);
+        REQUIRE(treeStats.totalTriangles == stats.totalTriangles);
+        REQUIRE(treeStats.leafNodes == stats.leafNodes);
+    }
+}
+
+TEST_CASE("LOD table built without a tree", "[lod_table]") {
+    GeoLodTable table;
+    const auto root = table.addNode(lod::geo::GeoBBox{0.0, 0.0, 1.0, 1.0}, 0, 10.0, table.addMesh(makeTriangles(2)));
+    const auto first = table.addNode(lod::geo::GeoBBox{0.0, 0.0, 0.5, 1.0}, 1, 5.0, table.addMesh(makeTriangles(1)));
+    table.addNode(lod::geo::GeoBBox{0.5, 0.0, 1.0, 1.0}, 1, 5.0);
+    table.setChildren(root, first, 2);
+    
+    auto stats = std::get<GeoLodStats>(computeLodStats(LodTable{table}));
+    REQUIRE(stats.totalNodes == 3);
+    REQUIRE(stats.leafNodes == 2);
+    REQUIRE(stats.totalTriangles == 3);
+    REQUIRE(stats.totalRegion.maxLon == Catch::Approx(1.0));
+}
+
+TEST_CASE("Parallel hierarchy build matches serial build", "[lod_table]") {
+    const auto mesh = makeTriangles(256);
+    const auto [minCorner, maxCorner] = computeBoundingBox(mesh);
+    const BoundingBox bounds(minCorner, maxCorner);
+    
+    auto build = [&](bool parallel) {
+        LodConfig config;
+        config.strategy = std::make_unique<TriangleCountStrategy>(16, 0.5);
+        config.maxLodLevels = 4;
+        config.useOctreeSubdivision = false;
+        config.enableParallelProcessing = parallel;
+        return buildGeometricLodHierarchy(mesh, bounds, config);
+    };
+    
+    const auto serialRoot = build(false);
+    const auto parallelRoot = build(true);
+    const auto serial = flattenLodTree(*serialRoot);
+    const auto parallel = flattenLodTree(*parallelRoot);
+    
+    REQUIRE(serial.size() > 1);
+    REQUIRE(parallel.size() == serial.size());
+    for (LodNodeIndex i = 0; i < serial.size(); ++i) {
+        REQUIRE(parallel.level(i) == serial.level(i));
+        REQUIRE(parallel.childCount(i) == serial.childCount(i));
+        REQUIRE(parallel.mesh(i).triangleCount() == serial.mesh(i).triangleCount());
+    }
+}
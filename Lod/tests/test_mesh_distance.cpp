@@ -0,0 +1,48 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+#include "../src/core/MeshDistance.hpp"
+#include "TestMeshes.hpp"
+#include <cmath>
+
+using namespace lod::core;
+
+using lod::test::makeGrid;
+
+TEST_CASE("Triangle BVH closest distance", "[mesh_distance]") {
+    const auto plane = makeGrid(8);
+    const TriangleBvh bvh(plane);
+    REQUIRE(bvh.triangleCount() == plane.triangleCount());
+    
+    SECTION("Points above the surface") {
+        REQUIRE(std::sqrt(bvh.closestDistanceSquared({3.3f, 4.7f, 2.0f})) == Catch::Approx(2.0));
+        REQUIRE(bvh.closestDistanceSquared({5.0f, 5.0f, 0.0f}) == Catch::Approx(0.0));
+    }
+    
+    SECTION("Points outside the footprint measure to the nearest edge or corner") {
+        REQUIRE(std::sqrt(bvh.closestDistanceSquared({-3.0f, 4.0f, 0.0f})) == Catch::Approx(3.0));
+        REQUIRE(std::sqrt(bvh.closestDistanceSquared({11.0f, 12.0f, 0.0f})) == Catch::Approx(5.0));
+    }
+    
+    SECTION("Empty BVH") {
+        const TriangleBvh empty;
+        REQUIRE(empty.empty());
+        REQUIRE(std::isinf(empty.closestDistanceSquared({0.0f, 0.0f, 0.0f})));
+    }
+}
+
+TEST_CASE("Sampled Hausdorff distance", "[mesh_distance]") {
+    const auto source = makeGrid(16);
+    const TriangleBvh bvh(source);
+    
+    SECTION("Identical surfaces") {
+        REQUIRE(sampledHausdorffDistance(source, bvh) == Catch::Approx(0.0).margin(1e-6));
+    }
+    
+    SECTION("Offset surface") {
+        REQUIRE(sampledHausdorffDistance(makeGrid(4, {.height = 0.25f}), bvh) == Catch::Approx(0.25));
+    }
+    
+    SECTION("Sample budget still covers the mesh") {
+        REQUIRE(sampledHausdorffDistance(makeGrid(16, {.height = 0.5f}), bvh, 32) == Catch::Approx(0.5));
+    }
+}
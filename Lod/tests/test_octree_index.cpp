@@ -0,0 +1,375 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+#include "../src/core/OctreeIndex.hpp"
+#include "../src/io/OctreeIndexIO.hpp"
+#include "../src/pipeline/LodPipeline.hpp"
+#include <fstream>
+#include <map>
+#include <mutex>
+
+using namespace lod::core;
+
+namespace {
+
+// 在 [offset, offset + 1]^3 内规则排布的小三角形
+Mesh makeGridSource(float offset, int resolution = 10) {
+    VertexAttributes vertices;
+    std::vector<Index> indices;
+    const float step = 1.0f / static_cast<float>(resolution);
+
+    for (int x = 0; x < resolution; ++x) {
+        for (int y = 0; y < resolution; ++y) {
+            for (int z = 0; z < resolution; ++z) {
+                const float ox = offset + x * step;
+                const float oy = offset + y * step;
+                const float oz = offset + z * step;
+                const auto base = static_cast<Index>(vertices.positions.size());
+                vertices.positions.push_back({ox, oy, oz});
+                vertices.positions.push_back({ox + 0.01f, oy, oz});
+                vertices.positions.push_back({ox, oy + 0.01f, oz + 0.01f});
+                indices.insert(indices.end(), {base, base + 1, base + 2});
+            }
+        }
+    }
+
+    return Mesh{std::move(vertices), std::move(indices)};
+}
+
+size_t sourceTriangleCount(const OctreeIndex& index, SourceId sourceId) {
+    std::vector<Index> all;
+    for (const auto& [key, node] : index.nodes()) {
+        for (const auto& source : node.sources) {
+            if (source.sourceId == sourceId) {
+                auto triangles = expandTriangleRanges(source.ranges);
+                all.insert(all.end(), triangles.begin(), triangles.end());
+            }
+        }
+    }
+    std::sort(all.begin(), all.end());
+    all.erase(std::unique(all.begin(), all.end()), all.end());
+    return all.size();
+}
+
+// 内存中的节点结果存储，记录本次构建写入的键
+class MemoryNodeStore : public ILodNodeStore {
+public:
+    std::shared_ptr<GeometricLodNode> load(OctreeKey key) const override {
+        const auto it = entries.find(key);
+        if (it == entries.end()) {
+            return nullptr;
+        }
+        auto node = std::make_shared<GeometricLodNode>(it->second.node);
+        for (const auto childKey : it->second.childKeys) {
+            auto child = load(childKey);
+            if (!child) {
+                return nullptr;
+            }
+            node->children.push_back(std::move(child));
+        }
+        return node;
+    }
+
+    void store(OctreeKey key, const GeometricLodNode& node, std::span<const OctreeKey> childKeys) const override {
+        std::lock_guard lock(mutex);
+        auto& entry = entries[key];
+        entry.node = node;
+        entry.node.children.clear();
+        entry.childKeys.assign(childKeys.begin(), childKeys.end());
+        stored.push_back(key);
+    }
+
+    void erase(OctreeKey key) const override {
+        std::lock_guard lock(mutex);
+        entries.erase(key);
+    }
+
+    struct Entry {
+        GeometricLodNode node;
+        std::vector<OctreeKey> childKeys;
+    };
+    mutable std::mutex mutex;
+    mutable std::map<OctreeKey, Entry> entries;
+    mutable std::vector<OctreeKey> stored;
+};
+
+size_t totalTriangles(const GeometricLodNode& root) {
+    size_t count = 0;
+    root.traverse([&](const GeometricLodNode& node) { count += node.mesh.triangleCount(); });
+    return count;
+}
+
+} // namespace
+
+TEST_CASE("Octree keys and triangle ranges", "[octree_index]") {
+    REQUIRE(octreeKeyDepth(kRootOctreeKey) == 0);
+    REQUIRE(octreeKeyDepth(childOctreeKey(kRootOctreeKey, 5)) == 1);
+    REQUIRE(parentOctreeKey(childOctreeKey(childOctreeKey(kRootOctreeKey, 3), 7)) == childOctreeKey(kRootOctreeKey, 3));
+
+    std::vector<Index> triangles = {0, 1, 2, 5, 6, 9};
+    auto ranges = compressTriangleRanges(triangles);
+    REQUIRE(ranges == std::vector<TriangleRange>{{0, 3}, {5, 2}, {9, 1}});
+    REQUIRE(expandTriangleRanges(ranges) == triangles);
+}
+
+TEST_CASE("Incremental octree index", "[octree_index]") {
+    // 三个互不重叠的源文件
+    std::vector<Mesh> sources = {makeGridSource(0.0f), makeGridSource(2.0f), makeGridSource(4.0f)};
+
+    OctreeConfig config;
+    config.maxTrianglesPerNode = 100;
+    config.maxDepth = 5;
+
+    auto index = OctreeIndex::build(sources, config);
+    REQUIRE_FALSE(index.empty());
+    for (SourceId id = 0; id < sources.size(); ++id) {
+        REQUIRE(sourceTriangleCount(index, id) == sources[id].triangleCount());
+    }
+    REQUIRE(index.dirtyKeys().empty());
+
+    auto resolver = [&](SourceId id) -> const Mesh* {
+        return id < sources.size() ? &sources[id] : nullptr;
+    };
+
+    SECTION("Replacing one source only dirties its nodes and ancestors") {
+        const auto untouchedBefore = index.nodes().size();
+
+        sources[2] = makeGridSource(4.0f, 6);
+        index.replaceSource(2, sources[2]);
+
+        REQUIRE(sourceTriangleCount(index, 2) == sources[2].triangleCount());
+        REQUIRE(sourceTriangleCount(index, 0) == sources[0].triangleCount());
+
+        const auto dirty = index.dirtyKeys();
+        REQUIRE_FALSE(dirty.empty());
+        REQUIRE(dirty.size() < untouchedBefore);
+
+        for (const auto key : dirty) {
+            // 脏节点的祖先也必须是脏的
+            for (auto parent = parentOctreeKey(key); parent != 0; parent = parentOctreeKey(parent)) {
+                REQUIRE(index.find(parent)->dirty);
+            }
+        }
+
+        // 只包含源文件 0、1 的子树保持干净
+        for (const auto& [key, node] : index.nodes()) {
+            const auto subtreeSources = index.sourcesInSubtree(key);
+            if (std::find(subtreeSources.begin(), subtreeSources.end(), SourceId{2}) == subtreeSources.end()) {
+                REQUIRE_FALSE(node.dirty);
+            }
+        }
+    }
+
+    SECTION("Removing a source prunes its nodes") {
+        index.removeSource(1);
+        REQUIRE(sourceTriangleCount(index, 1) == 0);
+        REQUIRE(index.find(kRootOctreeKey)->dirty);
+
+        auto gathered = index.gatherMesh(kRootOctreeKey, resolver);
+        REQUIRE(gathered.triangleCount() == sources[0].triangleCount() + sources[2].triangleCount());
+
+        index.refitDirtyBounds(resolver);
+        REQUIRE(index.find(kRootOctreeKey)->tightBounds.contains({4.9f, 4.9f, 4.9f}));
+    }
+
+    SECTION("Gathered subtree mesh matches the full input") {
+        auto gathered = index.gatherMesh(kRootOctreeKey, resolver);
+        size_t total = 0;
+        for (const auto& source : sources) {
+            total += source.triangleCount();
+        }
+        REQUIRE(gathered.triangleCount() == total);
+    }
+
+    SECTION("Index converts back to an octree over the merged mesh") {
+        std::vector<size_t> counts;
+        for (const auto& source : sources) {
+            counts.push_back(source.triangleCount());
+        }
+
+        const auto octree = index.toOctree(counts);
+        REQUIRE(octree != nullptr);
+        REQUIRE(octree->bounds.min == index.find(kRootOctreeKey)->bounds.min);
+
+        std::vector<Index> all;
+        size_t nodeCount = 0;
+        octree->traverse([&](const OctreeNode& node) {
+            ++nodeCount;
+            all.insert(all.end(), node.triangleIndices.begin(), node.triangleIndices.end());
+        });
+        std::sort(all.begin(), all.end());
+        all.erase(std::unique(all.begin(), all.end()), all.end());
+
+        REQUIRE(nodeCount == index.nodes().size());
+        REQUIRE(all.size() == Mesh::merge(sources).triangleCount());
+    }
+
+    SECTION("Persisted index round-trips") {
+        lod::io::PersistedOctreeIndex persisted{index, {}};
+        const auto path = std::filesystem::temp_directory_path() / "lod_octree_index_test.bin";
+
+        REQUIRE(lod::io::saveOctreeIndex(persisted, path).has_value());
+        auto loaded = lod::io::loadOctreeIndex(path);
+        std::filesystem::remove(path);
+
+        REQUIRE(loaded.has_value());
+        const auto& loadedIndex = loaded->index;
+        REQUIRE(loadedIndex.nodes().size() == index.nodes().size());
+        REQUIRE(loadedIndex.config().maxTrianglesPerNode == config.maxTrianglesPerNode);
+        for (const auto& [key, node] : index.nodes()) {
+            const auto* other = loadedIndex.find(key);
+            REQUIRE(other != nullptr);
+            REQUIRE(other->bounds.min == node.bounds.min);
+            REQUIRE(other->sources.size() == node.sources.size());
+            for (size_t i = 0; i < node.sources.size(); ++i) {
+                REQUIRE(other->sources[i].sourceId == node.sources[i].sourceId);
+                REQUIRE(other->sources[i].ranges == node.sources[i].ranges);
+            }
+        }
+    }
+}
+
+TEST_CASE("Changed source detection", "[octree_index]") {
+    const auto dir = std::filesystem::temp_directory_path() / "lod_octree_index_sources";
+    std::filesystem::create_directories(dir);
+    const auto a = dir / "a.ply";
+    const auto b = dir / "b.ply";
+    std::ofstream(a) << "a";
+    std::ofstream(b) << "b";
+
+    std::vector<lod::io::OctreeSourceRecord> recorded = {
+        *lod::io::makeOctreeSourceRecord(a),
+        *lod::io::makeOctreeSourceRecord(b)
+    };
+    REQUIRE(lod::io::findChangedSources(recorded, {a, b}).empty());
+
+    std::ofstream(b) << "bb";
+    REQUIRE(lod::io::findChangedSources(recorded, {a, b}) == std::vector<SourceId>{1});
+    REQUIRE(lod::io::findChangedSources(recorded, {a, b, a}) == std::vector<SourceId>{1, 2});
+
+    std::filesystem::remove_all(dir);
+}
+
+TEST_CASE("Octree index update across runs", "[octree_index]") {
+    const auto dir = std::filesystem::temp_directory_path() / "lod_octree_index_runs";
+    std::filesystem::create_directories(dir);
+    const std::vector<std::filesystem::path> files = {dir / "a.ply", dir / "b.ply", dir / "c.ply"};
+    for (const auto& file : files) {
+        std::ofstream(file) << file.filename().string();
+    }
+    const auto indexPath = dir / "index.bin";
+
+    std::vector<Mesh> meshes = {makeGridSource(0.0f), makeGridSource(2.0f), makeGridSource(4.0f)};
+    OctreeConfig config;
+    config.maxTrianglesPerNode = 100;
+    config.maxDepth = 5;
+
+    // 记录每次运行向 resolver 请求的源文件
+    std::vector<SourceId> requested;
+    const SourceMeshResolver resolver = [&](SourceId id) -> const Mesh* {
+        requested.push_back(id);
+        return id < meshes.size() ? &meshes[id] : nullptr;
+    };
+
+    // 首次运行：没有索引，全量构建，全部节点都需要构建
+    auto first = lod::pipeline::components::updateOctreeIndex(indexPath, files, resolver, config);
+    REQUIRE(first.has_value());
+    REQUIRE(first->rebuilt);
+    REQUIRE(first->changedSources.size() == files.size());
+    REQUIRE(first->dirtyNodeCount == first->index.nodes().size());
+    REQUIRE(requested.size() == files.size());
+
+    // 构建未提交时脏标记保留到下次运行
+    requested.clear();
+    auto retry = lod::pipeline::components::updateOctreeIndex(indexPath, files, resolver, config);
+    REQUIRE(retry.has_value());
+    REQUIRE_FALSE(retry->rebuilt);
+    REQUIRE(retry->changedSources.empty());
+    REQUIRE(retry->dirtyNodeCount == retry->index.nodes().size());
+    REQUIRE(lod::pipeline::components::commitOctreeIndex(indexPath, *retry).has_value());
+
+    // 输入未变化：不替换任何源文件，也不读取任何源文件
+    requested.clear();
+    auto second = lod::pipeline::components::updateOctreeIndex(indexPath, files, resolver, config);
+    REQUIRE(second.has_value());
+    REQUIRE_FALSE(second->rebuilt);
+    REQUIRE(second->changedSources.empty());
+    REQUIRE(second->dirtyNodeCount == 0);
+    REQUIRE(requested.empty());
+
+    // 只修改一个文件：只替换该源文件，节点划分保持不变；与它不共享节点的源文件不被读取
+    meshes[1] = makeGridSource(2.0f, 8);
+    std::ofstream(files[1]) << "changed";
+    requested.clear();
+    auto third = lod::pipeline::components::updateOctreeIndex(indexPath, files, resolver, config);
+    REQUIRE(third.has_value());
+    REQUIRE_FALSE(third->rebuilt);
+    REQUIRE(third->changedSources == std::vector<SourceId>{1});
+    REQUIRE(third->dirtyNodeCount > 0);
+    REQUIRE(third->dirtyNodeCount < third->index.nodes().size());
+    REQUIRE(sourceTriangleCount(third->index, 1) == meshes[1].triangleCount());
+    REQUIRE(std::find(requested.begin(), requested.end(), SourceId{1}) != requested.end());
+    REQUIRE(std::find(requested.begin(), requested.end(), SourceId{2}) == requested.end());
+    REQUIRE(lod::pipeline::components::commitOctreeIndex(indexPath, *third).has_value());
+
+    // 配置变化时全量重建
+    config.maxTrianglesPerNode = 50;
+    auto fourth = lod::pipeline::components::updateOctreeIndex(indexPath, files, resolver, config);
+    REQUIRE(fourth.has_value());
+    REQUIRE(fourth->rebuilt);
+
+    std::filesystem::remove_all(dir);
+}
+
+TEST_CASE("Bottom-up build reuses clean subtrees", "[octree_index]") {
+    std::vector<Mesh> meshes = {makeGridSource(0.0f), makeGridSource(2.0f), makeGridSource(4.0f)};
+    OctreeConfig octreeConfig;
+    octreeConfig.maxTrianglesPerNode = 100;
+    octreeConfig.maxDepth = 5;
+    auto index = OctreeIndex::build(meshes, octreeConfig);
+    index.markAllDirty();
+
+    std::vector<SourceId> requested;
+    const SourceMeshResolver resolver = [&](SourceId id) -> const Mesh* {
+        requested.push_back(id);
+        return id < meshes.size() ? &meshes[id] : nullptr;
+    };
+
+    LodConfig config;
+    config.strategy = std::make_shared<TriangleCountStrategy>(64);
+    config.octreeConfig = octreeConfig;
+    config.bottomUpConstruction = true;
+    MemoryNodeStore store;
+
+    // 首次构建：全部节点重新构建并写入
+    auto first = buildBottomUpLodHierarchy(index, resolver, &store, config);
+    REQUIRE(first);
+    REQUIRE(requested.size() == meshes.size());
+    REQUIRE_FALSE(store.stored.empty());
+    index.clearDirty();
+
+    // 没有脏节点：整棵树取回，不读取任何源文件
+    requested.clear();
+    store.stored.clear();
+    auto second = buildBottomUpLodHierarchy(index, resolver, &store, config);
+    REQUIRE(second);
+    REQUIRE(requested.empty());
+    REQUIRE(store.stored.empty());
+    REQUIRE(totalTriangles(*second) == totalTriangles(*first));
+    REQUIRE(second->childCount() == first->childCount());
+
+    // 替换一个源文件：只重新构建脏节点，只读取它们引用的源文件
+    meshes[1] = makeGridSource(2.0f, 8);
+    index.replaceSource(1, meshes[1]);
+    index.refitDirtyBounds(resolver);
+    requested.clear();
+    store.stored.clear();
+    auto third = buildBottomUpLodHierarchy(index, resolver, &store, config);
+    REQUIRE(third);
+    REQUIRE(std::find(requested.begin(), requested.end(), SourceId{1}) != requested.end());
+    REQUIRE(std::find(requested.begin(), requested.end(), SourceId{2}) == requested.end());
+    REQUIRE_FALSE(store.stored.empty());
+    REQUIRE(store.stored.size() < index.nodes().size());
+    for (const auto key : store.stored) {
+        REQUIRE(index.find(key)->dirty);
+    }
+}
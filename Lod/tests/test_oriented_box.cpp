@@ -0,0 +1,97 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+#include "../src/core/OrientedBox.hpp"
+#include <cmath>
+#include <vector>
+
+using namespace lod::core;
+
+namespace {
+
+// 尺寸为 size 的长方体网格点，绕 z 轴旋转 angle 后平移到 offset
+std::vector<std::array<double, 3>> makeRotatedBlock(std::array<double, 3> size, double angle,
+                                                    std::array<double, 3> offset = {0.0, 0.0, 0.0}) {
+    std::vector<std::array<double, 3>> points;
+    const double c = std::cos(angle);
+    const double s = std::sin(angle);
+    for (int i = 0; i <= 10; ++i) {
+        for (int j = 0; j <= 10; ++j) {
+            for (int k = 0; k <= 10; ++k) {
+                const double x = size[0] * i / 10.0;
+                const double y = size[1] * j / 10.0;
+                const double z = size[2] * k / 10.0;
+                points.push_back({c * x - s * y + offset[0], s * x + c * y + offset[1], z + offset[2]});
+            }
+        }
+    }
+    return points;
+}
+
+bool containsAll(const OrientedBox& box, const std::vector<std::array<double, 3>>& points) {
+    for (const auto& p : points) {
+        if (!box.contains(p, 1e-9)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+TEST_CASE("Oriented bounding box", "[obb]") {
+    SECTION("Empty point set has no box") {
+        REQUIRE(!computeOrientedBox(std::span<const Vertex>{}));
+    }
+    
+    SECTION("Rotated block is bounded tightly") {
+        const auto points = makeRotatedBlock({100.0, 10.0, 2.0}, 0.5, {6.0e5, 4.0e6, 30.0});
+        const auto box = computeOrientedBox(points);
+        REQUIRE(box);
+        REQUIRE(containsAll(*box, points));
+        REQUIRE(box->volume() == Catch::Approx(2000.0).epsilon(1e-6));
+        
+        // 同一点集的轴对齐包围盒要大得多
+        BoundingBox aligned{{1e30f, 1e30f, 1e30f}, {-1e30f, -1e30f, -1e30f}};
+        for (const auto& p : points) {
+            for (int i = 0; i < 3; ++i) {
+                aligned.min[i] = std::min(aligned.min[i], static_cast<float>(p[i]));
+                aligned.max[i] = std::max(aligned.max[i], static_cast<float>(p[i]));
+            }
+        }
+        REQUIRE(box->volume() < 0.2 * aligned.volume());
+    }
+    
+    SECTION("Axis-aligned block keeps its bounds") {
+        const auto points = makeRotatedBlock({4.0, 3.0, 2.0}, 0.0, {1.0, 1.0, 1.0});
+        const auto box = computeOrientedBox(points);
+        REQUIRE(box);
+        REQUIRE(box->volume() == Catch::Approx(24.0).epsilon(1e-9));
+        REQUIRE(box->center[0] == Catch::Approx(3.0));
+        REQUIRE(box->center[1] == Catch::Approx(2.5));
+        REQUIRE(box->center[2] == Catch::Approx(2.0));
+    }
+    
+    SECTION("Planar points get a thin but valid box") {
+        const std::vector<Vertex> points{{0, 0, 5}, {10, 0, 5}, {10, 10, 5}, {0, 10, 5}};
+        const auto box = computeOrientedBox(points);
+        REQUIRE(box);
+        REQUIRE(box->volume() > 0.0);
+        REQUIRE(box->volume() < 1e-2);
+        for (const auto& axis : box->halfAxes) {
+            REQUIRE(axis[0] * axis[0] + axis[1] * axis[1] + axis[2] * axis[2] > 0.0);
+        }
+    }
+    
+    SECTION("Corners and tiles layout") {
+        const auto box = OrientedBox::fromBounds(BoundingBox{{0, 0, 0}, {2, 4, 6}});
+        const auto corners = box.corners();
+        REQUIRE(corners.front() == std::array<double, 3>{0.0, 0.0, 0.0});
+        REQUIRE(corners.back() == std::array<double, 3>{2.0, 4.0, 6.0});
+        REQUIRE(box.toTilesBox() == std::array<double, 12>{1, 2, 3, 1, 0, 0, 0, 2, 0, 0, 0, 3});
+        
+        const std::vector<std::array<double, 3>> cornerPoints(corners.begin(), corners.end());
+        const auto refit = computeOrientedBox(cornerPoints);
+        REQUIRE(refit);
+        REQUIRE(refit->volume() == Catch::Approx(box.volume()));
+    }
+}
@@ -0,0 +1,197 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+#include "../src/core/QemSimplifier.hpp"
+#include "TestMeshes.hpp"
+#include <algorithm>
+
+using namespace lod::core;
+
+namespace {
+
+// 带法线的网格，位于 [offsetX, offsetX + n] x [0, n] 上
+Mesh makeGrid(int n, float relief = 0.0f, float offsetX = 0.0f) {
+    return lod::test::makeGrid(n, {.relief = relief, .offsetX = offsetX, .normals = true});
+}
+
+bool containsPosition(const Mesh& mesh, const Vertex& position) {
+    const auto& positions = mesh.vertices().positions;
+    return std::find(positions.begin(), positions.end(), position) != positions.end();
+}
+
+// 所有三角形法线的 z 分量均为正（平面网格简化后没有翻转）
+bool allFacingUp(const Mesh& mesh) {
+    const auto& positions = mesh.vertices().positions;
+    const auto& indices = mesh.indices();
+    for (size_t i = 0; i < indices.size(); i += 3) {
+        const auto& a = positions[indices[i]];
+        const auto& b = positions[indices[i + 1]];
+        const auto& c = positions[indices[i + 2]];
+        const float z = (b[0] - a[0]) * (c[1] - a[1]) - (b[1] - a[1]) * (c[0] - a[0]);
+        if (z <= 0.0f) {
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+TEST_CASE("QEM simplifier", "[qem]") {
+    const QemSimplifier simplifier;
+    
+    SECTION("Planar grid collapses without error or flips") {
+        SimplifyOptions options;
+        options.targetError = 1e-4f;
+        const auto result = simplifier.simplify(makeGrid(8), options);
+        
+        REQUIRE(result.mesh.triangleCount() < 16);
+        REQUIRE(result.error == Catch::Approx(0.0).margin(1e-4));
+        REQUIRE(allFacingUp(result.mesh));
+        
+        // 边界约束平面使角点保持不动
+        REQUIRE(containsPosition(result.mesh, {0, 0, 0}));
+        REQUIRE(containsPosition(result.mesh, {8, 0, 0}));
+        REQUIRE(containsPosition(result.mesh, {8, 8, 0}));
+        REQUIRE(containsPosition(result.mesh, {0, 8, 0}));
+    }
+    
+    SECTION("Respects target triangle count") {
+        SimplifyOptions options;
+        options.targetTriangleCount = 40;
+        options.targetError = 1.0f;
+        const auto result = simplifier.simplify(makeGrid(10, 0.1f), options);
+        
+        REQUIRE(result.mesh.triangleCount() <= 40);
+        REQUIRE(result.mesh.triangleCount() >= 38);
+        REQUIRE(result.error > 0.0);
+        REQUIRE(result.mesh.vertexCount() < 121);  // 已压缩
+    }
+    
+    SECTION("Error bound stops collapsing") {
+        SimplifyOptions options;
+        options.targetError = 1e-6f;
+        const auto grid = makeGrid(10, 0.1f);
+        const auto result = simplifier.simplify(grid, options);
+        
+        REQUIRE(result.error <= 1e-6 * 10.0 + 1e-9);
+        REQUIRE(result.mesh.triangleCount() > grid.triangleCount() / 2);
+    }
+    
+    SECTION("Locked border keeps every border vertex") {
+        SimplifyOptions options;
+        options.lockBorder = true;
+        options.targetError = 1.0f;
+        const auto result = simplifier.simplify(makeGrid(6), options);
+        
+        for (int i = 0; i <= 6; ++i) {
+            const auto f = static_cast<float>(i);
+            REQUIRE(containsPosition(result.mesh, {f, 0, 0}));
+            REQUIRE(containsPosition(result.mesh, {f, 6, 0}));
+            REQUIRE(containsPosition(result.mesh, {0, f, 0}));
+            REQUIRE(containsPosition(result.mesh, {6, f, 0}));
+        }
+        REQUIRE(result.mesh.triangleCount() < 72);
+        REQUIRE(allFacingUp(result.mesh));
+    }
+    
+    SECTION("Duplicated vertices of merged parts are welded") {
+        // 两块网格在 x = 4 处相接，Mesh::merge 不焊接公共边上的顶点
+        const std::array parts{makeGrid(4), makeGrid(4, 0.0f, 4.0f)};
+        const auto merged = Mesh::merge(parts);
+        
+        SimplifyOptions options;
+        options.targetError = 1e-4f;
+        const auto result = simplifier.simplify(merged, options);
+        
+        // 公共边内部的顶点可以被折叠，结果与单块 8x4 网格一样精简
+        REQUIRE(!containsPosition(result.mesh, {4, 2, 0}));
+        REQUIRE(result.mesh.triangleCount() < 8);
+        REQUIRE(allFacingUp(result.mesh));
+    }
+    
+    SECTION("Attribute seams are never collapsed") {
+        auto grid = makeGrid(4);
+        auto vertices = grid.vertices();
+        auto indices = grid.indices();
+        // 中心顶点 (2,2) 复制一份带不同法线的副本，供一半三角形使用
+        const auto center = static_cast<Index>(2 * 5 + 2);
+        const auto copy = static_cast<Index>(vertices.positions.size());
+        vertices.positions.push_back(vertices.positions[center]);
+        vertices.normals.push_back({0.0f, 1.0f, 0.0f});
+        for (size_t i = 0; i < indices.size() / 2; ++i) {
+            if (indices[i] == center) {
+                indices[i] = copy;
+            }
+        }
+        
+        SimplifyOptions options;
+        options.lockSeams = false;
+        options.targetError = 1.0f;
+        const auto result = simplifier.simplify(Mesh{vertices, indices}, options);
+        
+        REQUIRE(containsPosition(result.mesh, {2, 2, 0}));
+    }
+    
+    SECTION("Attribute quadrics penalize collapsing across attribute changes") {
+        // 左半边法线朝 +z，右半边朝 +x：仅位置时平面可以完全合并，启用法线权重后中线保留
+        auto grid = makeGrid(6);
+        auto vertices = grid.vertices();
+        for (size_t v = 0; v < vertices.positions.size(); ++v) {
+            if (vertices.positions[v][0] > 3.0f) {
+                vertices.normals[v] = {1.0f, 0.0f, 0.0f};
+            }
+        }
+        const Mesh shaded{vertices, grid.indices()};
+        
+        SimplifyOptions positionOnly;
+        positionOnly.targetError = 1e-3f;
+        SimplifyOptions weighted = positionOnly;
+        weighted.attributeWeights.normal = 1.0f;
+        
+        const auto plain = simplifier.simplify(shaded, positionOnly);
+        const auto attributed = simplifier.simplify(shaded, weighted);
+        REQUIRE(attributed.mesh.triangleCount() > plain.mesh.triangleCount());
+    }
+    
+    SECTION("Small mesh is returned unchanged") {
+        SimplifyOptions options;
+        options.targetTriangleCount = 1000;
+        const auto grid = makeGrid(4);
+        const auto result = simplifier.simplify(grid, options);
+        REQUIRE(result.mesh.triangleCount() == grid.triangleCount());
+        REQUIRE(result.error == 0.0);
+    }
+}
+
+TEST_CASE("Simplifier backends", "[qem]") {
+    SECTION("Factory creates each backend") {
+        REQUIRE(createSimplifier(SimplifierBackend::Meshopt)->name() == "meshopt");
+        REQUIRE(createSimplifier(SimplifierBackend::Qem)->name() == "qem");
+    }
+    
+    SECTION("Backends accept the same options") {
+        SimplifyOptions options;
+        options.targetTriangleCount = 50;
+        options.targetError = 1.0f;
+        const auto grid = makeGrid(8, 0.1f);
+        for (const auto backend : {SimplifierBackend::Meshopt, SimplifierBackend::Qem}) {
+            const auto result = createSimplifier(backend)->simplify(grid, options);
+            REQUIRE(result.mesh.triangleCount() <= 50);
+            REQUIRE(!result.mesh.empty());
+        }
+    }
+    
+    SECTION("Hierarchy builds with the configured backend") {
+        LodConfig config;
+        config.strategy = std::make_unique<TriangleCountStrategy>(64, 0.5);
+        config.simplifier = createSimplifier(SimplifierBackend::Qem);
+        config.maxLodLevels = 3;
+        config.minTrianglesForSubdivision = 32;
+        config.enableParallelProcessing = false;
+        
+        const auto grid = makeGrid(16, 0.1f);
+        const auto root = buildOctreeLodHierarchy(grid, config);
+        REQUIRE(root != nullptr);
+        REQUIRE(root->mesh.triangleCount() > 0);
+    }
+}
@@ -0,0 +1,668 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+#include "../src/core/LodAlgorithm.hpp"
+#include "TestMeshes.hpp"
+#include <algorithm>
+#include <map>
+#include <mutex>
+
+using namespace lod::core;
+
+namespace {
+
+// 带法线与纹理坐标的网格
+Mesh makeGrid(int n, float relief = 0.0f) {
+    return lod::test::makeGrid(n, {.relief = relief, .normals = true, .texCoords = true});
+}
+
+// 记录每个层级取得的误差预算（兄弟节点并行简化，需加锁）
+class RecordingTargetErrorStrategy : public TargetErrorStrategy {
+public:
+    using TargetErrorStrategy::TargetErrorStrategy;
+    
+    SimplifyOptions simplifyOptions(const Mesh& mesh, int lodLevel) const override {
+        auto options = TargetErrorStrategy::simplifyOptions(mesh, lodLevel);
+        std::lock_guard lock(mutex_);
+        budgets_[lodLevel] = options.targetError;
+        return options;
+    }
+    
+    std::map<int, float> budgets() const {
+        std::lock_guard lock(mutex_);
+        return budgets_;
+    }
+    
+private:
+    mutable std::mutex mutex_;
+    mutable std::map<int, float> budgets_;
+};
+
+// 两个共享一条边的三角形，共享边在右侧三角形中使用不同的纹理坐标（接缝）
+Mesh makeSeamQuad() {
+    VertexAttributes vertices;
+    vertices.positions = {{0, 0, 0}, {1, 0, 0}, {0, 1, 0},   // 左三角形
+                          {1, 0, 0}, {1, 1, 0}, {0, 1, 0}};  // 右三角形（0/1 号位置重复）
+    vertices.texCoords = {{0, 0}, {1, 0}, {0, 1},
+                          {0.5f, 0}, {1, 1}, {0, 0.5f}};
+    return Mesh{std::move(vertices), {0, 1, 2, 3, 4, 5}};
+}
+
+} // namespace
+
+TEST_CASE("Vertex locks", "[simplify]") {
+    SECTION("No flags locks nothing") {
+        const auto locks = computeVertexLocks(makeGrid(3), false, false);
+        REQUIRE(locks.size() == 16);
+        for (const auto lock : locks) {
+            REQUIRE(lock == 0);
+        }
+    }
+    
+    SECTION("Border locks only outer ring") {
+        const auto locks = computeVertexLocks(makeGrid(3), false, true);
+        for (int y = 0; y <= 3; ++y) {
+            for (int x = 0; x <= 3; ++x) {
+                const bool border = x == 0 || y == 0 || x == 3 || y == 3;
+                REQUIRE((locks[y * 4 + x] != 0) == border);
+            }
+        }
+    }
+    
+    SECTION("Seam locks every copy of a split vertex") {
+        const auto locks = computeVertexLocks(makeSeamQuad(), true, false);
+        REQUIRE(locks == std::vector<unsigned char>{0, 1, 1, 1, 0, 1});
+    }
+    
+    SECTION("Split vertices are welded before border detection") {
+        // 接缝边两侧各有一个三角形，焊接后不是边界；四个角都在开放边界上
+        const auto locks = computeVertexLocks(makeSeamQuad(), false, true);
+        for (const auto lock : locks) {
+            REQUIRE(lock != 0);
+        }
+    }
+}
+
+TEST_CASE("Mesh compaction", "[simplify]") {
+    const auto grid = makeGrid(2);
+    
+    SECTION("Keeps only referenced vertices with all attribute streams") {
+        // 只保留右上角格子的两个三角形
+        const auto& indices = grid.indices();
+        const auto corner = grid.withIndices({indices.end() - 6, indices.end()});
+        
+        const auto compacted = compactMesh(corner);
+        REQUIRE(compacted.vertexCount() == 4);
+        REQUIRE(compacted.vertices().normals.size() == 4);
+        REQUIRE(compacted.vertices().texCoords.size() == 4);
+        REQUIRE(compacted.vertices().colors.empty());
+        
+        // 每个三角形的顶点位置保持不变
+        for (size_t i = 0; i < compacted.indices().size(); ++i) {
+            const auto before = corner.indices()[i];
+            const auto after = compacted.indices()[i];
+            REQUIRE(after < compacted.vertexCount());
+            REQUIRE(compacted.vertices().positions[after] == corner.vertices().positions[before]);
+            REQUIRE(compacted.vertices().texCoords[after] == corner.vertices().texCoords[before]);
+        }
+    }
+    
+    SECTION("Fully referenced mesh keeps its size") {
+        REQUIRE(compactMesh(grid).vertexCount() == grid.vertexCount());
+    }
+}
+
+TEST_CASE("Attribute-weighted simplification", "[simplify]") {
+    const auto grid = makeGrid(8);
+    
+    SECTION("Respects target triangle count") {
+        SimplifyOptions options;
+        options.targetTriangleCount = 32;
+        options.targetError = 1.0f;
+        options.attributeWeights = {1.0f, 0.5f, 0.0f};
+        
+        const auto simplified = simplifyMesh(grid, options);
+        REQUIRE(simplified.triangleCount() <= 32);
+        REQUIRE(simplified.vertexCount() < grid.vertexCount());
+    }
+    
+    SECTION("Deferred compaction keeps the shared vertex buffer") {
+        SimplifyOptions options;
+        options.targetTriangleCount = 32;
+        options.targetError = 1.0f;
+        options.compactVertices = false;
+        
+        const auto simplified = simplifyMesh(grid, options);
+        REQUIRE(simplified.vertexCount() == grid.vertexCount());
+        
+        const auto compacted = compactMesh(simplified);
+        REQUIRE(compacted.triangleCount() == simplified.triangleCount());
+        REQUIRE(compacted.vertexCount() < simplified.vertexCount());
+    }
+    
+    SECTION("Already small mesh is returned unchanged") {
+        SimplifyOptions options;
+        options.targetTriangleCount = grid.triangleCount();
+        
+        const auto simplified = simplifyMesh(grid, options);
+        REQUIRE(simplified.indices() == grid.indices());
+    }
+    
+    SECTION("Strategies choose attribute weights") {
+        const TriangleCountStrategy strategy(100, 0.5, {0.25f, 2.0f, 0.0f});
+        const auto options = strategy.simplifyOptions(grid, 1);
+        REQUIRE(options.targetTriangleCount == strategy.targetTriangleCount(grid, 1));
+        REQUIRE(options.attributeWeights.texCoord == 2.0f);
+        REQUIRE(options.lockSeams);
+        
+        const VolumeBasedStrategy volume;
+        REQUIRE_FALSE(volume.simplifyOptions(grid, 1).attributeWeights.any());
+    }
+}
+
+TEST_CASE("Bottom-up hierarchy", "[simplify]") {
+    const auto grid = makeGrid(16, 0.1f);
+    
+    LodConfig config;
+    config.strategy = std::make_unique<TriangleCountStrategy>(64, 0.5);
+    config.bottomUpConstruction = true;
+    config.octreeConfig.maxTrianglesPerNode = 64;
+    
+    const auto root = buildGeometricLodHierarchy(grid, BoundingBox({0, 0, 0}, {16, 16, 0.4f}), config);
+    REQUIRE(root);
+    REQUIRE_FALSE(root->isLeaf());
+    
+    size_t leafTriangles = 0;
+    root->traverse([&](const GeometricLodNode& node) {
+        if (node.isLeaf()) {
+            // 叶节点保留全部细节，且互不重叠
+            leafTriangles += node.mesh.triangleCount();
+            REQUIRE(node.geometricError == 0.0);
+            return;
+        }
+        
+        size_t childTriangles = 0;
+        for (const auto& child : node.children) {
+            childTriangles += child->mesh.triangleCount();
+            REQUIRE(node.geometricError >= child->geometricError);
+        }
+        REQUIRE(node.mesh.triangleCount() <= childTriangles);
+    });
+    REQUIRE(leafTriangles == grid.triangleCount());
+}
+
+TEST_CASE("Octree hierarchy measures geometric errors", "[simplify]") {
+    const auto grid = makeGrid(32, 0.1f);
+    
+    LodConfig config;
+    config.strategy = std::make_unique<TargetErrorStrategy>(std::vector<double>{64.0, 4.0, 1.0}, 256.0, 64);
+    config.octreeConfig.maxTrianglesPerNode = 64;
+    
+    // 默认路径：八叉树细分，内部节点简化一级
+    const auto root = buildGeometricLodHierarchy(grid, BoundingBox({0, 0, 0}, {32, 32, 0.4f}), config);
+    REQUIRE(root);
+    REQUIRE_FALSE(root->isLeaf());
+    REQUIRE(root->geometricError > 0.0);
+    REQUIRE(root->mesh.triangleCount() < grid.triangleCount());
+    
+    // 误差朝根节点单调不减，叶节点保留全部细节
+    root->traverse([](const GeometricLodNode& node) {
+        if (node.isLeaf()) {
+            REQUIRE(node.geometricError == 0.0);
+            return;
+        }
+        for (const auto& child : node.children) {
+            REQUIRE(node.geometricError >= child->geometricError);
+        }
+    });
+}
+
+TEST_CASE("Bottom-up hierarchy uses per-level budgets", "[simplify]") {
+    const auto grid = makeGrid(32, 0.1f);
+    const BoundingBox bounds({0, 0, 0}, {32, 32, 0.4f});
+    
+    LodConfig config;
+    config.bottomUpConstruction = true;
+    config.octreeConfig.maxTrianglesPerNode = 64;
+    
+    SECTION("Root is simplified with the coarsest budget") {
+        auto strategy = std::make_unique<RecordingTargetErrorStrategy>(std::vector<double>{64.0, 4.0, 1.0}, 256.0, 64);
+        const auto* recorder = strategy.get();
+        config.strategy = std::move(strategy);
+        
+        const auto root = buildGeometricLodHierarchy(grid, bounds, config);
+        REQUIRE(root);
+        REQUIRE_FALSE(root->isLeaf());
+        
+        const auto budgets = recorder->budgets();
+        REQUIRE(budgets.contains(0));
+        REQUIRE(budgets.contains(1));
+        REQUIRE(budgets.at(0) == Catch::Approx(64.0 / 256.0));
+        REQUIRE(budgets.at(1) == Catch::Approx(4.0 / 256.0));
+        
+        // 根节点在子节点误差之上再叠加本级（更宽松的）简化误差
+        for (const auto& child : root->children) {
+            REQUIRE(child->lodLevel == 1);
+            REQUIRE(root->geometricError > child->geometricError);
+        }
+    }
+    
+    SECTION("Merging stops at the level limit") {
+        config.strategy = std::make_unique<TargetErrorStrategy>(std::vector<double>{64.0, 4.0, 1.0}, 256.0, 64);
+        config.maxLodLevels = 1;
+        
+        const auto root = buildGeometricLodHierarchy(grid, bounds, config);
+        REQUIRE(root);
+        REQUIRE_FALSE(root->isLeaf());
+        
+        // 达到层数上限的节点保留整个子树的全部细节
+        size_t leafTriangles = 0;
+        for (const auto& child : root->children) {
+            REQUIRE(child->isLeaf());
+            REQUIRE(child->geometricError == 0.0);
+            leafTriangles += child->mesh.triangleCount();
+        }
+        REQUIRE(leafTriangles == grid.triangleCount());
+    }
+    
+    SECTION("Nodes the strategy would not subdivide stay leaves") {
+        config.strategy = std::make_unique<TargetErrorStrategy>(std::vector<double>{64.0}, 256.0, 64);
+        
+        // 预算表只有一层：根节点之下不再细分
+        const auto root = buildGeometricLodHierarchy(grid, bounds, config);
+        REQUIRE(root);
+        REQUIRE_FALSE(root->isLeaf());
+        for (const auto& child : root->children) {
+            REQUIRE(child->isLeaf());
+        }
+    }
+}
+
+TEST_CASE("Simplification error", "[simplify]") {
+    const auto grid = makeGrid(8, 0.1f);
+    
+    SECTION("Reported error is in world units") {
+        SimplifyOptions options;
+        options.targetTriangleCount = 16;
+        options.targetError = 1.0f;
+        
+        const auto result = simplifyMeshWithError(grid, options);
+        REQUIRE(result.mesh.triangleCount() <= 16);
+        REQUIRE(result.error > 0.0);
+        REQUIRE(result.error < 8.0);
+    }
+    
+    SECTION("Unsimplified mesh has no error") {
+        SimplifyOptions options;
+        options.targetTriangleCount = grid.triangleCount();
+        REQUIRE(simplifyMeshWithError(grid, options).error == 0.0);
+    }
+    
+    SECTION("Top-down hierarchy errors are monotone") {
+        LodConfig config;
+        config.strategy = std::make_unique<TriangleCountStrategy>(32, 0.5);
+        config.maxLodLevels = 3;
+        config.useOctreeSubdivision = false;
+        config.measureHausdorffError = true;
+        
+        const auto root = buildGeometricLodHierarchy(grid, BoundingBox({0, 0, 0}, {8, 8, 0.4f}), config);
+        REQUIRE_FALSE(root->isLeaf());
+        root->traverse([](const GeometricLodNode& node) {
+            for (const auto& child : node.children) {
+                REQUIRE(node.geometricError >= child->geometricError);
+            }
+        });
+    }
+}
+
+TEST_CASE("Target error strategy", "[simplify]") {
+    const auto grid = makeGrid(8, 0.1f);
+    const TargetErrorStrategy strategy({16.0, 4.0}, 256.0, 64);
+    
+    SECTION("Budget converts to an error relative to node size") {
+        REQUIRE(strategy.simplifyOptions(grid, 0).targetError == Catch::Approx(16.0 / 256.0));
+        REQUIRE(strategy.simplifyOptions(grid, 1).targetError == Catch::Approx(4.0 / 256.0));
+        
+        // 超出预算表的层级沿用最后一项
+        REQUIRE(strategy.simplifyOptions(grid, 5).targetError == Catch::Approx(4.0 / 256.0));
+    }
+    
+    SECTION("Simplification is bounded by error, not triangle count") {
+        const auto options = strategy.simplifyOptions(grid, 1);
+        REQUIRE(options.targetTriangleCount == 0);
+        REQUIRE(options.targetError == Catch::Approx(4.0 / 256.0));
+        REQUIRE_FALSE(options.attributeWeights.any());
+    }
+    
+    SECTION("Subdivision stops after the last budgeted level") {
+        REQUIRE(strategy.shouldSubdivide(grid, BoundingBox({0, 0, 0}, {8, 8, 1}), 1));
+        REQUIRE_FALSE(strategy.shouldSubdivide(grid, BoundingBox({0, 0, 0}, {8, 8, 1}), 2));
+    }
+}
+
+TEST_CASE("Screen-space error strategy subdivides by ground size", "[simplify]") {
+    const auto grid = makeGrid(4);
+    const ScreenSpaceErrorStrategy strategy;
+    
+    // 同为 0.05° 见方：赤道附近约 5.5 km 宽，北纬 89.9° 附近东西向不足 10 m、南北向约 5.6 km
+    REQUIRE(strategy.shouldSubdivide(grid, lod::geo::GeoBBox{10.0, 0.0, 10.05, 0.05}, 0));
+    REQUIRE(strategy.shouldSubdivide(grid, lod::geo::GeoBBox{10.0, 89.9, 10.05, 89.95}, 0));
+    
+    // 0.02° 的经度跨度在赤道约 2.2 km，在北纬 70° 只有约 760 m
+    REQUIRE(strategy.shouldSubdivide(grid, lod::geo::GeoBBox{10.0, 0.0, 10.02, 0.005}, 0));
+    REQUIRE_FALSE(strategy.shouldSubdivide(grid, lod::geo::GeoBBox{10.0, 70.0, 10.02, 70.005}, 0));
+    
+    REQUIRE_FALSE(strategy.shouldSubdivide(grid, lod::geo::GeoBBox{10.0, 0.0, 10.05, 0.05}, 10));
+}
+
+TEST_CASE("Crack-free tile borders", "[simplify]") {
+    SECTION("Triangles touching the cell faces are locked") {
+        // 4 x 4 网格恰好填满单元格：只有完全位于内部的三角形保持自由
+        const auto grid = makeGrid(4, 0.1f);
+        const auto locks = computeCellFaceLocks(grid, BoundingBox({0, 0, -1}, {4, 4, 1}));
+        
+        const auto at = [](int x, int y) { return static_cast<size_t>(y * 5 + x); };
+        REQUIRE(locks[at(0, 0)] != 0);
+        REQUIRE(locks[at(4, 2)] != 0);
+        REQUIRE(locks[at(1, 1)] != 0);  // 与面上的顶点同在一个三角形中
+        REQUIRE(locks[at(3, 2)] != 0);
+        REQUIRE(locks[at(2, 2)] == 0);
+    }
+    
+    SECTION("Flat axis is not treated as a cell face") {
+        const auto grid = makeGrid(4);
+        const auto locks = computeCellFaceLocks(grid, BoundingBox({-1, -1, 0}, {5, 5, 0}));
+        for (const auto lock : locks) {
+            REQUIRE(lock == 0);
+        }
+    }
+    
+    SECTION("Skirts hang below every open border edge") {
+        const auto grid = makeGrid(2);
+        const auto skirted = addSkirts(grid, 0.5f);
+        
+        // 2 x 2 网格的边界有 8 条边、8 个顶点
+        REQUIRE(skirted.vertexCount() == grid.vertexCount() + 8);
+        REQUIRE(skirted.triangleCount() == grid.triangleCount() + 16);
+        REQUIRE(skirted.vertices().texCoords.size() == skirted.vertexCount());
+        for (size_t v = grid.vertexCount(); v < skirted.vertexCount(); ++v) {
+            REQUIRE(skirted.vertices().positions[v][2] == Catch::Approx(-0.5f));
+        }
+        
+        // 底边 y = 0 上的裙边朝 -y 方向
+        const auto& p = skirted.vertices().positions;
+        const auto& idx = skirted.indices();
+        const auto base = grid.indices().size();
+        bool foundOutward = false;
+        for (size_t i = base; i < idx.size(); i += 3) {
+            const auto& a = p[idx[i]];
+            const auto& b = p[idx[i + 1]];
+            const auto& c = p[idx[i + 2]];
+            if (a[1] != 0.0f || b[1] != 0.0f || c[1] != 0.0f) {
+                continue;
+            }
+            const float ux = b[0] - a[0], uz = b[2] - a[2];
+            const float vx = c[0] - a[0], vz = c[2] - a[2];
+            REQUIRE(uz * vx - ux * vz < 0.0f);  // 法线 y 分量
+            foundOutward = true;
+        }
+        REQUIRE(foundOutward);
+    }
+    
+    SECTION("Skirt vertices lower the cached geodetic height too") {
+        auto vertices = makeGrid(2).vertices();
+        for (const auto& p : vertices.positions) {
+            vertices.geoCoords.push_back({113.0 + p[0] * 1e-5, 23.0 + p[1] * 1e-5, 10.0});
+        }
+        const Mesh grid{vertices, makeGrid(2).indices()};
+        const auto skirted = addSkirts(grid, 0.5f);
+        
+        REQUIRE(skirted.vertices().geoCoords.size() == skirted.vertexCount());
+        for (size_t v = grid.vertexCount(); v < skirted.vertexCount(); ++v) {
+            REQUIRE(skirted.vertices().geoCoords[v][2] == Catch::Approx(9.5));
+        }
+    }
+    
+    SECTION("Skirt mode keeps the hierarchy and adds skirts per node") {
+        const auto grid = makeGrid(8, 0.1f);
+        LodConfig config;
+        config.strategy = std::make_unique<TriangleCountStrategy>(32, 0.5);
+        config.maxLodLevels = 2;
+        config.useOctreeSubdivision = false;
+        config.borderMode = BorderMode::Skirts;
+        
+        const auto root = buildGeometricLodHierarchy(grid, BoundingBox({0, 0, 0}, {8, 8, 0.4f}), config);
+        REQUIRE(root->mesh.vertexCount() > grid.vertexCount());
+        REQUIRE_FALSE(root->isLeaf());
+    }
+}
+
+TEST_CASE("Sloppy fallback", "[simplify]") {
+    // 互不相连的三角形：每个三角形向重心收缩，保拓扑简化无边可折叠
+    const auto grid = makeGrid(8, 0.1f);
+    VertexAttributes soupVertices;
+    Mesh::Indices soupIndices;
+    const auto& gridPositions = grid.vertices().positions;
+    for (size_t i = 0; i < grid.indices().size(); i += 3) {
+        Vertex centroid{};
+        for (int k = 0; k < 3; ++k) {
+            for (int c = 0; c < 3; ++c) {
+                centroid[c] += gridPositions[grid.indices()[i + k]][c] / 3.0f;
+            }
+        }
+        for (int k = 0; k < 3; ++k) {
+            auto p = gridPositions[grid.indices()[i + k]];
+            for (int c = 0; c < 3; ++c) {
+                p[c] = centroid[c] + (p[c] - centroid[c]) * 0.8f;
+            }
+            soupIndices.push_back(static_cast<Index>(soupVertices.positions.size()));
+            soupVertices.positions.push_back(p);
+        }
+    }
+    const Mesh soup{std::move(soupVertices), std::move(soupIndices)};
+    
+    SimplifyOptions options;
+    options.targetTriangleCount = 16;
+    options.targetError = 1.0f;
+    
+    SECTION("Falls back when the topology-preserving result overshoots the target") {
+        const auto result = simplifyMeshWithError(soup, options);
+        REQUIRE(result.usedFallback);
+        REQUIRE(result.topologyTriangleCount == soup.triangleCount());
+        REQUIRE(result.mesh.triangleCount() <= 16);
+    }
+    
+    SECTION("Fallback can be disabled") {
+        options.fallbackFactor = 0.0f;
+        const auto result = simplifyMeshWithError(soup, options);
+        REQUIRE_FALSE(result.usedFallback);
+        REQUIRE(result.mesh.triangleCount() == soup.triangleCount());
+    }
+    
+    SECTION("Locked border vertices survive a tiny target") {
+        // sloppy 简化不认锁定：存在锁定时不得回退，否则边界顶点会被合并而产生裂缝
+        SimplifyOptions bordered;
+        bordered.targetTriangleCount = 1;
+        bordered.targetError = 1.0f;
+        bordered.lockBorder = true;
+        bordered.fallbackFactor = 1.0f;
+        
+        const auto result = simplifyMeshWithError(grid, bordered);
+        REQUIRE_FALSE(result.usedFallback);
+        
+        const auto& positions = result.mesh.vertices().positions;
+        for (const auto& p : gridPositions) {
+            const bool border = p[0] == 0.0f || p[1] == 0.0f || p[0] == 8.0f || p[1] == 8.0f;
+            if (border) {
+                REQUIRE(std::find(positions.begin(), positions.end(), p) != positions.end());
+            }
+        }
+    }
+}
+
+TEST_CASE("Geographic region split", "[simplify]") {
+    // 4 x 4 网格的经纬度缓存：经度 = 100 + x，纬度 = 30 + y
+    auto grid = makeGrid(4);
+    auto vertices = grid.vertices();
+    for (const auto& p : vertices.positions) {
+        vertices.geoCoords.push_back({100.0 + p[0], 30.0 + p[1]});
+    }
+    const auto geoGrid = grid.withVertices(std::move(vertices));
+    const lod::geo::GeoBBox region{100.0, 30.0, 104.0, 34.0};
+    const auto quadrants = region.subdivide();
+    
+    SECTION("Triangles are bucketed into the quadrants they touch") {
+        const auto parts = splitMeshByRegion(geoGrid, region, {quadrants.begin(), quadrants.end()});
+        REQUIRE(parts.size() == 4);
+        
+        // 每个象限完整包含 2 x 2 个格子，并额外收到触及中线的相邻三角形
+        size_t total = 0;
+        for (size_t i = 0; i < parts.size(); ++i) {
+            const auto& part = parts[i].first;
+            REQUIRE(parts[i].second.minLon == quadrants[i].minLon);
+            REQUIRE(parts[i].second.minLat == quadrants[i].minLat);
+            REQUIRE(part.triangleCount() >= 8);
+            REQUIRE(part.vertices().geoCoords.size() == part.vertexCount());
+            total += part.triangleCount();
+        }
+        REQUIRE(total > geoGrid.triangleCount());
+        
+        // 西南象限的三角形都触及 [100,102] x [30,32]
+        const auto& southWest = parts[0].first;
+        for (size_t t = 0; t < southWest.triangleCount(); ++t) {
+            double minLon = 1e9, minLat = 1e9;
+            for (int k = 0; k < 3; ++k) {
+                const auto& [lon, lat, height] = southWest.vertices().geoCoords[southWest.indices()[t * 3 + k]];
+                minLon = std::min(minLon, lon);
+                minLat = std::min(minLat, lat);
+            }
+            REQUIRE(minLon <= 102.0);
+            REQUIRE(minLat <= 32.0);
+        }
+    }
+    
+    SECTION("Empty quadrants and triangles outside the region are dropped") {
+        const lod::geo::GeoBBox west{100.0, 30.0, 101.5, 34.0};
+        const lod::geo::GeoBBox far{120.0, 30.0, 121.0, 34.0};
+        const auto parts = splitMeshByRegion(geoGrid, west, {west, far});
+        REQUIRE(parts.size() == 1);
+        REQUIRE(parts[0].first.triangleCount() == 16);  // 两列格子
+    }
+    
+    SECTION("Sub-regions carry the heights of their own triangles") {
+        // 高度随经度线性增长：西侧象限的高度范围低于东侧
+        auto sloped = geoGrid.vertices();
+        for (auto& coord : sloped.geoCoords) {
+            coord[2] = 10.0 * (coord[0] - 100.0);
+        }
+        const auto slopedGrid = geoGrid.withVertices(std::move(sloped));
+        
+        const auto bounds = computeGeoBounds(slopedGrid);
+        REQUIRE(bounds);
+        REQUIRE(bounds->minLon == 100.0);
+        REQUIRE(bounds->maxLat == 34.0);
+        REQUIRE(bounds->minHeight == 0.0);
+        REQUIRE(bounds->maxHeight == 40.0);
+        
+        const auto parts = splitMeshByRegion(slopedGrid, region, {quadrants.begin(), quadrants.end()});
+        REQUIRE(parts[0].second.minHeight == 0.0);
+        REQUIRE(parts[0].second.maxHeight == 30.0);  // 触及中线的三角形延伸到经度 103
+        REQUIRE(parts[1].second.minHeight == 10.0);
+        REQUIRE(parts[1].second.maxHeight == 40.0);
+        REQUIRE(parts[0].second.maxLon == quadrants[0].maxLon);
+    }
+    
+    SECTION("Positions are used as longitude and latitude without a cache") {
+        const auto parts = splitMeshByRegion(grid, {0.0, 0.0, 4.0, 4.0}, {{0.0, 0.0, 1.0, 1.0}});
+        REQUIRE(parts.size() == 1);
+        REQUIRE(parts[0].first.triangleCount() >= 2);
+    }
+    
+    SECTION("Hierarchy children cover their own quadrant") {
+        LodConfig config;
+        config.strategy = std::make_unique<TriangleCountStrategy>(8, 0.5);
+        config.maxLodLevels = 1;
+        config.enableParallelProcessing = false;
+        
+        const auto root = buildGeoLodHierarchy(geoGrid, region, config);
+        REQUIRE(root->children.size() == 4);
+        for (const auto& child : root->children) {
+            REQUIRE(child->mesh.triangleCount() < geoGrid.triangleCount());
+        }
+    }
+}
+
+TEST_CASE("Tiled geographic split", "[simplify]") {
+    // 经度 100..104、纬度 30..34 的网格；全球大地方案下 3 级瓦片 [90,112.5] x [22.5,45] 完整包含它
+    auto grid = makeGrid(4);
+    auto vertices = grid.vertices();
+    for (const auto& p : vertices.positions) {
+        vertices.geoCoords.push_back({100.0 + p[0], 30.0 + p[1], 0.0});
+    }
+    const auto geoGrid = grid.withVertices(std::move(vertices));
+    const lod::geo::TilingScheme scheme(lod::geo::TilingSchemeType::Geodetic);
+    const lod::geo::TileKey rootKey{3, 12, 5};
+    
+    SECTION("Triangles are bucketed by tile key") {
+        const auto children = rootKey.children();
+        const auto parts = splitMeshByTiles(geoGrid, scheme, children);
+        REQUIRE(parts.size() == 4);
+        
+        size_t total = 0;
+        for (size_t i = 0; i < parts.size(); ++i) {
+            const auto& [part, key] = parts[i];
+            REQUIRE(key == children[i]);
+            total += part.triangleCount();
+            
+            // 每个三角形都触及自己的瓦片
+            const auto tile = scheme.bounds(key);
+            for (size_t t = 0; t < part.triangleCount(); ++t) {
+                lod::geo::GeoBBox triangle{1e9, 1e9, -1e9, -1e9};
+                for (int k = 0; k < 3; ++k) {
+                    const auto& [lon, lat, height] = part.vertices().geoCoords[part.indices()[t * 3 + k]];
+                    triangle = triangle.unite({lon, lat, lon, lat});
+                }
+                REQUIRE(triangle.intersects(tile));
+            }
+        }
+        REQUIRE(total > geoGrid.triangleCount());
+    }
+    
+    SECTION("Tiles without triangles are dropped") {
+        const std::array keys{lod::geo::TileKey{3, 12, 5}, lod::geo::TileKey{3, 0, 0}};
+        const auto parts = splitMeshByTiles(geoGrid, scheme, keys);
+        REQUIRE(parts.size() == 1);
+        REQUIRE(parts[0].first.triangleCount() == geoGrid.triangleCount());
+    }
+    
+    SECTION("Hierarchy regions are scheme tiles independent of the data extent") {
+        LodConfig config;
+        config.strategy = std::make_unique<TriangleCountStrategy>(8, 0.5);
+        config.maxLodLevels = 2;
+        config.enableParallelProcessing = false;
+        config.tilingScheme = scheme;
+        
+        const auto collectKeys = [&](const Mesh& mesh) {
+            std::vector<lod::geo::TileKey> keys;
+            const auto root = buildGeoLodHierarchy(mesh, *computeGeoBounds(mesh), config);
+            root->traverse([&](const GeoLodNode& node) {
+                const auto key = scheme.keyOf(node.region);
+                REQUIRE(key);
+                keys.push_back(*key);
+            });
+            return keys;
+        };
+        
+        const auto keys = collectKeys(geoGrid);
+        REQUIRE(keys.front() == rootKey);
+        REQUIRE(keys.size() > 5);
+        
+        // 向东平移 0.5° 的数据集得到相同的根瓦片，子瓦片边界也完全相同
+        auto shifted = geoGrid.vertices();
+        for (auto& coord : shifted.geoCoords) {
+            coord[0] += 0.5;
+        }
+        const auto shiftedKeys = collectKeys(geoGrid.withVertices(std::move(shifted)));
+        REQUIRE(shiftedKeys.front() == rootKey);
+        REQUIRE(std::find(shiftedKeys.begin(), shiftedKeys.end(), keys[1]) != shiftedKeys.end());
+    }
+}
@@ -0,0 +1,204 @@
+#include <catch2/catch_test_macros.hpp>
+#include "../src/io/SimplifyCache.hpp"
+#include "TestMeshes.hpp"
+#include <chrono>
+
+using namespace lod;
+
+namespace {
+
+// 统计调用次数的简化后端
+class CountingSimplifier : public core::ISimplifier {
+public:
+    core::SimplifyResult simplify(const core::Mesh& mesh, const core::SimplifyOptions& options) const override {
+        ++calls;
+        return inner.simplify(mesh, options);
+    }
+    std::string_view name() const noexcept override { return "counting"; }
+    
+    core::MeshoptSimplifier inner;
+    mutable int calls{0};
+};
+
+// 模拟简化失败：原样返回输入
+class FailingSimplifier : public core::ISimplifier {
+public:
+    core::SimplifyResult simplify(const core::Mesh& mesh, const core::SimplifyOptions&) const override {
+        ++calls;
+        return {mesh, 0.0, mesh.triangleCount(), false};
+    }
+    std::string_view name() const noexcept override { return "failing"; }
+    
+    mutable int calls{0};
+};
+
+std::vector<std::filesystem::path> cacheEntries(const std::filesystem::path& directory) {
+    std::vector<std::filesystem::path> entries;
+    for (const auto& entry : std::filesystem::recursive_directory_iterator(directory)) {
+        if (entry.is_regular_file() && entry.path().extension() == ".lsc") {
+            entries.push_back(entry.path());
+        }
+    }
+    return entries;
+}
+
+std::filesystem::path freshDirectory(const std::string& name) {
+    const auto dir = std::filesystem::temp_directory_path() / name;
+    std::filesystem::remove_all(dir);
+    return dir;
+}
+
+} // namespace
+
+TEST_CASE("Simplification cache key", "[cache]") {
+    const auto grid = test::makeGrid(6, {.relief = 0.1f});
+    core::SimplifyOptions options;
+    options.targetTriangleCount = 20;
+    const auto key = io::computeSimplifyCacheKey(grid, options, "meshopt");
+    
+    SECTION("Same input gives the same key") {
+        REQUIRE(io::computeSimplifyCacheKey(test::makeGrid(6, {.relief = 0.1f}), options, "meshopt") == key);
+    }
+    
+    SECTION("Target, options, backend and geometry change the key") {
+        auto changed = options;
+        changed.targetTriangleCount = 21;
+        REQUIRE(io::computeSimplifyCacheKey(grid, changed, "meshopt") != key);
+        
+        changed = options;
+        changed.lockBorder = true;
+        REQUIRE(io::computeSimplifyCacheKey(grid, changed, "meshopt") != key);
+        
+        changed = options;
+        changed.lockCellFaces = core::BoundingBox({0, 0, 0}, {3, 3, 1});
+        REQUIRE(io::computeSimplifyCacheKey(grid, changed, "meshopt") != key);
+        
+        REQUIRE(io::computeSimplifyCacheKey(grid, options, "qem") != key);
+        REQUIRE(io::computeSimplifyCacheKey(test::makeGrid(5, {.relief = 0.1f}), options, "meshopt") != key);
+    }
+    
+    SECTION("Compaction does not change the key") {
+        auto changed = options;
+        changed.compactVertices = false;
+        REQUIRE(io::computeSimplifyCacheKey(grid, changed, "meshopt") == key);
+    }
+}
+
+TEST_CASE("Simplification cache store", "[cache]") {
+    const auto dir = freshDirectory("lod_simplify_cache_store");
+    const io::SimplifyCache cache(dir);
+    const io::SimplifyCacheKey key{1, 2};
+    
+    SECTION("Missing entry is a miss") {
+        REQUIRE(!cache.load(key));
+        REQUIRE(cache.stats().misses == 1);
+    }
+    
+    SECTION("Stored entry round-trips") {
+        const io::CachedSimplification entry{{0, 1, 2, 2, 1, 3}, 0.25, 2, true};
+        REQUIRE(cache.store(key, entry));
+        
+        const auto loaded = cache.load(key);
+        REQUIRE(loaded);
+        REQUIRE(loaded->indices == entry.indices);
+        REQUIRE(loaded->error == 0.25);
+        REQUIRE(loaded->topologyTriangleCount == 2);
+        REQUIRE(loaded->usedFallback);
+        REQUIRE(cache.stats().hits == 1);
+        REQUIRE(cacheEntries(dir).size() == 1);
+    }
+    
+    SECTION("Corrupted entry is a miss") {
+        REQUIRE(cache.store(key, {{0, 1, 2}, 0.0, 1, false}));
+        std::filesystem::resize_file(cacheEntries(dir).front(), 10);
+        REQUIRE(!cache.load(key));
+    }
+    
+    std::filesystem::remove_all(dir);
+}
+
+TEST_CASE("Simplification cache eviction", "[cache]") {
+    const auto dir = freshDirectory("lod_simplify_cache_lru");
+    const io::CachedSimplification entry{std::vector<core::Index>(300, 0), 0.0, 100, false};
+    {
+        const io::SimplifyCache writer(dir);
+        for (std::uint64_t i = 0; i < 3; ++i) {
+            REQUIRE(writer.store({i, i}, entry));
+        }
+    }
+    
+    // 全部条目设为一小时前使用过，再读取第 0 个使其成为最近使用
+    const auto entries = cacheEntries(dir);
+    REQUIRE(entries.size() == 3);
+    const auto entrySize = std::filesystem::file_size(entries.front());
+    for (const auto& path : entries) {
+        std::filesystem::last_write_time(path, std::filesystem::file_time_type::clock::now() - std::chrono::hours(1));
+    }
+    
+    const io::SimplifyCache cache(dir, 2 * entrySize);
+    REQUIRE(cache.load({0, 0}));
+    REQUIRE(cache.trim() == 1);
+    REQUIRE(cacheEntries(dir).size() == 2);
+    REQUIRE(cache.load({0, 0}));
+    REQUIRE(cache.stats().evictions == 1);
+    
+    std::filesystem::remove_all(dir);
+}
+
+TEST_CASE("Caching simplifier", "[cache]") {
+    const auto dir = freshDirectory("lod_simplify_cache_decorator");
+    const auto cache = std::make_shared<io::SimplifyCache>(dir);
+    const auto inner = std::make_shared<CountingSimplifier>();
+    const io::CachingSimplifier simplifier(inner, cache);
+    
+    const auto grid = test::makeGrid(8, {.relief = 0.1f});
+    core::SimplifyOptions options;
+    options.targetTriangleCount = 40;
+    options.targetError = 1.0f;
+    
+    const auto first = simplifier.simplify(grid, options);
+    const auto second = simplifier.simplify(grid, options);
+    
+    SECTION("Second run replays the stored result") {
+        REQUIRE(inner->calls == 1);
+        REQUIRE(second.mesh.indices() == first.mesh.indices());
+        REQUIRE(second.mesh.vertices().positions == first.mesh.vertices().positions);
+        REQUIRE(second.error == first.error);
+        REQUIRE(cache->stats().hits == 1);
+        REQUIRE(cache->stats().stores == 1);
+    }
+    
+    SECTION("Changed parameters recompute") {
+        auto changed = options;
+        changed.targetTriangleCount = 60;
+        (void)simplifier.simplify(grid, changed);
+        REQUIRE(inner->calls == 2);
+    }
+    
+    SECTION("Compaction is applied after lookup") {
+        auto deferred = options;
+        deferred.compactVertices = false;
+        const auto uncompacted = simplifier.simplify(grid, deferred);
+        REQUIRE(inner->calls == 1);
+        REQUIRE(uncompacted.mesh.vertexCount() == grid.vertexCount());
+        REQUIRE(first.mesh.vertexCount() < grid.vertexCount());
+    }
+    
+    SECTION("Small meshes bypass the cache") {
+        auto generous = options;
+        generous.targetTriangleCount = 1000;
+        (void)simplifier.simplify(grid, generous);
+        REQUIRE(cache->stats().stores == 1);
+    }
+    
+    SECTION("Failed simplifications are not stored") {
+        const auto failing = std::make_shared<FailingSimplifier>();
+        const io::CachingSimplifier failingCache(failing, cache);
+        (void)failingCache.simplify(grid, options);
+        (void)failingCache.simplify(grid, options);
+        REQUIRE(failing->calls == 2);
+        REQUIRE(cache->stats().stores == 1);
+    }
+    
+    std::filesystem::remove_all(dir);
+}
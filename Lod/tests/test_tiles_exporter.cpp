@@ -0,0 +1,103 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+#include "../src/io/TilesExporter.hpp"
+#include "../src/io/PlyReader.hpp"
+#include <filesystem>
+#include <fstream>
+
+using namespace lod;
+
+namespace {
+
+// 写出 ASCII PLY：以文件原点为中心、size 米见方的 n x n 格网（东-北-天局部偏移）
+std::filesystem::path writeGridPly(const std::string& name, int n, double size) {
+    const auto path = std::filesystem::temp_directory_path() / name;
+    std::ofstream out(path);
+    out << "ply\nformat ascii 1.0\n"
+        << "element vertex " << (n + 1) * (n + 1) << "\n"
+        << "property float x\nproperty float y\nproperty float z\n"
+        << "element face " << 2 * n * n << "\n"
+        << "property list uchar int vertex_indices\nend_header\n";
+    for (int y = 0; y <= n; ++y) {
+        for (int x = 0; x <= n; ++x) {
+            out << size * (static_cast<double>(x) / n - 0.5) << " " << size * (static_cast<double>(y) / n - 0.5)
+                << " " << (x + y) % 3 << "\n";
+        }
+    }
+    const auto at = [n](int x, int y) { return y * (n + 1) + x; };
+    for (int y = 0; y < n; ++y) {
+        for (int x = 0; x < n; ++x) {
+            out << "3 " << at(x, y) << " " << at(x + 1, y) << " " << at(x + 1, y + 1) << "\n";
+            out << "3 " << at(x, y) << " " << at(x + 1, y + 1) << " " << at(x, y + 1) << "\n";
+        }
+    }
+    return path;
+}
+
+} // namespace
+
+TEST_CASE("Region or box bounding volume", "[tiles]") {
+    const io::TilesetBuilder builder;
+    
+    // 约 1.1 km 见方、高差为 0 的区域，以及贴合它的局部 ENU 平面 box
+    geo::GeoBBox region{120.0, 30.0, 120.01, 30.01};
+    region.minHeight = 0.0;
+    region.maxHeight = 0.0;
+    const auto halfWidth = geo::widthMeters(region) / 2.0;
+    const auto halfHeight = geo::heightMeters(region) / 2.0;
+    
+    SECTION("Flat data prefers the tight box over the curved region") {
+        const auto box = core::OrientedBox::fromBounds(core::BoundingBox(
+            {static_cast<float>(-halfWidth), static_cast<float>(-halfHeight), 0.0f},
+            {static_cast<float>(halfWidth), static_cast<float>(halfHeight), 0.0f}));
+        REQUIRE(builder.buildBoundingVolume(region, box).contains("box"));
+    }
+    
+    SECTION("A box larger than the region loses") {
+        const auto box = core::OrientedBox::fromBounds(core::BoundingBox(
+            {static_cast<float>(-halfWidth), static_cast<float>(-halfHeight), -50.0f},
+            {static_cast<float>(halfWidth), static_cast<float>(halfHeight), 50.0f}));
+        REQUIRE(builder.buildBoundingVolume(region, box).contains("region"));
+    }
+    
+    SECTION("Nodes without content use the region") {
+        REQUIRE(builder.buildBoundingVolume(region, std::nullopt).contains("region"));
+    }
+}
+
+TEST_CASE("Tiled geographic export keeps the reader's frame", "[tiles]") {
+    const auto path = writeGridPly("lod_tiles_export_grid.ply", 16, 200.0);
+    const io::GeoPlyReader reader({{path, geo::GeoPoint{120.0037, 30.0021, 15.0}, "EPSG:4326"}});
+    const auto input = reader.readAllWithGeoBounds();
+    REQUIRE(input);
+    const auto& [mesh, dataBounds] = *input;
+    
+    const geo::TilingScheme scheme(geo::TilingSchemeType::Geodetic);
+    core::LodConfig config;
+    config.strategy = std::make_unique<core::TriangleCountStrategy>(64, 0.5);
+    config.tilingScheme = scheme;
+    config.maxLodLevels = 3;
+    
+    // 按瓦片方案细分时根区域是方案中的瓦片，远大于数据范围，其中心不是读取器坐标系的原点
+    const auto root = core::buildGeoLodHierarchy(mesh, dataBounds, config);
+    REQUIRE(root);
+    REQUIRE(root->region.maxLon - root->region.minLon > dataBounds.maxLon - dataBounds.minLon);
+    
+    const io::TilesetBuilder builder(io::TilesExportConfig{.tilingScheme = scheme, .dataBounds = dataBounds});
+    const auto tileset = builder.buildTileset(core::LodNode{*root});
+    const auto transform = tileset["root"]["transform"].get<std::array<double, 16>>();
+    
+    const auto expected = geo::LocalFrame::enuAt(dataBounds).toEcefMatrix();
+    for (size_t i = 0; i < expected.size(); ++i) {
+        REQUIRE(transform[i] == Catch::Approx(expected[i]).margin(1e-6));
+    }
+    
+    // 首个顶点经根瓦片的 transform（列主序）回到它在文件坐标系中的地心位置
+    const auto& p = mesh.vertices().positions.front();
+    const auto source = geo::LocalFrame::enuAt(geo::GeoPoint{120.0037, 30.0021, 15.0}).toEcef({-100.0, -100.0, 0.0});
+    for (int row = 0; row < 3; ++row) {
+        const double ecef = transform[row] * p[0] + transform[4 + row] * p[1] + transform[8 + row] * p[2] +
+                            transform[12 + row];
+        REQUIRE(ecef == Catch::Approx(source[row]).margin(1e-2));
+    }
+}
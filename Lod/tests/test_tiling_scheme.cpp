@@ -0,0 +1,99 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+#include "../src/geo/TilingScheme.hpp"
+
+using namespace lod::geo;
+
+TEST_CASE("Geodetic tiling scheme", "[tiling]") {
+    const TilingScheme scheme(TilingSchemeType::Geodetic);
+    
+    SECTION("Level 0 has an eastern and a western tile") {
+        REQUIRE(scheme.tilesX(0) == 2);
+        REQUIRE(scheme.tilesY(0) == 1);
+        REQUIRE(scheme.keyAt(-10.0, 10.0, 0) == TileKey{0, 0, 0});
+        REQUIRE(scheme.keyAt(10.0, 10.0, 0) == TileKey{0, 1, 0});
+        
+        const auto east = scheme.bounds({0, 1, 0});
+        REQUIRE(east.minLon == 0.0);
+        REQUIRE(east.maxLon == 180.0);
+        REQUIRE(east.minLat == -90.0);
+        REQUIRE(east.maxLat == 90.0);
+    }
+    
+    SECTION("Rows count from the south") {
+        REQUIRE(scheme.keyAt(100.5, -45.5, 1) == TileKey{1, 3, 0});
+        REQUIRE(scheme.keyAt(100.5, 45.5, 1) == TileKey{1, 3, 1});
+        
+        const auto tile = scheme.bounds({3, 13, 5});
+        REQUIRE(tile.width() == Catch::Approx(22.5));
+        REQUIRE(tile.minLon == Catch::Approx(112.5));
+        REQUIRE(tile.minLat == Catch::Approx(22.5));
+    }
+    
+    SECTION("Coarser keys are parents of finer keys") {
+        const auto coord = scheme.coordAt(116.39, 39.91);
+        for (std::uint32_t z = 1; z <= TilingScheme::kMaxLevel; ++z) {
+            REQUIRE(TilingScheme::keyAt(coord, z).parent() == TilingScheme::keyAt(coord, z - 1));
+        }
+        const auto key = TilingScheme::keyAt(coord, 12);
+        REQUIRE(scheme.bounds(key).contains(116.39, 39.91));
+    }
+    
+    SECTION("Enclosing tile") {
+        const GeoBBox small{116.30, 39.85, 116.35, 39.90};
+        const auto key = scheme.enclosingTile(small);
+        REQUIRE(key);
+        const auto tile = scheme.bounds(*key);
+        REQUIRE(tile.contains(small.minLon, small.minLat));
+        REQUIRE(tile.contains(small.maxLon, small.maxLat));
+        
+        // 再深一级的瓦片都无法完整包含它
+        for (const auto& child : key->children()) {
+            const auto childTile = scheme.bounds(child);
+            REQUIRE_FALSE((childTile.contains(small.minLon, small.minLat) &&
+                           childTile.contains(small.maxLon, small.maxLat)));
+        }
+        
+        // 跨越本初子午线的数据没有共同的 0 级瓦片
+        REQUIRE(!scheme.enclosingTile({-0.1, 51.4, 0.1, 51.6}));
+        REQUIRE(scheme.tilesAt({-0.1, 51.4, 0.1, 51.6}, 0).size() == 2);
+    }
+    
+    SECTION("Tile keys are recovered from their bounds") {
+        const TileKey key{9, 300, 200};
+        REQUIRE(scheme.keyOf(scheme.bounds(key)) == key);
+        REQUIRE(scheme.keyOf(scheme.bounds(key).withHeights(-10.0, 50.0)) == key);
+        REQUIRE(!scheme.keyOf({100.0, 30.0, 104.0, 34.0}));
+        REQUIRE(!scheme.keyOf(scheme.extent()));
+    }
+}
+
+TEST_CASE("Web Mercator tiling scheme", "[tiling]") {
+    const TilingScheme scheme(TilingSchemeType::WebMercator);
+    
+    SECTION("Keys match the z/x/y convention") {
+        REQUIRE(scheme.tilesX(0) == 1);
+        REQUIRE(scheme.keyAt(13.4, 52.5, 10) == TileKey{10, 550, 335});
+        REQUIRE(scheme.keyAt(0.1, 0.1, 1) == TileKey{1, 1, 0});
+        REQUIRE(scheme.keyAt(0.1, -0.1, 1) == TileKey{1, 1, 1});
+    }
+    
+    SECTION("Tile bounds are limited to the Mercator latitude range") {
+        const auto world = scheme.bounds({0, 0, 0});
+        REQUIRE(world.maxLat == Catch::Approx(85.0511287798));
+        REQUIRE(world.minLat == Catch::Approx(-85.0511287798));
+        
+        const auto north = scheme.bounds({1, 0, 0});
+        REQUIRE(north.minLat == Catch::Approx(0.0).margin(1e-12));
+        REQUIRE(north.maxLon == Catch::Approx(0.0).margin(1e-12));
+        
+        // 超出纬度上限的点夹取到边缘瓦片
+        REQUIRE(scheme.keyAt(10.0, 89.0, 3).y == 0);
+    }
+    
+    SECTION("Tile keys are recovered from their bounds") {
+        const TileKey key{14, 8800, 5370};
+        REQUIRE(scheme.keyOf(scheme.bounds(key)) == key);
+        REQUIRE(scheme.enclosingTile({-0.1, 51.4, 0.1, 51.6}) == TileKey{0, 0, 0});
+    }
+}